@@ -0,0 +1,143 @@
+#ifndef _ANALOGPROTOTYPE_HPP_
+#define _ANALOGPROTOTYPE_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <map>
+#include <tuple>
+#include <mutex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The kinds of analog prototype filters.
+ */
+enum class PrototypeType
+{
+    Butterworth,        //< Maximally flat passband.
+    ChebyshevI,         //< Equiripple passband, monotonic stopband.
+    ChebyshevII,        //< Monotonic passband, equiripple stopband.
+    Elliptic,           //< Equiripple passband and stopband, the steepest transition for a given order.
+    Bessel              //< Maximally flat group delay.
+};
+
+/**
+ * \brief This represents a transfer function by its zeros, poles and gain: H(s) = gain * prod (s - z_i) / prod (s - p_i).
+ */
+typedef struct PoleZeroSet
+{
+    std::vector<std::complex<highprecision>> zeros;
+    std::vector<std::complex<highprecision>> poles;
+    highprecision gain;
+} PoleZeroSet;
+
+/**
+ * \brief Generates normalized analog lowpass prototypes of any order, either as PoleZeroSet or as transfer function
+ *        H(s) (see Discretization for mapping them to digital filters).
+ *
+ * \remarks The prototypes are normalized as follows:
+ *          - Butterworth: -3 dB at 1 rad/s.
+ *          - Chebyshev I and elliptic: the passband (with the given ripple) ends at 1 rad/s.
+ *          - Chebyshev II: the stopband (with the given attenuation) starts at 1 rad/s.
+ *          - Bessel: the group delay at DC is 1 s.
+ *          The DC gain is 1, except for Chebyshev I and elliptic filters of even order, which start at the bottom of
+ *          the passband ripple. Elliptic filters are designed by the Landen transformation for the jacobi elliptic
+ *          functions (S. J. Orfanidis, "Lecture Notes on Elliptic Filter Design", 2006).
+ *          Design() and DesignTransferFunction() memoize their results, so repeated requests for the same prototype
+ *          (e.g. while a parameter is dragged back and forth) cost only a lookup. The cache is shared by all
+ *          threads and is cleared once it holds CACHE_MAX_SIZE prototypes.
+ *          https://en.wikipedia.org/wiki/Prototype_filter
+ */
+class AnalogPrototype
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t CACHE_MAX_SIZE          = 4096;     //< The maximum number of prototypes held by the cache.
+static constexpr int    LANDEN_MAX_ITERATIONS   = 16;       //< The maximum number of descending landen transformations.
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Designs a prototype, served from the cache if it was designed before.
+ *
+ * \param type The kind of the prototype.
+ * \param order The order, at least 1.
+ * \param ripple The passband ripple in dB, only used by Chebyshev I and elliptic filters.
+ * \param attenuation The minimum stopband attenuation in dB, only used by Chebyshev II and elliptic filters.
+ * \return PoleZeroSet The zeros, poles and gain of the prototype.
+ */
+static PoleZeroSet Design(PrototypeType type, int order, highprecision ripple = 0, highprecision attenuation = 0);
+
+/**
+ * \brief Designs a prototype as transfer function H(s), served from the cache if it was designed before.
+ *
+ * \remarks See Design().
+ */
+static PolynomialFraction DesignTransferFunction(PrototypeType type, int order, highprecision ripple = 0, highprecision attenuation = 0);
+
+static PoleZeroSet Butterworth(int order);
+static PoleZeroSet ChebyshevI(int order, highprecision ripple);
+static PoleZeroSet ChebyshevII(int order, highprecision attenuation);
+static PoleZeroSet Elliptic(int order, highprecision ripple, highprecision attenuation);
+static PoleZeroSet Bessel(int order);
+
+/**
+ * \brief Expands a PoleZeroSet to the transfer function H(s) = N(s) / D(s) with a monic denominator.
+ */
+static PolynomialFraction ToTransferFunction(const PoleZeroSet& prototype);
+
+/**
+ * \brief Returns the number of prototypes in the cache.
+ */
+static size_t GetCacheSize();
+
+/**
+ * \brief Removes every prototype from the cache.
+ */
+static void ClearCache();
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+typedef std::tuple<PrototypeType, int, highprecision, highprecision> CacheKey;
+
+struct CacheEntry
+{
+    PoleZeroSet         Prototype;          //< The zeros, poles and gain.
+    PolynomialFraction  TransferFunction;   //< The expanded transfer function.
+};
+
+/* Private Member variables **************************************************/
+static std::map<CacheKey, CacheEntry>   Cache;      //< The prototypes designed so far.
+static std::mutex                       CacheMutex; //< Guards the cache.
+
+/* Private Methods ***********************************************************/
+static CacheEntry Lookup(PrototypeType type, int order, highprecision ripple, highprecision attenuation);
+static CoefficientList GetBesselCoefficients(int order);
+
+// Jacobi elliptic functions with complex argument in units of the quarter period K, see Orfanidis
+static std::vector<highprecision> GetLandenSequence(highprecision modulus);
+static highprecision GetQuarterPeriod(highprecision modulus);
+static Complex EvaluateCd(Complex u, highprecision modulus);
+static Complex EvaluateSn(Complex u, highprecision modulus);
+static Complex InverseCd(Complex w, highprecision modulus);
+static Complex InverseSn(Complex w, highprecision modulus);
+static highprecision SolveDegreeEquation(int order, highprecision modulus);
+
+};
+
+} // namespace vath
+
+#endif /* _ANALOGPROTOTYPE_HPP_ */
@@ -0,0 +1,168 @@
+#ifndef _CHEBYSHEVPOLYNOMIAL_HPP_
+#define _CHEBYSHEVPOLYNOMIAL_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <functional>
+#include <string>
+#include <sstream>
+#include <iomanip>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "interval.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief This represents a polynomial in the chebyshev basis on a domain [a, b]: p(x) = sum_k c_k T_k(t), where
+ *        t = (2x - a - b) / (b - a) maps the domain onto [-1, 1] and T_k(cos(phi)) = cos(k phi).
+ *
+ * \remarks Unlike the monomial basis, the chebyshev basis is well conditioned on its domain, so high orders can
+ *          be evaluated accurately, and the coefficients of a smooth function decay fast (truncating them yields a
+ *          near-best approximation). The values at the chebyshev points and the coefficients are linked by a
+ *          discrete cosine transform, which is computed in O(n log n) (see FastFourierTransform).
+ *          https://en.wikipedia.org/wiki/Chebyshev_polynomials
+ */
+class ChebyshevPolynomial
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t BATCH_LANES = 4;      //< The number of points evaluated side by side by the batch evaluation.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Creates the zero polynomial on [-1, 1].
+ */
+ChebyshevPolynomial();
+
+/**
+ * \brief Construct a new ChebyshevPolynomial object.
+ *
+ * \param coefficients The coefficients c_0, c_1, ... of T_0, T_1, ... (lowest order first, unlike CoefficientList).
+ * \param domain The domain [a, b] with a < b.
+ */
+ChebyshevPolynomial(const std::vector<highprecision>& coefficients, const Interval& domain = Interval(-1, 1));
+
+ChebyshevPolynomial(const ChebyshevPolynomial& original);
+
+/* Accessors/Mutators ********************************************************/
+std::vector<highprecision> GetCoefficients() const;
+Interval GetDomain() const;
+int GetOrder() const;
+
+/**
+ * \brief Returns the values at the chebyshev points of the domain (see GetChebyshevPoints()) in O(n log n).
+ */
+std::vector<highprecision> GetValues() const;
+
+/* Enabling toString() *******************************************************/
+
+std::string toString() const {
+    std::stringstream ss;
+    ss << *this;
+    return ss.str();
+}
+
+// Friend declaration for operator<<
+friend std::ostream& operator<<(std::ostream& os, const ChebyshevPolynomial& polynomial);
+
+/* Operators *****************************************************************/
+bool operator ==(const ChebyshevPolynomial& other) const;
+bool operator !=(const ChebyshevPolynomial& other) const;
+ChebyshevPolynomial& operator =(const ChebyshevPolynomial& right);
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Evaluates the polynomial by the clenshaw recurrence. Points outside of the domain are extrapolated.
+ */
+highprecision EvaluateAt(highprecision x) const;
+
+/**
+ * \brief Evaluates the polynomial at many points. BATCH_LANES points run through the clenshaw recurrence side by
+ *        side with independent accumulators, so their multiply-add chains overlap instead of waiting on each other.
+ */
+std::vector<highprecision> EvaluateAt(const std::vector<highprecision>& x) const;
+
+/**
+ * \brief Differentiates the polynomial once, in the chebyshev basis.
+ */
+void Differentiate();
+static ChebyshevPolynomial Differentiate(const ChebyshevPolynomial& p);
+
+/**
+ * \brief Integrates the polynomial once, in the chebyshev basis. The constant is chosen such that the integral is 0
+ *        at the lower limit of the domain.
+ */
+void Integrate();
+static ChebyshevPolynomial Integrate(const ChebyshevPolynomial& p);
+
+/**
+ * \brief Returns the integral of the polynomial over [lowerLimit, upperLimit].
+ */
+highprecision GetArea(highprecision lowerLimit, highprecision upperLimit) const;
+
+/**
+ * \brief Converts the polynomial to the monomial basis (in x, not in t).
+ *
+ * \remarks The monomial coefficients of a high order polynomial on a domain far from 0 may be badly conditioned.
+ */
+Polynomial ToPolynomial() const;
+
+/**
+ * \brief Converts a polynomial from the monomial basis to the chebyshev basis on the given domain.
+ */
+static ChebyshevPolynomial FromPolynomial(const Polynomial& function, const Interval& domain = Interval(-1, 1));
+
+/**
+ * \brief Constructs the polynomial which takes the given values at the chebyshev points (see GetChebyshevPoints())
+ *        in O(n log n).
+ *
+ * \param values The values at the chebyshev points of the domain, in ascending order of the points.
+ * \param domain The domain [a, b] with a < b.
+ */
+static ChebyshevPolynomial FromValues(const std::vector<highprecision>& values, const Interval& domain = Interval(-1, 1));
+
+/**
+ * \brief Approximates a function on the domain by interpolating it at the chebyshev points.
+ *
+ * \param function The function to be approximated.
+ * \param order The order of the approximating polynomial.
+ * \param domain The domain [a, b] with a < b.
+ */
+static ChebyshevPolynomial Interpolate(const std::function<highprecision(highprecision)>& function, int order, const Interval& domain = Interval(-1, 1));
+
+/**
+ * \brief Returns the order + 1 chebyshev points (of the second kind) of the domain, the extrema of T_order mapped
+ *        onto the domain, in ascending order. Both limits of the domain are included.
+ */
+static std::vector<highprecision> GetChebyshevPoints(int order, const Interval& domain = Interval(-1, 1));
+
+// Overloaded standard methods
+std::string to_string() const;
+
+bool IsEqual(const ChebyshevPolynomial& other) const;
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+std::vector<highprecision>  Coefficients;   //< c_0, c_1, ..., c_n, lowest order first.
+Interval                    Domain;         //< The domain [a, b], which is mapped onto [-1, 1].
+
+/* Private Methods ***********************************************************/
+highprecision MapToUnitInterval(highprecision x) const;
+
+};
+
+} // namespace vath
+
+#endif /* _CHEBYSHEVPOLYNOMIAL_HPP_ */
@@ -0,0 +1,143 @@
+#ifndef _DISCRETIZATION_HPP_
+#define _DISCRETIZATION_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The way an analog transfer function H(s) is mapped to a digital one H(z).
+ */
+enum class DiscretizationMethod
+{
+    Bilinear,           //< s = K (z - 1) / (z + 1) with K = 2 fs, or prewarped to preserve one frequency.
+    MatchedZ,           //< Every pole and zero p is mapped to e^(p T), zeros at infinity to z = -1.
+    ImpulseInvariance   //< The impulse response is sampled, h[n] = T h(n T).
+};
+
+/**
+ * \brief Maps analog transfer functions H(s) = N(s) / D(s) to digital ones H(z) = B(z) / A(z), the core step of
+ *        designing a digital filter from an analog prototype.
+ *
+ * \remarks Both the analog and the digital transfer function are PolynomialFractions, the digital one in positive
+ *          powers of z (so the denominator can be checked directly, see StabilityAnalysis::IsSchurStable()) and
+ *          normalized to a monic denominator.
+ *          The bilinear transform works on the coefficients only: (z + 1)^n P(K (z - 1) / (z + 1)) is a scaling, two
+ *          taylor shifts and a reversal (see Polynomial::TaylorShiftCoefficients()), no zero has to be found.
+ *          Matched-z and impulse invariance need the poles (and zeros), which are found once by
+ *          Polynomial::FindComplexZeros(). The batch methods share them between all sample rates.
+ *          https://en.wikipedia.org/wiki/Bilinear_transform
+ *          https://en.wikipedia.org/wiki/Matched_Z-transform_method
+ *          https://en.wikipedia.org/wiki/Impulse_invariance
+ */
+class Discretization
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr highprecision SIMPLE_POLE_TOLERANCE = 1E-9;     //< Relative distance below which two poles count as one multiple pole.
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Applies the bilinear transform s = 2 fs (z - 1) / (z + 1).
+ *
+ * \param analog The analog transfer function H(s), not improper (deg N <= deg D).
+ * \param sampleRate The sample rate fs in Hz.
+ * \return PolynomialFraction H(z), numerator and denominator of order deg D.
+ */
+static PolynomialFraction Bilinear(const PolynomialFraction& analog, highprecision sampleRate);
+
+/**
+ * \brief Applies the bilinear transform prewarped at the given frequency, s = K (z - 1) / (z + 1) with
+ *        K = w / tan(w / (2 fs)). Thus H(z) at e^(j w / fs) equals H(s) at j w exactly.
+ *
+ * \param analog The analog transfer function H(s), not improper (deg N <= deg D).
+ * \param sampleRate The sample rate fs in Hz.
+ * \param prewarpFrequency The angular frequency w in rad/s, 0 < w < pi fs. 0 means no prewarping.
+ */
+static PolynomialFraction Bilinear(const PolynomialFraction& analog, highprecision sampleRate, highprecision prewarpFrequency);
+
+/**
+ * \brief Applies the matched-z transform. The gain is matched at DC, or at a quarter of the sample rate if H(s) has
+ *        a pole or a zero at s = 0.
+ *
+ * \param analog The analog transfer function H(s), not improper (deg N <= deg D).
+ * \param sampleRate The sample rate fs in Hz.
+ */
+static PolynomialFraction MatchedZ(const PolynomialFraction& analog, highprecision sampleRate);
+
+/**
+ * \brief Applies the impulse invariance, H(z) = T sum r_i z / (z - e^(p_i T)) for H(s) = sum r_i / (s - p_i).
+ *
+ * \param analog The analog transfer function H(s), strictly proper (deg N < deg D) and with simple poles only.
+ * \param sampleRate The sample rate fs in Hz.
+ */
+static PolynomialFraction ImpulseInvariance(const PolynomialFraction& analog, highprecision sampleRate);
+
+/**
+ * \brief Maps the analog transfer function by the given method.
+ *
+ * \param prewarpFrequency Only used by the bilinear transform, see Bilinear().
+ */
+static PolynomialFraction Discretize(const PolynomialFraction& analog, highprecision sampleRate, DiscretizationMethod method, highprecision prewarpFrequency = 0);
+
+/**
+ * \brief Maps the analog transfer function for many sample rates in parallel. The poles, zeros and residues are
+ *        computed only once.
+ *
+ * \param analog The analog transfer function H(s).
+ * \param sampleRates The sample rates in Hz.
+ * \param method The method.
+ * \param pool The pool the sample rates are distributed on.
+ * \param prewarpFrequency Only used by the bilinear transform, see Bilinear().
+ * \return std::vector<PolynomialFraction> One digital transfer function per sample rate, in the same order.
+ */
+static std::vector<PolynomialFraction> Discretize(const PolynomialFraction& analog, const std::vector<highprecision>& sampleRates, DiscretizationMethod method, TaskPool& pool, highprecision prewarpFrequency = 0);
+
+/**
+ * \brief Maps the analog transfer function for many sample rates in parallel on a temporary pool.
+ */
+static std::vector<PolynomialFraction> Discretize(const PolynomialFraction& analog, const std::vector<highprecision>& sampleRates, DiscretizationMethod method, highprecision prewarpFrequency = 0);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+
+struct AnalogPoleZero
+{
+    CoefficientList         Numerator;      //< N(s), highest order first.
+    CoefficientList         Denominator;    //< D(s), highest order first.
+    std::vector<Complex>    Zeros;          //< The zeros of N(s), only for matched-z.
+    std::vector<Complex>    Poles;          //< The zeros of D(s).
+    std::vector<Complex>    Residues;       //< The residues at the poles, only for impulse invariance.
+};
+
+/* Private Methods ***********************************************************/
+static AnalogPoleZero Analyze(const PolynomialFraction& analog, DiscretizationMethod method);
+static PolynomialFraction Discretize(const AnalogPoleZero& analog, highprecision sampleRate, DiscretizationMethod method, highprecision prewarpFrequency);
+static PolynomialFraction Bilinear(const CoefficientList& numerator, const CoefficientList& denominator, highprecision k);
+static CoefficientList SubstituteBilinear(const CoefficientList& coefficients, int order, highprecision k);
+static PolynomialFraction MatchedZ(const AnalogPoleZero& analog, highprecision sampleRate);
+static PolynomialFraction ImpulseInvariance(const AnalogPoleZero& analog, highprecision sampleRate);
+static Complex EvaluateAt(const CoefficientList& coefficients, Complex x);
+static PolynomialFraction Normalize(const CoefficientList& numerator, const CoefficientList& denominator);
+
+};
+
+} // namespace vath
+
+#endif /* _DISCRETIZATION_HPP_ */
@@ -0,0 +1,98 @@
+#ifndef _FASTFOURIERTRANSFORM_HPP_
+#define _FASTFOURIERTRANSFORM_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+
+namespace Vath
+{
+
+/**
+ * \brief Fast fourier transform and the transforms and products built on top of it, all in O(n log n).
+ *
+ * \remarks Power of two lengths use the iterative radix-2 algorithm, every other length is reduced to a power of
+ *          two by bluestein's chirp-z algorithm. The twiddle factors are computed directly (not by recurrence), so
+ *          the error grows with log n only.
+ *          The template is instantiated for double and long double (highprecision) only.
+ *          https://en.wikipedia.org/wiki/Cooley%E2%80%93Tukey_FFT_algorithm
+ *          https://en.wikipedia.org/wiki/Chirp_Z-transform#Bluestein's_algorithm
+ */
+template<typename T>
+class FastFourierTransform
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t DIRECT_CONVOLUTION_MAX_LENGTH = 32;     //< Below this length of the shorter operand, convolutions are computed directly.
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Transforms the data in place: X_k = sum_j x_j e^(-2 pi i jk / n).
+ *
+ * \param data The data of any length.
+ * \param inverse If true, the inverse transform (including the factor 1 / n) is computed instead.
+ */
+static void Transform(std::vector<std::complex<T>>& data, bool inverse = false);
+
+/**
+ * \brief Transforms data of power of two length in place with precomputed twiddle factors, for callers which
+ *        transform many times with the same length. The inverse transform is not divided by n.
+ *
+ * \param data The data, its length must be a power of two.
+ * \param twiddleFactors The factors for this length (see GetTwiddleFactors()).
+ */
+static void Transform(std::vector<std::complex<T>>& data, const std::vector<std::complex<T>>& twiddleFactors);
+
+/**
+ * \brief Returns the twiddle factors e^(-+2 pi i j / n), j < n / 2, of the power of two length n.
+ *
+ * \param n The transform length.
+ * \param inverse If true, the factors of the inverse transform are returned.
+ */
+static std::vector<std::complex<T>> GetTwiddleFactors(size_t n, bool inverse = false);
+
+/**
+ * \brief Computes the (unnormalized) discrete cosine transform of type I:
+ *        Y_k = v_0 + (-1)^k v_N + 2 sum_(j=1)^(N-1) v_j cos(pi jk / N), for N + 1 values.
+ *        Applying it twice yields 2N times the input.
+ *
+ * \param values The values v_0, ..., v_N.
+ * \return std::vector<T> Y_0, ..., Y_N.
+ */
+static std::vector<T> DiscreteCosineTransform(const std::vector<T>& values);
+
+/**
+ * \brief Computes the linear convolution (the product of two polynomials given by their coefficients).
+ *
+ * \param left The first sequence.
+ * \param right The second sequence.
+ * \return std::vector<T> The convolution of length left.size() + right.size() - 1 (empty if one of them is empty).
+ */
+static std::vector<T> Convolve(const std::vector<T>& left, const std::vector<T>& right);
+
+/**
+ * \brief Returns the smallest power of two which is not less than n (1 for n = 0).
+ */
+static size_t GetNextPowerOfTwo(size_t n);
+
+/*****************************************************************************/
+private:
+
+/* Private Methods ***********************************************************/
+static void TransformPowerOfTwo(std::vector<std::complex<T>>& data, bool inverse);
+static void TransformBluestein(std::vector<std::complex<T>>& data, bool inverse);
+
+};
+
+extern template class FastFourierTransform<double>;
+extern template class FastFourierTransform<long double>;
+
+} // namespace vath
+
+#endif /* _FASTFOURIERTRANSFORM_HPP_ */
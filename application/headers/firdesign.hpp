@@ -0,0 +1,150 @@
+#ifndef _FIRDESIGN_HPP_
+#define _FIRDESIGN_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The windows for the windowed-sinc design.
+ */
+enum class WindowType
+{
+    Rectangular,        //< No window, the narrowest transition but only 21 dB stopband attenuation.
+    Hann,               //< Raised cosine, 44 dB.
+    Hamming,            //< Raised cosine on a pedestal, 53 dB.
+    Blackman,           //< Three cosine terms, 74 dB.
+    Kaiser              //< Bessel window, the attenuation is set by beta (see FirDesign::GetKaiserBeta()).
+};
+
+/**
+ * \brief This represents a frequency band of a FIR specification. Frequencies are normalized to the sample rate,
+ *        so they lie in [0, 0.5].
+ */
+typedef struct FirBand
+{
+    highprecision lowerFrequency;
+    highprecision upperFrequency;
+    highprecision gain;         //< The desired (constant) amplitude in the band.
+    highprecision weight;       //< The relative weight of the error in the band, positive.
+} FirBand;
+
+/**
+ * \brief Designs linear phase FIR filters. The filters are returned as their taps h[0], ..., h[N-1], which are also
+ *        the coefficients of H(z) = sum h[n] z^-n as a polynomial in z^-1 (see ToPolynomial()).
+ *
+ * \remarks - Windowed-sinc: the ideal impulse response truncated by a window, in O(N).
+ *          - Parks-McClellan: the equiripple (minimax) filter for a piecewise constant specification by the remez
+ *            exchange. The amplitude is a polynomial in x = cos(w), which is evaluated on a dense grid by the
+ *            barycentric lagrange formula through the current extremal set. The grid is split into blocks of
+ *            REMEZ_BLOCK_SIZE points, which are distributed on a TaskPool, and within a block the extremal points
+ *            run in the outer loop so that the inner loop is a plain double loop over contiguous arrays, which the
+ *            compiler vectorizes. The levelled error and the coefficients are computed in highprecision. The taps are
+ *            finally read off the chebyshev coefficients of the amplitude (see ChebyshevPolynomial::FromValues()).
+ *            Long filters start from the optimal reference of a filter half as long, scaled to the new length, which
+ *            is itself found the same way.
+ *            Odd lengths yield symmetric type I filters, even lengths symmetric type II filters, which always have
+ *            a zero at the nyquist frequency.
+ *          https://en.wikipedia.org/wiki/Parks%E2%80%93McClellan_filter_design_algorithm
+ */
+class FirDesign
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t         REMEZ_GRID_DENSITY      = 16;       //< The number of grid points per unknown coefficient.
+static constexpr int            REMEZ_MAX_ITERATIONS    = 50;       //< The maximum number of exchanges.
+static constexpr highprecision  REMEZ_TOLERANCE         = 1E-6;     //< Relative difference of the maximum error and the levelled error at which the exchange stops.
+static constexpr size_t         REMEZ_BLOCK_SIZE        = 256;      //< The number of grid points evaluated by one task.
+static constexpr size_t         REMEZ_SCALING_MIN_TERMS = 64;       //< From this number of unknowns on, the exchange starts from the scaled reference of a shorter filter.
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Returns a symmetric window of the given length.
+ *
+ * \param type The kind of window.
+ * \param length The number of samples.
+ * \param beta The shape parameter of the kaiser window, ignored by the others.
+ */
+static std::vector<highprecision> GetWindow(WindowType type, size_t length, highprecision beta = 0);
+
+/**
+ * \brief Returns the kaiser beta which yields the given stopband attenuation (Kaiser's empirical formula).
+ *
+ * \param attenuation The stopband attenuation in dB.
+ */
+static highprecision GetKaiserBeta(highprecision attenuation);
+
+/**
+ * \brief Designs a lowpass, bandpass or highpass filter by the windowed-sinc method. The gain at the center of the
+ *        passband is normalized to 1.
+ *
+ * \param taps The length N of the filter.
+ * \param lowerCutoff The lower edge of the passband in [0, 0.5), 0 for a lowpass.
+ * \param upperCutoff The upper edge of the passband in (lowerCutoff, 0.5], 0.5 for a highpass (needs odd N).
+ * \param window The window.
+ * \param beta The shape parameter of the kaiser window.
+ * \return std::vector<highprecision> The taps h[0], ..., h[N-1].
+ */
+static std::vector<highprecision> WindowedSinc(size_t taps, highprecision lowerCutoff, highprecision upperCutoff, WindowType window = WindowType::Hamming, highprecision beta = 0);
+
+/**
+ * \brief Designs the equiripple filter for the given bands by the Parks-McClellan algorithm.
+ *
+ * \param taps The length N of the filter, at least 3.
+ * \param bands The bands in ascending order. They must not overlap, the gaps between them are don't-care regions.
+ * \param pool The pool the grid evaluations are distributed on.
+ * \return std::vector<highprecision> The taps h[0], ..., h[N-1].
+ * \remarks If the exchange does not converge within REMEZ_MAX_ITERATIONS, the last filter is returned.
+ */
+static std::vector<highprecision> Remez(size_t taps, const std::vector<FirBand>& bands, TaskPool& pool);
+
+/**
+ * \brief Designs the equiripple filter on a temporary pool.
+ */
+static std::vector<highprecision> Remez(size_t taps, const std::vector<FirBand>& bands);
+
+/**
+ * \brief Returns sum h[n] y^n, the transfer function as a polynomial in y = z^-1.
+ */
+static Polynomial ToPolynomial(const std::vector<highprecision>& taps);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+struct RemezGrid
+{
+    std::vector<highprecision>  Frequency;  //< The grid frequencies in [0, 0.5], ascending.
+    std::vector<highprecision>  X;          //< cos(2 pi f), the abscissa of the approximation.
+    std::vector<highprecision>  Desired;    //< The desired amplitude (divided by cos(w / 2) for type II).
+    std::vector<highprecision>  Weight;     //< The error weight (multiplied by cos(w / 2) for type II).
+    std::vector<size_t>         BandBegin;  //< The first grid index of every band.
+    std::vector<size_t>         BandEnd;    //< One past the last grid index of every band.
+};
+
+/* Private Methods ***********************************************************/
+static RemezGrid BuildGrid(size_t r, bool typeOne, const std::vector<FirBand>& bands);
+static std::vector<size_t> SolveRemez(size_t r, bool typeOne, const std::vector<FirBand>& bands, TaskPool& pool, RemezGrid& grid);
+static std::vector<size_t> ScaleReference(const RemezGrid& smallGrid, const std::vector<size_t>& smallReference, const RemezGrid& grid, size_t r);
+static highprecision LevelReference(const RemezGrid& grid, const std::vector<size_t>& reference, TaskPool& pool, std::vector<highprecision>& points, std::vector<highprecision>& weights, std::vector<highprecision>& values);
+static highprecision GetBesselI0(highprecision x);
+static std::vector<highprecision> GetBarycentricWeights(const std::vector<highprecision>& points, TaskPool& pool);
+static highprecision EvaluateBarycentric(const std::vector<highprecision>& points, const std::vector<highprecision>& weights, const std::vector<highprecision>& values, highprecision x);
+
+};
+
+} // namespace vath
+
+#endif /* _FIRDESIGN_HPP_ */
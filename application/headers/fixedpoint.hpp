@@ -0,0 +1,197 @@
+#ifndef _FIXEDPOINT_HPP_
+#define _FIXEDPOINT_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <complex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "secondordersections.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The fixed point formats, signed fractions with 15 or 31 fractional bits.
+ */
+enum class FixedPointFormat
+{
+    Q15,                //< 16 bit, stored in int16_t.
+    Q31                 //< 32 bit, stored in int32_t.
+};
+
+/**
+ * \brief How a value is rounded to the fixed point grid.
+ */
+enum class RoundingMode
+{
+    Nearest,            //< To the nearest value, halfway cases away from zero.
+    Convergent,         //< To the nearest value, halfway cases to the even one.
+    Floor,              //< Towards -infinity, i.e. two's complement truncation.
+    TowardZero          //< Towards 0, i.e. sign-magnitude truncation.
+};
+
+/**
+ * \brief This represents quantized coefficients: coefficient i is values[i] * 2^(integerBits - fractional bits).
+ */
+typedef struct QuantizedCoefficients
+{
+    std::vector<int32_t> values;
+    FixedPointFormat format;
+    int integerBits;            //< The common shift, which makes the largest coefficient fit.
+} QuantizedCoefficients;
+
+/**
+ * \brief This represents a quantized rational function, numerator and denominator with their own shifts.
+ */
+typedef struct QuantizedFraction
+{
+    QuantizedCoefficients numerator;
+    QuantizedCoefficients denominator;
+} QuantizedFraction;
+
+/**
+ * \brief This represents how far the poles of a filter move when its coefficients are quantized.
+ */
+typedef struct PoleMovement
+{
+    std::vector<std::complex<highprecision>> originalPoles;
+    std::vector<std::complex<highprecision>> quantizedPoles;   //< quantizedPoles[i] is the one originalPoles[i] moved to, infinite if it got lost with the leading coefficient.
+    highprecision maximumDisplacement;
+    highprecision maximumRadius;                                //< Of the quantized poles.
+    bool isStable;                                              //< Whether the quantized filter is still stable.
+} PoleMovement;
+
+/**
+ * \brief Quantizes filter coefficients to Q15/Q31 and runs the quantized filters with integer arithmetic, so the
+ *        accuracy and throughput of a fixed point target can be checked before deploying.
+ *
+ * \remarks Coefficients outside [-1, 1) share a shift by integerBits (e.g. Q2.13 for biquads). The shift is chosen so
+ *          that every value lies within +-(2^fractional bits - 1), so no product of two values overflows. The kernels
+ *          accumulate in 64 bits and round and saturate only their outputs.
+ *          - FIR, Q15: the dot product runs on SSE2 (pmaddwd) or AVX2 if the compiler targets them, with a scalar
+ *            fallback otherwise.
+ *          - FIR, Q31 and biquads: scalar, as a recursion can not be vectorized over time and SSE/AVX2 lack a
+ *            signed 32 x 32 -> 64 bit multiply for all lanes. The Q31 products drop guard bits before they are
+ *            summed. The biquads are direct form I, every section saturates its output.
+ *          The pole movement is computed per section in closed form for SecondOrderSections, and by
+ *          Polynomial::FindComplexZeros() for direct form denominators.
+ *          https://en.wikipedia.org/wiki/Q_(number_format)
+ */
+class FixedPoint
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr int Q15_FRACTIONAL_BITS    = 15;       //< The fractional bits of Q15.
+static constexpr int Q31_FRACTIONAL_BITS    = 31;       //< The fractional bits of Q31.
+static constexpr int MAX_INTEGER_BITS       = 8;        //< Coefficients of magnitude 2^MAX_INTEGER_BITS and more can not be quantized.
+
+/* Public Methods ************************************************************/
+
+static int GetFractionalBits(FixedPointFormat format);
+
+/**
+ * \brief Quantizes coefficients with the smallest shift that makes all of them fit.
+ *
+ * \param coefficients The coefficients.
+ * \param format The target format.
+ * \param rounding The rounding mode.
+ * \return QuantizedCoefficients The quantized coefficients in the same order.
+ */
+static QuantizedCoefficients Quantize(const std::vector<highprecision>& coefficients, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/**
+ * \brief Quantizes the coefficients of a polynomial, highest order first.
+ */
+static QuantizedCoefficients Quantize(const Polynomial& polynomial, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/**
+ * \brief Quantizes numerator and denominator of a rational function, each with its own shift.
+ */
+static QuantizedFraction Quantize(const PolynomialFraction& fraction, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/**
+ * \brief Quantizes the coefficients b0, b1, b2, a1, a2 of all sections with one common shift (see
+ *        SecondOrderSections::GetCoefficients()).
+ */
+static QuantizedCoefficients Quantize(const SecondOrderSections& sections, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/**
+ * \brief Returns the values the quantized coefficients stand for.
+ */
+static std::vector<highprecision> Dequantize(const QuantizedCoefficients& coefficients);
+
+/**
+ * \brief Converts a signal in [-1, 1) to Q15 or Q31 (rounded to nearest, saturated).
+ *
+ * \remarks Throws if a sample is NaN or infinite, since it has no fixed point value.
+ */
+static std::vector<int16_t> ToQ15(const std::vector<highprecision>& signal);
+static std::vector<int32_t> ToQ31(const std::vector<highprecision>& signal);
+
+/**
+ * \brief Converts a Q15 or Q31 signal back.
+ */
+static std::vector<highprecision> FromFixedPoint(const std::vector<int16_t>& signal);
+static std::vector<highprecision> FromFixedPoint(const std::vector<int32_t>& signal);
+
+/**
+ * \brief Filters a signal by a FIR filter, y[n] = sum h[k] x[n - k], starting at rest.
+ *
+ * \param taps The taps h[0], ..., h[N-1], quantized in the format of the signal.
+ * \param signal The input samples.
+ * \return The output samples, as many as input samples.
+ */
+static std::vector<int16_t> FilterFir(const QuantizedCoefficients& taps, const std::vector<int16_t>& signal);
+static std::vector<int32_t> FilterFir(const QuantizedCoefficients& taps, const std::vector<int32_t>& signal);
+
+/**
+ * \brief Filters a signal by a cascade of biquads, starting at rest.
+ *
+ * \param sections b0, b1, b2, a1, a2 per section, quantized in the format of the signal (see Quantize()).
+ * \param signal The input samples.
+ * \return The output samples, as many as input samples.
+ */
+static std::vector<int16_t> FilterBiquads(const QuantizedCoefficients& sections, const std::vector<int16_t>& signal);
+static std::vector<int32_t> FilterBiquads(const QuantizedCoefficients& sections, const std::vector<int32_t>& signal);
+
+/**
+ * \brief Reports how the poles of a direct form filter H(z) = B(z) / A(z) (positive powers of z) move when its
+ *        denominator is quantized. If the leading coefficient is rounded to 0, the poles the quantized denominator
+ *        lacks have moved to infinity, and the filter counts as unstable.
+ */
+static PoleMovement AnalyzePoleMovement(const PolynomialFraction& filter, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/**
+ * \brief Reports how the poles of a second order section cascade move when its coefficients are quantized.
+ */
+static PoleMovement AnalyzePoleMovement(const SecondOrderSections& sections, FixedPointFormat format, RoundingMode rounding = RoundingMode::Nearest);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+
+/* Private Methods ***********************************************************/
+static highprecision Round(highprecision value, RoundingMode rounding);
+static int64_t DotProduct(const int16_t* left, const int16_t* right, size_t length);
+static int64_t RoundShift(int64_t value, int shift);
+static int64_t Saturate(int64_t value, FixedPointFormat format);
+static void RequireFormat(const QuantizedCoefficients& coefficients, FixedPointFormat format, size_t multipleOf);
+template <typename T> static std::vector<T> FilterBiquadsGeneric(const QuantizedCoefficients& sections, const std::vector<T>& signal, FixedPointFormat format, int guardBits);
+static PoleMovement MatchPoles(const std::vector<Complex>& originalPoles, const std::vector<Complex>& quantizedPoles);
+static std::vector<Complex> GetSectionPoles(const std::vector<highprecision>& coefficients);
+
+};
+
+} // namespace vath
+
+#endif /* _FIXEDPOINT_HPP_ */
@@ -0,0 +1,143 @@
+#ifndef _INTERVAL_HPP_
+#define _INTERVAL_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+
+namespace Vath
+{
+
+using highprecision = long double;
+
+/**
+ * \brief This represents a closed interval [Lower, Upper] on the real axis. It is used for interval arithmetic, where
+ *        every operation returns an interval which is guaranteed to contain all possible results of the operation.
+ *
+ * \remarks All arithmetic operators round outwards, meaning the lower boundary is rounded towards -inf and the
+ *          upper boundary towards +inf. Thus rounding errors never make the result "forget" a possible value.
+ */
+class Interval
+{
+
+public:
+/* Public constants **********************************************************/
+/* ... */
+
+/* Public Member variables ***************************************************/
+highprecision   Lower;      //< The lower boundary of the interval.
+highprecision   Upper;      //< The upper boundary of the interval.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new Interval object. Initializes it to the degenerate interval [0, 0].
+ */
+Interval();
+
+/**
+ * \brief Construct a new degenerate Interval object which only contains the given value, e.g. [value, value].
+ *
+ * \param value The only value contained in the interval.
+ */
+Interval(highprecision value);
+
+/**
+ * \brief Construct a new Interval object.
+ *
+ * \param lower The lower boundary of the interval.
+ * \param upper The upper boundary of the interval.
+ * \remarks Throws if lower > upper.
+ */
+Interval(highprecision lower, highprecision upper);
+
+/**
+ * \brief Construct a new Interval object from another. This is the copy constructor.
+ *
+ * \param other The other Interval to copy from.
+ */
+Interval(const Interval& other);
+
+/* Public Methods ************************************************************/
+
+/* Enabling toString() *******************************************************/
+
+std::string toString() const {
+    std::stringstream ss;
+    ss << *this;
+    return ss.str();
+}
+
+// Friend declaration for operator<<
+friend std::ostream& operator<<(std::ostream& os, const Interval& interval);
+
+// Operators
+bool operator ==(const Interval& other) const;
+bool operator !=(const Interval& other) const;
+Interval& operator =(const Interval& right);
+
+// Methods
+
+/**
+ * \brief Returns the midpoint of the interval.
+ */
+highprecision GetMidpoint() const;
+
+/**
+ * \brief Returns the width (Upper - Lower) of the interval.
+ */
+highprecision GetWidth() const;
+
+/**
+ * \brief Checks whether the given value lies within the (closed) interval.
+ */
+bool Contains(highprecision value) const;
+
+/**
+ * \brief Checks whether the given interval lies completely within the interior of this interval.
+ */
+bool ContainsInInterior(const Interval& other) const;
+
+/**
+ * \brief Checks whether both intervals share at least one point.
+ */
+bool Intersects(const Interval& other) const;
+
+/**
+ * \brief Returns the intersection of two intervals.
+ *
+ * \remarks Throws if the intervals do not intersect.
+ */
+static Interval Intersect(const Interval& left, const Interval& right);
+
+/**
+ * \brief Returns the smallest interval containing both intervals.
+ */
+static Interval Hull(const Interval& left, const Interval& right);
+
+/**
+ * \brief Widens the interval by one unit in the last place in each direction (outward rounding).
+ */
+static Interval RoundOutward(highprecision lower, highprecision upper);
+
+// Overloaded standard methods
+std::string to_string() const;
+
+bool IsEqual(const Interval& other) const;
+
+};
+
+Interval operator +(const Interval& left, const Interval& right);
+Interval operator -(const Interval& left, const Interval& right);
+Interval operator *(const Interval& left, const Interval& right);
+Interval operator /(const Interval& left, const Interval& right);
+Interval operator -(const Interval& interval);
+
+} // namespace vath
+
+#endif /* _INTERVAL_HPP_ */
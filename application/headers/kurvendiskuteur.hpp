@@ -0,0 +1,175 @@
+#ifndef _KURVENDISKUTEUR_HPP_
+#define _KURVENDISKUTEUR_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <utility>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "interval.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The kind of symmetry of a curve.
+ */
+enum class SymmetryType
+{
+    Unknown,            //< Not yet examined.
+    AxialSymmetric,     //< f(-x) = f(x), symmetric to the y-axis.
+    PointSymmetric,     //< f(-x) = -f(x), symmetric to the origin.
+    NonSymmetric        //< Neither of the above.
+};
+
+/**
+ * \brief This represents a point (x, f(x)) on a curve.
+ */
+typedef struct CurvePoint
+{
+    highprecision x;
+    highprecision y;
+} CurvePoint;
+
+/**
+ * \brief This represents a section of the domain where a curve is strictly monotonic.
+ */
+typedef struct MonotonicSection
+{
+    Interval range;     //< The section, boundaries may be +-inf. The boundaries themselves are critical points or poles.
+    bool increasing;    //< True if the curve increases within the section, false if it decreases.
+} MonotonicSection;
+
+/**
+ * \brief This represents a section of the domain where a curve has the same curvature.
+ */
+typedef struct CurvatureSection
+{
+    Interval range;     //< The section, boundaries may be +-inf. The boundaries themselves are inflection points or poles.
+    bool convex;        //< True if the curve is convex (left-curved, f'' > 0), false if it is concave (f'' < 0).
+} CurvatureSection;
+
+/**
+ * \brief Performs a curve discussion ("Kurvendiskussion") of a polynomial or a rational function: zeros, poles,
+ *        y-axis intercept, symmetry, asymptote, extrema, inflection points, monotonicity and curvature.
+ *
+ * \remarks The numerators of the first and second derivative are computed once, every zero problem is solved by
+ *          square-free factorization and real root isolation (see Polynomial::FindZerosWithMultiplicity()). The
+ *          independent sub-analyses run concurrently. Extrema and inflection points are classified by the sign
+ *          changes of f' and f'', so no third derivative is needed.
+ *          This is the C++ port of old/C#/Vath/Kurvendiskuteur.cs.
+ */
+class Kurvendiskuteur
+{
+
+public:
+/* Public constants **********************************************************/
+/* ... */
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new Kurvendiskuteur object for a polynomial.
+ *
+ * \param function The polynomial to be discussed.
+ */
+Kurvendiskuteur(const Polynomial& function);
+
+/**
+ * \brief Construct a new Kurvendiskuteur object for a rational function. Common factors of numerator and
+ *        denominator are cancelled first (see Polynomial::GreatestCommonDivisor()).
+ *
+ * \param rationalFunction The rational function to be discussed.
+ */
+Kurvendiskuteur(const PolynomialFraction& rationalFunction);
+
+/* Accessors/Mutators ********************************************************/
+
+/**
+ * \brief Returns the (reduced) function which is discussed.
+ */
+PolynomialFraction GetFunction() const;
+
+std::vector<highprecision> GetZeros() const;
+std::vector<highprecision> GetPoles() const;
+std::vector<CurvePoint> GetMaxima() const;
+std::vector<CurvePoint> GetMinima() const;
+std::vector<CurvePoint> GetInflectionPoints() const;
+std::vector<MonotonicSection> GetMonotonicity() const;
+std::vector<CurvatureSection> GetCurvature() const;
+std::optional<highprecision> GetYAxisIntercept() const;
+SymmetryType GetSymmetry() const;
+
+/**
+ * \brief Returns the polynomial the curve approaches for x -> +-inf (the polynomial part of the rational function).
+ *        Polynomials have no asymptote.
+ */
+std::optional<Polynomial> GetAsymptote() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Performs the whole discussion. The independent parts are distributed on the given pool.
+ *
+ * \param pool The pool the sub-analyses run on.
+ */
+void FullDiscussion(TaskPool& pool);
+
+/**
+ * \brief Performs the whole discussion on a temporary pool with one thread per hardware thread.
+ */
+void FullDiscussion();
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+Polynomial                      Numerator;              //< u of f = u / v.
+Polynomial                      Denominator;            //< v of f = u / v. 1 for polynomials.
+bool                            IsRational;             //< Whether a rational function (with non-constant denominator) is discussed.
+
+std::vector<highprecision>      Zeros;                  //< The distinct real zeros.
+std::vector<highprecision>      Poles;                  //< The distinct real poles.
+std::vector<CurvePoint>         Maxima;                 //< The local maxima.
+std::vector<CurvePoint>         Minima;                 //< The local minima.
+std::vector<CurvePoint>         InflectionPoints;       //< The inflection points ("Wendepunkte").
+std::vector<MonotonicSection>   Monotonicity;           //< The sections of strict monotony.
+std::vector<CurvatureSection>   Curvature;              //< The sections of the same curvature.
+std::optional<highprecision>    YAxisIntercept;         //< f(0), if defined.
+SymmetryType                    Symmetry;               //< The symmetry of the curve.
+std::optional<Polynomial>       Asymptote;              //< The polynomial part of a rational function.
+
+/* Private Methods ***********************************************************/
+
+highprecision EvaluateAt(highprecision x) const;
+
+/**
+ * \brief Splits the real axis at the given zeros (of f' or f'') and at the poles, and determines the sign of the
+ *        given sign function within every part. Neighbouring parts with the same sign are merged, unless they
+ *        are separated by a pole.
+ *
+ * \param zeros The distinct zeros of the numerator of f' or f'', in ascending order.
+ * \param signAt Returns the sign of f' or f'' at a point.
+ * \param sections Receives the sections and their sign (+1 or -1). Parts with sign 0 (constant curve) are skipped.
+ * \param turningPoints Receives the zeros at which the sign changes, together with the sign on their left side.
+ */
+void SplitIntoSections(
+    const std::vector<highprecision>& zeros,
+    const std::function<int(highprecision)>& signAt,
+    std::vector<std::pair<Interval, int>>& sections,
+    std::vector<std::pair<highprecision, int>>& turningPoints
+    ) const;
+
+};
+
+} // namespace vath
+
+#endif /* _KURVENDISKUTEUR_HPP_ */
@@ -0,0 +1,155 @@
+#ifndef _LATTICEFILTER_HPP_
+#define _LATTICEFILTER_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief This represents the linear predictor of a frame: the all-pole denominator A(z) = z^p + a_1 z^(p-1) + ...
+ *        + a_p (i.e. 1 + a_1 z^-1 + ... + a_p z^-p), its reflection coefficients and the remaining prediction error.
+ */
+typedef struct LinearPredictor
+{
+    Polynomial predictor;
+    std::vector<highprecision> reflectionCoefficients;      //< k_1, ..., k_p, k_m = a_m of the predictor of order m.
+    highprecision predictionError;                          //< The error power r_0 prod (1 - k_m^2).
+} LinearPredictor;
+
+/**
+ * \brief Realizes a rational function B(z) / A(z) as lattice-ladder filter and provides the Levinson-Durbin recursion
+ *        and the conversions between direct form denominators and reflection coefficients around it.
+ *
+ * \remarks The recursions are the step-up A_m(z) = A_(m-1)(z) + k_m z^-m A_(m-1)(1 / z) and its inverse, the
+ *          step-down. A denominator has reflection coefficients with |k_m| < 1 exactly if it is schur stable, and
+ *          only then it can be realized as lattice. The Levinson-Durbin kernel works on caller owned arrays and
+ *          updates the predictor in place, pairing a_j with a_(i-j), so analysing frame after frame allocates
+ *          nothing.
+ *          The lattice runs the forward signal from stage p down to 0, f_(m-1)[n] = f_m[n] - k_m g_(m-1)[n-1], and
+ *          the backward signals g_m[n] = k_m f_(m-1)[n] + g_(m-1)[n-1] from x to g_m have the transfer functions
+ *          z^-m A_m(1 / z) / A(z). The output is the ladder sum y[n] = sum v_m g_m[n].
+ *          https://en.wikipedia.org/wiki/Levinson_recursion
+ */
+class LatticeFilter
+{
+
+public:
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new LatticeFilter object from its coefficients, starting at rest.
+ *
+ * \param reflectionCoefficients k_1, ..., k_p, all |k_m| < 1.
+ * \param ladderCoefficients v_0, ..., v_p.
+ */
+LatticeFilter(const std::vector<highprecision>& reflectionCoefficients, const std::vector<highprecision>& ladderCoefficients);
+
+/**
+ * \brief Construct a new LatticeFilter object realizing a stable, proper rational function, starting at rest.
+ *
+ * \param filter B(z) / A(z) in positive powers of z (as from Discretization), A must be schur stable.
+ */
+LatticeFilter(const PolynomialFraction& filter);
+
+/* Accessors/Mutators ********************************************************/
+std::vector<highprecision> GetReflectionCoefficients() const;
+std::vector<highprecision> GetLadderCoefficients() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Filters the next samples of the stream.
+ *
+ * \param input The next input samples.
+ * \return std::vector<highprecision> As many output samples.
+ */
+std::vector<highprecision> Process(const std::vector<highprecision>& input);
+
+/**
+ * \brief Clears the delay line, the stream starts at rest again.
+ */
+void Reset();
+
+/**
+ * \brief Computes the autocorrelation r_j = sum x[n] x[n + j] of a frame.
+ *
+ * \param frame The samples of the frame (windowed by the caller if needed).
+ * \param maxLag The largest lag j.
+ * \return std::vector<highprecision> r_0, ..., r_maxLag.
+ */
+static std::vector<highprecision> GetAutocorrelation(const std::vector<highprecision>& frame, size_t maxLag);
+
+/**
+ * \brief Computes the linear predictor of the given order from an autocorrelation sequence in O(order^2).
+ *
+ * \param autocorrelation r_0, ..., r_order, a positive definite sequence.
+ * \param order The order p of the predictor.
+ * \return LinearPredictor The predictor.
+ */
+static LinearPredictor LevinsonDurbin(const std::vector<highprecision>& autocorrelation, size_t order);
+
+/**
+ * \brief The Levinson-Durbin recursion on caller owned arrays, which allocates nothing.
+ *
+ * \param autocorrelation r_0, ..., r_order.
+ * \param order The order p of the predictor.
+ * \param predictor Receives 1, a_1, ..., a_p (order + 1 values).
+ * \param reflectionCoefficients Receives k_1, ..., k_p (order values).
+ * \return highprecision The prediction error.
+ */
+static highprecision LevinsonDurbin(const highprecision* autocorrelation, size_t order, highprecision* predictor, highprecision* reflectionCoefficients);
+
+/**
+ * \brief Computes the linear predictors of many frames in parallel.
+ *
+ * \param autocorrelations The autocorrelation sequences, one per frame.
+ * \param order The order of the predictors.
+ * \param pool The pool on which the frames are processed.
+ * \return std::vector<LinearPredictor> One predictor per frame, in the same order.
+ */
+static std::vector<LinearPredictor> LevinsonDurbin(const std::vector<std::vector<highprecision>>& autocorrelations, size_t order, TaskPool& pool);
+
+/**
+ * \brief Computes the linear predictors of many frames on a temporary pool.
+ */
+static std::vector<LinearPredictor> LevinsonDurbin(const std::vector<std::vector<highprecision>>& autocorrelations, size_t order);
+
+/**
+ * \brief Computes the reflection coefficients of a denominator by the step-down recursion.
+ *
+ * \param denominator A(z), normalized to a monic polynomial first.
+ * \return std::vector<highprecision> k_1, ..., k_p.
+ */
+static std::vector<highprecision> ToReflectionCoefficients(const Polynomial& denominator);
+
+/**
+ * \brief Computes the monic denominator of the given reflection coefficients by the step-up recursion.
+ */
+static Polynomial FromReflectionCoefficients(const std::vector<highprecision>& reflectionCoefficients);
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+std::vector<highprecision>  Reflection;     //< k_1, ..., k_p.
+std::vector<highprecision>  Ladder;         //< v_0, ..., v_p.
+std::vector<highprecision>  Backward;       //< g_m[n-1], m = 0, ..., p.
+
+/* Private Methods ***********************************************************/
+static std::vector<std::vector<highprecision>> StepDown(const CoefficientList& denominator);
+
+};
+
+} // namespace vath
+
+#endif /* _LATTICEFILTER_HPP_ */
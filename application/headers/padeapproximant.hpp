@@ -0,0 +1,99 @@
+#ifndef _PADEAPPROXIMANT_HPP_
+#define _PADEAPPROXIMANT_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "powerseries.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief This represents the orders [L/M] of a Padé approximant, the degrees of its numerator and denominator.
+ */
+typedef struct PadeOrder
+{
+    size_t numeratorOrder;      //< L
+    size_t denominatorOrder;    //< M
+} PadeOrder;
+
+/**
+ * \brief Constructs Padé approximants P(x) / Q(x) of a power series f, i.e. the rational functions with deg P <= L,
+ *        deg Q <= M and Q(0) = 1 which agree with f up to x^(L+M).
+ *
+ * \remarks Q f - P = O(x^(L+M+1)) determines the denominator by the M equations
+ *          sum_j c_(L+i-j) q_j = -c_(L+i), i = 1..M, whose matrix is toeplitz. These are solved by the nonsymmetric
+ *          Levinson recursion in O(M^2) instead of O(M^3) by elimination. Its step m solves exactly the system of
+ *          [L/m], so a batch computes every denominator order of one L in a single recursion. The numerator is the
+ *          series of Q f cut off after x^L.
+ *          The recursion needs all leading minors to be regular, which fails for degenerate (non-normal) entries of
+ *          the Padé table, e.g. [1/1] of an even function like cos, whose c_1 vanishes. Those throw.
+ *          https://en.wikipedia.org/wiki/Pad%C3%A9_approximant
+ *          https://en.wikipedia.org/wiki/Levinson_recursion
+ */
+class PadeApproximant
+{
+
+public:
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Computes the [L/M] Padé approximant of a series.
+ *
+ * \param series The series f, with a precision of at least L + M + 1.
+ * \param numeratorOrder L.
+ * \param denominatorOrder M.
+ * \return PolynomialFraction P(x) / Q(x) with Q(0) = 1.
+ */
+static PolynomialFraction Approximate(const PowerSeries& series, size_t numeratorOrder, size_t denominatorOrder);
+
+/**
+ * \brief Computes many Padé approximants of the same series in parallel. Orders with the same L share one
+ *        Levinson recursion.
+ *
+ * \param series The series f, with a precision of at least L + M + 1 for every order.
+ * \param orders The orders [L/M].
+ * \param pool The pool the numerator orders are distributed on.
+ * \return std::vector<PolynomialFraction> One approximant per order, in the same order.
+ * \remarks The shared recursion runs up to the largest M of its L. If one of its leading blocks is singular, the
+ *          whole batch throws, even for the orders of that L with a smaller M, which Approximate(series, L, M) could
+ *          compute on their own.
+ */
+static std::vector<PolynomialFraction> Approximate(const PowerSeries& series, const std::vector<PadeOrder>& orders, TaskPool& pool);
+
+/**
+ * \brief Computes many Padé approximants of the same series on a temporary pool.
+ */
+static std::vector<PolynomialFraction> Approximate(const PowerSeries& series, const std::vector<PadeOrder>& orders);
+
+/**
+ * \brief Solves T x = y for a toeplitz matrix T_ij = t_(i-j) by the nonsymmetric Levinson recursion in O(n^2).
+ *
+ * \param column The first column t_0, t_1, ..., t_(n-1).
+ * \param row The first row t_0, t_-1, ..., t_-(n-1), row[0] has to equal column[0].
+ * \param rightSide y.
+ * \return std::vector<highprecision> x.
+ */
+static std::vector<highprecision> SolveToeplitz(const std::vector<highprecision>& column, const std::vector<highprecision>& row, const std::vector<highprecision>& rightSide);
+
+/*****************************************************************************/
+private:
+
+/* Private Methods ***********************************************************/
+static std::vector<std::vector<highprecision>> Levinson(const std::vector<highprecision>& column, const std::vector<highprecision>& row, const std::vector<highprecision>& rightSide);
+static std::vector<std::vector<highprecision>> GetDenominators(const PowerSeries& series, size_t numeratorOrder, size_t maxDenominatorOrder);
+static PolynomialFraction GetApproximant(const PowerSeries& series, size_t numeratorOrder, const std::vector<highprecision>& denominator);
+
+};
+
+} // namespace vath
+
+#endif /* _PADEAPPROXIMANT_HPP_ */
@@ -0,0 +1,120 @@
+#ifndef _PARTIALFRACTION_HPP_
+#define _PARTIALFRACTION_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief This represents one term residue / (x - pole)^power of a partial fraction expansion.
+ */
+typedef struct PartialFractionTerm
+{
+    std::complex<highprecision> pole;
+    std::complex<highprecision> residue;
+    int power;          //< 1 for a simple pole, up to the multiplicity of the pole.
+} PartialFractionTerm;
+
+/**
+ * \brief This represents a rational function as direct(x) + sum residue_i / (x - pole_i)^power_i.
+ */
+typedef struct PartialFractionExpansion
+{
+    std::vector<PartialFractionTerm> terms;
+    Polynomial direct;  //< The polynomial part, 0 for strictly proper fractions.
+} PartialFractionExpansion;
+
+/**
+ * \brief Expands PolynomialFractions into partial fractions (poles, residues and a direct term, like MATLAB's residue)
+ *        and combines them again.
+ *
+ * \remarks The direct term and the proper remainder are the quotient and the Rest of operator/. The poles are found
+ *          per square-free factor of the denominator (see Polynomial::SquareFreeFactorization()), so the multiplicity
+ *          of a pole is exact and its position is as accurate as that of a simple zero. The residues of a pole p of
+ *          multiplicity m are the first m coefficients of the taylor series of (x - p)^m N(x) / D(x) around p, which
+ *          is multiplied together from the taylor series of N and of one factor 1 / (x - q) per other pole q.
+ *          Non-real poles of real fractions come in exact conjugate pairs with conjugate residues, the residues of
+ *          real poles are real.
+ *          https://en.wikipedia.org/wiki/Partial_fraction_decomposition
+ */
+class PartialFraction
+{
+
+public:
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Expands a rational function into partial fractions.
+ *
+ * \param fraction The rational function N(x) / D(x), D must not be 0. N and D should be coprime, common zeros show
+ *                 up as poles with vanishing residues.
+ * \return PartialFractionExpansion The terms, sorted by pole (by real part and then by imaginary part) and by
+ *         ascending power, and the direct term.
+ */
+static PartialFractionExpansion Expand(const PolynomialFraction& fraction);
+
+/**
+ * \brief Expands many rational functions in parallel.
+ *
+ * \param fractions The rational functions.
+ * \param pool The pool the fractions are distributed on.
+ * \return std::vector<PartialFractionExpansion> One expansion per fraction, in the same order.
+ */
+static std::vector<PartialFractionExpansion> Expand(const std::vector<PolynomialFraction>& fractions, TaskPool& pool);
+
+/**
+ * \brief Expands many rational functions in parallel on a temporary pool.
+ */
+static std::vector<PartialFractionExpansion> Expand(const std::vector<PolynomialFraction>& fractions);
+
+/**
+ * \brief Combines partial fractions to a rational function, the inverse of Expand().
+ *
+ * \param expansion The terms and the direct term. Non-real poles have to come in conjugate pairs with conjugate
+ *                  residues, the imaginary parts of the result are dropped.
+ * \return PolynomialFraction N(x) / D(x) with a monic denominator. A pole occurs in D with the highest power of its
+ *         terms.
+ */
+static PolynomialFraction Combine(const PartialFractionExpansion& expansion);
+
+/**
+ * \brief Evaluates the inverse laplace transform h(t) = sum residue_i t^(power_i - 1) / (power_i - 1)! e^(pole_i t)
+ *        of the terms, i.e. the impulse response of a transfer function H(s) in closed form.
+ *
+ * \param expansion The expansion of H(s). The direct term (impulses at t = 0) is ignored.
+ * \param t The time, h(t) = 0 for t < 0.
+ */
+static highprecision GetImpulseResponse(const PartialFractionExpansion& expansion, highprecision t);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+
+struct PoleWithMultiplicity
+{
+    Complex Pole;
+    int     Multiplicity;
+};
+
+/* Private Methods ***********************************************************/
+static std::vector<Complex> GetTaylorCoefficients(const CoefficientList& coefficients, Complex x, int count);
+static std::vector<Complex> MultiplyTruncated(const std::vector<Complex>& left, const std::vector<Complex>& right);
+
+};
+
+} // namespace vath
+
+#endif /* _PARTIALFRACTION_HPP_ */
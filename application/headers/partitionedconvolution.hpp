@@ -0,0 +1,138 @@
+#ifndef _PARTITIONEDCONVOLUTION_HPP_
+#define _PARTITIONEDCONVOLUTION_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <memory>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Applies a long FIR filter to a stream by uniformly partitioned overlap-save FFT convolution. The output is
+ *        the convolution with the taps, delayed by one block (see GetLatency()).
+ *
+ * \remarks The taps are split into partitions of one block each, whose spectra (of length 2 * block size) are
+ *          computed once. Every complete input block is transformed once and kept in a frequency domain delay line,
+ *          the output block is the inverse transform of sum_p H_p X_(current - p), of which the second half is
+ *          valid. This costs O(log B + N / B) per sample instead of O(N) for the direct form, a larger block size B
+ *          trades latency for throughput.
+ *          The real transforms of length 2B run as complex transforms of length B with cached twiddle factors,
+ *          only the B + 1 non-negative frequencies are stored. The spectra are held in double precision and split
+ *          into real and imaginary parts, so the multiply-accumulate over the partitions vectorizes.
+ *          Copies share the kernel spectra, so one convolution per channel costs only its own delay line.
+ *          https://en.wikipedia.org/wiki/Overlap%E2%80%93save_method
+ */
+class PartitionedConvolution
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t DEFAULT_BLOCK_SIZE = 256;       //< The default block size, i.e. the default latency.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new PartitionedConvolution object.
+ *
+ * \param filter The transfer function as polynomial in z^-1, the coefficient of z^-n is h[n] (see
+ *               FirDesign::ToPolynomial()).
+ * \param blockSize The number of samples per block, a power of two.
+ */
+PartitionedConvolution(const Polynomial& filter, size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+/**
+ * \brief Construct a new PartitionedConvolution object.
+ *
+ * \param taps The taps h[0], ..., h[N-1].
+ * \param blockSize The number of samples per block, a power of two.
+ */
+PartitionedConvolution(const std::vector<highprecision>& taps, size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+/* Accessors/Mutators ********************************************************/
+size_t GetBlockSize() const;
+size_t GetPartitionCount() const;
+
+/**
+ * \brief Returns the delay of the output in samples, which equals the block size.
+ */
+size_t GetLatency() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Filters the next samples of the stream, the samples may come in chunks of any size.
+ *
+ * \param input The next input samples.
+ * \return std::vector<highprecision> As many output samples, y[n] = sum h[k] x[n - latency - k].
+ */
+std::vector<highprecision> Process(const std::vector<highprecision>& input);
+
+/**
+ * \brief Clears the delay line, the stream starts at rest again.
+ */
+void Reset();
+
+/**
+ * \brief Filters the next samples of several streams (channels) in parallel.
+ *
+ * \param channels One convolution per stream, e.g. copies of the same one.
+ * \param inputs The next input samples per stream.
+ * \param pool The pool on which the streams are processed.
+ * \return std::vector<std::vector<highprecision>> The output samples per stream.
+ */
+static std::vector<std::vector<highprecision>> Process(std::vector<PartitionedConvolution>& channels, const std::vector<std::vector<highprecision>>& inputs, TaskPool& pool);
+
+/**
+ * \brief Filters the next samples of several streams on a temporary pool.
+ */
+static std::vector<std::vector<highprecision>> Process(std::vector<PartitionedConvolution>& channels, const std::vector<std::vector<highprecision>>& inputs);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<double> Complex;
+
+typedef struct Kernel
+{
+    size_t                  BlockSize;
+    size_t                  PartitionCount;
+    std::vector<double>     SpectraReal;                //< B + 1 bins per partition, divided by B for the inverse transform.
+    std::vector<double>     SpectraImaginary;
+    std::vector<Complex>    ForwardTwiddleFactors;      //< Of the complex transforms of length B.
+    std::vector<Complex>    InverseTwiddleFactors;
+    std::vector<Complex>    RealTwiddleFactors;         //< e^(-2 pi i k / 2B), k <= B, which split even and odd samples.
+} Kernel;
+
+/* Private Member variables **************************************************/
+std::shared_ptr<const Kernel>   Filter;                 //< The partitioned kernel, shared by copies.
+std::vector<double>             Window;                 //< The previous and the current input block.
+std::vector<double>             Output;                 //< The output block which is emitted while the next block is read.
+std::vector<double>             DelayLineReal;          //< The spectra of the last input blocks, B + 1 bins each.
+std::vector<double>             DelayLineImaginary;
+size_t                          Head;                   //< The partition index of the newest spectrum in the delay line.
+size_t                          Position;               //< The position within the current block.
+std::vector<double>             Accumulator;            //< The output spectrum, B + 1 real parts followed by B + 1 imaginary parts.
+std::vector<Complex>            Buffer;                 //< Work space of the transforms.
+
+/* Private Methods ***********************************************************/
+void Initialize(const std::vector<highprecision>& taps, size_t blockSize);
+void ProcessBlock();
+static void TransformReal(const Kernel& kernel, const double* samples, std::vector<Complex>& buffer, double* real, double* imaginary);
+static void TransformRealInverse(const Kernel& kernel, const double* real, const double* imaginary, std::vector<Complex>& buffer, double* secondHalf);
+
+};
+
+} // namespace vath
+
+#endif /* _PARTITIONEDCONVOLUTION_HPP_ */
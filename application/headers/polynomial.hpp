@@ -13,17 +13,31 @@
 #include <algorithm>
 #include <limits>
 #include <deque>
+#include <complex>
 
 namespace Vath
 {
 
 class Monomial; 
+class Interval;
 struct PolynomialFraction;
+struct SquareFreeFactor;
+struct MultipleZero;
+struct RealFactorization;
 
 using highprecision = long double;
 using Terms = std::deque<Monomial>;
 using CoefficientList = std::deque<highprecision>;
 
+/**
+ * \brief The engines which find all complex zeros of a polynomial.
+ */
+enum class ZeroFindingMethod
+{
+    Aberth,     //< Simultaneous Aberth-Ehrlich iteration in complex arithmetic.
+    Bairstow    //< Real quadratic factors by Bairstow's method and deflation, in real arithmetic only.
+};
+
 /**
  * \brief 
  * 
@@ -41,6 +55,16 @@ static constexpr highprecision GUESS_ZERO_INTERVAL_LOWER_BOUNDARY  = -500;
 static constexpr highprecision GUESS_ZERO_INTERVAL_INTERATION_STEP = 0.1;      //< This is the step size when guessing zeros.
 static constexpr highprecision GUESS_ZERO_ERROR_MARGIN             = 1E-13;    //< This is the step size when guessing zeros.
 static constexpr highprecision GUESS_ZERO_MAX_ITERATIONS           = 1000;     //< The maximum number of iterations that shall be performed when approximating a zero.
+static constexpr highprecision CERTIFIED_ZERO_MIN_INTERVAL_WIDTH   = 1E-15;    //< Relative width below which an interval, which could not be certified, is not bisected any further.
+static constexpr int           CERTIFIED_ZERO_MAX_CONTRACTIONS     = 64;       //< The maximum number of interval newton steps used to tighten a certified enclosure.
+static constexpr highprecision GCD_TOLERANCE                       = 1E-12;    //< Relative magnitude below which a remainder of the euclidean algorithm counts as 0.
+static constexpr int           TAYLOR_SHIFT_FAST_MIN_ORDER         = 64;       //< From this order on, taylor shifts are computed by divide and conquer instead of the quadratic horner scheme.
+static constexpr int           COMPOSITION_DIRECT_MAX_ORDER        = 8;        //< Up to this order of the outer polynomial, compositions are computed by the horner scheme.
+static constexpr int           COMPLEX_ZERO_MAX_ITERATIONS         = 500;      //< The maximum number of simultaneous iterations when finding all complex zeros.
+static constexpr highprecision CONJUGATE_TOLERANCE                 = 1E-9;     //< Relative distance below which two non-real zeros count as conjugate pair.
+static constexpr int           BAIRSTOW_MAX_ITERATIONS             = 200;      //< The maximum number of Bairstow steps from one starting factor.
+static constexpr int           BAIRSTOW_MAX_SEEDS                  = 8;        //< The number of starting factors tried per quadratic factor before falling back to the Aberth method.
+static constexpr int           GRAEFFE_SQUARINGS                   = 5;        //< The default number of Graeffe root squarings when estimating the magnitudes of zeros.
 
 /* Constructors **************************************************************/
 
@@ -85,6 +109,11 @@ Terms GetRest() const;
 int GetOrder() const;
 int GetRestOrder() const;
 
+/**
+ * \brief Returns the coefficients of the polynomial, starting with the highest order (see CoefficientList ctor).
+ */
+CoefficientList GetCoefficients() const;
+
 
 /* Enabling toString() *******************************************************/
 
@@ -160,6 +189,12 @@ void Differentiate();
 static Polynomial Differentiate(const Polynomial& p);
 
 highprecision EvaluateAt(highprecision x) const;       
+
+/**
+ * \brief Evaluates the polynomial on an interval. The returned interval is guaranteed to contain the value of the 
+ *        polynomial for every x in the given interval (see EvaluateAt(Polynomial, Interval)).
+ */
+Interval EvaluateAt(const Interval& x) const;
 std::vector<highprecision> Zeros() const;
 std::vector<highprecision> Decompose() const;
 highprecision GetArea(highprecision lowerLimit, highprecision upperLimit) const;
@@ -175,6 +210,105 @@ int Count() const;
 // Static Methods
 
 static highprecision EvaluateAt(Polynomial function, highprecision x);       
+
+/**
+ * \brief Evaluates a polynomial on an interval by using the centered (mean value) form f(c) + f'(X) * (X - c), 
+ *        where c is the midpoint of X. The result is intersected with the naive interval horner evaluation.
+ * 
+ * \param function The polynomial to be evaluated.
+ * \param x The interval on which the polynomial shall be evaluated.
+ * \return Interval An interval (rounded outwards) which contains every value the polynomial takes on x.
+ */
+static Interval EvaluateAt(Polynomial function, const Interval& x);
+
+/**
+ * \brief Returns the cauchy bound of the polynomial, meaning every (complex) zero z satisfies |z| < bound.
+ * 
+ * \param function The polynomial which' zeros shall be bounded.
+ * \return highprecision The bound 1 + max(|a_i / a_n|).
+ */
+static highprecision GetRootBound(const Polynomial& function);
+
+/**
+ * \brief Constructs the polynomial of lowest degree passing through the given points by newton's divided differences.
+ *
+ * \param x The x values of the points, which have to be distinct.
+ * \param y The y values of the points.
+ * \return Polynomial The interpolating polynomial of degree x.size() - 1 (at most).
+ * \remarks https://en.wikipedia.org/wiki/Newton_polynomial
+ */
+static Polynomial Interpolate(const std::vector<highprecision>& x, const std::vector<highprecision>& y);
+
+/**
+ * \brief Fits a polynomial of the given degree to the points by linear least squares (see PolynomialFitter, which
+ *        should be used directly to fit many datasets on the same x values).
+ *
+ * \param x The x values of the points. At least degree + 1 of them must be distinct.
+ * \param y The y values of the points.
+ * \param degree The degree of the fitted polynomial.
+ * \return Polynomial The polynomial minimizing the sum of the squared residuals.
+ */
+static Polynomial Fit(const std::vector<highprecision>& x, const std::vector<highprecision>& y, int degree);
+
+/**
+ * \brief Substitutes x + shift for x, i.e. returns p(x + shift).
+ *
+ * \param function The polynomial p.
+ * \param shift The shift.
+ * \return Polynomial p(x + shift), of the same order.
+ * \remarks See TaylorShiftCoefficients().
+ */
+static Polynomial TaylorShift(const Polynomial& function, highprecision shift);
+
+/**
+ * \brief Shifts coefficients (highest order first) by the given value, see TaylorShift().
+ *
+ * \remarks Below TAYLOR_SHIFT_FAST_MIN_ORDER this is the horner scheme in O(n^2), which is exact for small integer
+ *          shifts. From there on, it is the divide and conquer composition with x + shift (see Compose()), which 
+ *          takes O(n log^2 n). The single convolution with factorials (O(n log n)) is not used on purpose: its
+ *          terms span hundreds of orders of magnitude, so its error swamps every but the largest coefficients.
+ */
+static CoefficientList TaylorShiftCoefficients(const CoefficientList& coefficients, highprecision shift);
+
+/**
+ * \brief Substitutes factor * x for x, i.e. returns p(factor * x), in O(n).
+ */
+static Polynomial Scale(const Polynomial& function, highprecision factor);
+
+/**
+ * \brief Composes two polynomials, i.e. returns outer(inner(x)), of order outer.GetOrder() * inner.GetOrder().
+ *
+ * \param outer The polynomial into which is substituted.
+ * \param inner The polynomial which is substituted for x.
+ * \return Polynomial outer(inner(x)).
+ * \remarks A linear inner polynomial a x + b is handled by a taylor shift and a scaling. Otherwise the outer 
+ *          polynomial is split into halves p = p_low + x^m p_high, so that p(q) = p_low(q) + q^m p_high(q), with the 
+ *          powers q^m precomputed by repeated squaring. Every product is a FFT convolution.
+ */
+static Polynomial Compose(const Polynomial& outer, const Polynomial& inner);
+
+/**
+ * \brief Isolates all real zeros of the polynomial in disjoint intervals, each of which is guaranteed to contain exactly one zero.
+ *        The search interval is given by the root bound of the polynomial (see GetRootBound()).
+ * 
+ * \param function The polynomial which' zeros shall be enclosed.
+ * \return std::vector<Interval> Disjoint enclosures in ascending order.
+ * \remarks The uniqueness is certified by the interval newton operator. Multiple zeros (e.g. (x-1)^2) can therefore 
+ *          not be certified, in which case an exception is thrown.
+ */
+static std::vector<Interval> FindZeroEnclosures(Polynomial function);
+
+/**
+ * \brief Isolates all real zeros of the polynomial within [lowerLimit, upperLimit] in disjoint intervals, each of which 
+ *        is guaranteed to contain exactly one zero.
+ * 
+ * \param function The polynomial which' zeros shall be enclosed.
+ * \param lowerLimit The lower limit of the search interval.
+ * \param upperLimit The upper limit of the search interval.
+ * \return std::vector<Interval> Disjoint enclosures in ascending order.
+ * \remarks Zeros lying exactly on the limits can not be certified and lead to an exception.
+ */
+static std::vector<Interval> FindZeroEnclosures(Polynomial function, highprecision lowerLimit, highprecision upperLimit);
 static std::vector<highprecision> FindZeros(Polynomial function);
 static std::vector<highprecision> Decompose(Polynomial function);
 static highprecision GetArea(Polynomial function, highprecision lowerLimit, highprecision upperLimit);
@@ -182,6 +316,114 @@ static highprecision GetAreaNumerically(Polynomial function, highprecision lower
 static std::vector<highprecision> FindZerosOfQuadraticTerms(Polynomial polynomialOfOrder2);
 static highprecision FindZeroOfLinearTerm(Polynomial linearPolynomial);
 
+/**
+ * \brief Finds all real zeros of a polynomial together with their multiplicity. The polynomial is split into 
+ *        square-free factors first (see SquareFreeFactorization()), the zeros of each factor are then isolated 
+ *        and refined on their own (see RealRootIsolator).
+ * 
+ * \param function The polynomial which' zeros shall be found.
+ * \return std::vector<MultipleZero> The distinct real zeros in ascending order and their multiplicity.
+ */
+static std::vector<MultipleZero> FindZerosWithMultiplicity(Polynomial function);
+
+/**
+ * \brief Finds all (complex) zeros of a polynomial simultaneously by the Aberth-Ehrlich method.
+ *
+ * \param function The polynomial which' zeros shall be found. Must not be the zero polynomial.
+ * \return std::vector<std::complex<highprecision>> GetOrder() zeros, repeated according to their multiplicity, sorted
+ *         by real part and then by imaginary part. Zeros whose imaginary part vanishes within the achieved accuracy
+ *         are returned as real numbers. Non-real zeros which are conjugate within CONJUGATE_TOLERANCE are made exact
+ *         conjugate pairs, all others are returned as found.
+ * \remarks Zeros at 0 (vanishing lowest coefficients) are split off exactly. Multiple zeros converge only linearly
+ *          and are less accurate (about 1/multiplicity of the significant digits).
+ *          https://en.wikipedia.org/wiki/Aberth_method
+ */
+static std::vector<std::complex<highprecision>> FindComplexZeros(const Polynomial& function);
+
+/**
+ * \brief Finds all (complex) zeros of a polynomial with the given engine. The result has the same form for every
+ *        engine, see FindComplexZeros(const Polynomial&).
+ *
+ * \param function The polynomial which' zeros shall be found. Must not be the zero polynomial.
+ * \param method The engine.
+ */
+static std::vector<std::complex<highprecision>> FindComplexZeros(const Polynomial& function, ZeroFindingMethod method);
+
+/**
+ * \brief Factors a polynomial into real quadratic and linear factors by Bairstow's method.
+ *
+ * \param function The polynomial to be factored. Must not be the zero polynomial.
+ * \return RealFactorization gain * prod (x^2 + p x + q) * prod (x - r).
+ * \remarks Each step divides twice by the current factor x^2 + u x + v and corrects u and v by Newton's method on
+ *          the remainder, so the inner loop is two real recurrences and no complex number is involved. The factors
+ *          are seeded from the Graeffe estimates of the smallest remaining magnitudes, deflated off highest order
+ *          first and finally polished on the original polynomial. A factor which does not converge from any seed
+ *          is taken from the Aberth zeros of the remaining polynomial instead.
+ *          Zeros at 0 are split off exactly, multiple zeros converge only linearly.
+ *          https://en.wikipedia.org/wiki/Bairstow%27s_method
+ */
+static RealFactorization FindQuadraticFactors(const Polynomial& function);
+
+/**
+ * \brief Estimates the magnitudes of all zeros by Graeffe's root squaring, e.g. to seed an iterative solver.
+ *
+ * \param function The polynomial. Must not be the zero polynomial.
+ * \param squarings The number k of squarings, the estimates are accurate up to a factor of about n^(1 / 2^k).
+ * \return std::vector<highprecision> GetOrder() magnitudes in ascending order.
+ * \remarks Every squaring maps the zeros z to z^2 in O(n^2) real operations. Once the zeros are well separated,
+ *          the slopes of the upper convex hull of log |a_i| (the newton polygon) yield their magnitudes, zeros of
+ *          (nearly) equal magnitude such as conjugate pairs share one edge of the polygon.
+ *          https://en.wikipedia.org/wiki/Graeffe%27s_method
+ */
+static std::vector<highprecision> EstimateZeroMagnitudes(const Polynomial& function, int squarings = Polynomial::GRAEFFE_SQUARINGS);
+
+/**
+ * \brief Constructs the polynomial gain * prod (x - zero_i).
+ *
+ * \param zeros The zeros. Non-real zeros have to come in conjugate pairs, the imaginary parts of the product are
+ *              dropped.
+ * \param gain The leading coefficient.
+ * \return Polynomial The polynomial of order zeros.size().
+ */
+static Polynomial FromZeros(const std::vector<std::complex<highprecision>>& zeros, highprecision gain = 1);
+
+/**
+ * \brief Computes the greatest common divisor of two polynomials by the euclidean algorithm. Remainders whose 
+ *        coefficients are all below GCD_TOLERANCE (relative to the divisor) count as 0.
+ * 
+ * \param left The first polynomial.
+ * \param right The second polynomial.
+ * \return Polynomial The monic greatest common divisor.
+ */
+static Polynomial GreatestCommonDivisor(const Polynomial& left, const Polynomial& right);
+
+/**
+ * \brief Splits a polynomial into square-free factors by Yun's algorithm, i.e. p = c * f1^1 * f2^2 * f3^3 ..., 
+ *        where every fi is monic, square-free and the fi are pairwise coprime. Thus every zero of fi is a zero 
+ *        of p with multiplicity i.
+ * 
+ * \param function The polynomial to be factorized.
+ * \return std::vector<SquareFreeFactor> The non-constant factors fi and their multiplicity i.
+ * \remarks The greatest common divisors are computed with GCD_TOLERANCE, so distinct zeros closer than about
+ *          sqrt(GCD_TOLERANCE) may be merged into one multiple zero, see VerifySquareFreeFactorization().
+ *          https://en.wikipedia.org/wiki/Square-free_polynomial#Yun's_algorithm
+ */
+static std::vector<SquareFreeFactor> SquareFreeFactorization(const Polynomial& function);
+
+/**
+ * \brief Checks a square-free factorization against the polynomial it was computed from. The orders have to add up
+ *        and every zero of a factor with multiplicity m has to be a zero of p, p', ..., p^(m-1) up to the rounding
+ *        error of their evaluation.
+ * 
+ * \param function The polynomial p.
+ * \param factors Its square-free factors, see SquareFreeFactorization().
+ * \return bool False if the factorization merged distinct zeros (or is inconsistent otherwise).
+ * \remarks Each zero of a factor is refined by newton steps on p^(m-1) first, where a true m-fold zero is simple.
+ *          The residual of a merged cluster of zeros at distance d is about d^2 times p'' and thus far above the
+ *          rounding error unless d is below sqrt(epsilon), where the zeros can not be told apart anyway.
+ */
+static bool VerifySquareFreeFactorization(const Polynomial& function, const std::vector<SquareFreeFactor>& factors);
+
 /**
  * \brief Approximates a zero from a starting point (supposedZero) by utilizing the Halleys Method (third order Newton method).
  * 
@@ -202,6 +444,27 @@ static int GetLowestOrderOfPolynomialTerms(const Terms monomials);
 static Terms CoefficientList2Terms(const CoefficientList coefficients);
 static CoefficientList Terms2CoefficientList(const Terms terms);
 
+/**
+ * \brief Divides two coefficient lists (highest order first) by long division, such that 
+ *        numerator = quotient * denominator + remainder.
+ * 
+ * \param numerator The coefficients of the dividend.
+ * \param denominator The coefficients of the divisor. Its first coefficient must not be 0.
+ * \param quotient Receives the coefficients of the quotient.
+ * \param remainder Receives the coefficients of the remainder, with leading zeros removed (at least one coefficient remains).
+ * \remarks Unlike operator/, this works directly on the coefficients and never fails for a non-zero denominator.
+ */
+static void DivideCoefficients(const CoefficientList& numerator, const CoefficientList& denominator, CoefficientList& quotient, CoefficientList& remainder);
+
+/**
+ * \brief Removes leading coefficients whose magnitude does not exceed the tolerance (at least one coefficient remains).
+ * 
+ * \param coefficients The coefficients (highest order first) to be trimmed.
+ * \param tolerance Coefficients with |c| <= tolerance count as zero.
+ * \return CoefficientList The trimmed coefficients.
+ */
+static CoefficientList TrimCoefficients(const CoefficientList& coefficients, highprecision tolerance);
+
 
 /**
  * \brief Takes in a list of terms, combines terms with the same exponent and sorts them by exponent.
@@ -241,6 +504,23 @@ int RestOrder;     //< This is the order/degree of the rest of the polynomial.
 
 /* Private Methods ************************************************************/
 
+/**
+ * \brief Evaluates a coefficient list on an interval with the (naive) interval horner schema.
+ */
+static Interval EvaluateCoefficientsAt(const CoefficientList& coefficients, const Interval& x);
+
+/**
+ * \brief Composes two coefficient lists (lowest order first!) by divide and conquer, see Compose().
+ */
+static std::vector<highprecision> ComposeCoefficients(const std::vector<highprecision>& outer, const std::vector<highprecision>& inner);
+
+/**
+ * \brief Runs Bairstow's method on a coefficient list (lowest order first!) from the factor x^2 + u x + v.
+ *
+ * \return bool Whether the factor converged, u and v then hold it.
+ */
+static bool IterateBairstow(const std::vector<highprecision>& coefficients, highprecision& u, highprecision& v, int maxIterations);
+
 };
 
 /**
@@ -254,6 +534,48 @@ typedef struct PolynomialFraction
     Polynomial denominator;
 } PolynomialFraction;
 
+/**
+ * \brief This represents a square-free factor of a polynomial and how often it divides the polynomial.
+ * 
+ */
+typedef struct SquareFreeFactor
+{
+    Polynomial factor;
+    int multiplicity;
+} SquareFreeFactor;
+
+/**
+ * \brief This represents a zero of a polynomial together with its multiplicity.
+ * 
+ */
+typedef struct MultipleZero
+{
+    highprecision value;
+    int multiplicity;
+} MultipleZero;
+
+/**
+ * \brief This represents a real quadratic factor x^2 + p x + q.
+ *
+ */
+typedef struct QuadraticFactor
+{
+    highprecision linearCoefficient;    //< p
+    highprecision constantCoefficient;  //< q
+} QuadraticFactor;
+
+/**
+ * \brief This represents the factorization of a real polynomial into real factors,
+ *        gain * prod (x^2 + p_i x + q_i) * prod (x - r_j).
+ *
+ */
+typedef struct RealFactorization
+{
+    highprecision gain;
+    std::vector<QuadraticFactor> quadraticFactors;
+    std::vector<highprecision> realZeros;           //< The zeros r_j of the linear factors.
+} RealFactorization;
+
 // Operators for this class
 
 Polynomial operator +(const Polynomial& left, const Monomial& right);       // tested -------------------
@@ -0,0 +1,92 @@
+#ifndef _POLYNOMIALFITTER_HPP_
+#define _POLYNOMIALFITTER_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Fits polynomials of a fixed degree to samples taken on a fixed x grid by linear least squares.
+ *        The grid is factorized once in the constructor, afterwards every dataset (y values) only costs
+ *        O(m * n) for m samples and degree n - 1, which makes fitting many datasets on the same grid cheap.
+ *
+ * \remarks The x values are mapped to [-1, 1] and the system is set up in the chebyshev basis instead of the
+ *          monomial one, which keeps it well conditioned (a plain vandermonde matrix is not). It is solved by a
+ *          householder QR decomposition, the normal equations are never formed. The chebyshev coefficients are
+ *          converted to monomial coefficients at the very end.
+ *          https://en.wikipedia.org/wiki/Polynomial_regression
+ */
+class PolynomialFitter
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr highprecision RANK_TOLERANCE = 1E-13;     //< Relative magnitude of a diagonal element of R below which the grid counts as too degenerate for the degree.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new PolynomialFitter object and factorizes the system of the grid.
+ *
+ * \param x The x values of the samples. At least degree + 1 of them must be distinct.
+ * \param degree The degree of the fitted polynomials. If it is x.size() - 1, the polynomials interpolate the samples.
+ */
+PolynomialFitter(const std::vector<highprecision>& x, int degree);
+
+/* Accessors/Mutators ********************************************************/
+int GetDegree() const;
+size_t GetNumberOfSamples() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Fits a polynomial to one dataset.
+ *
+ * \param y The y values of the samples, one per x value of the grid.
+ * \return Polynomial The polynomial of the fitter's degree minimizing the sum of the squared residuals.
+ */
+Polynomial Fit(const std::vector<highprecision>& y) const;
+
+/**
+ * \brief Fits a polynomial to each of the datasets in parallel.
+ *
+ * \param datasets The datasets, each holding one y value per x value of the grid.
+ * \param pool The pool the fits are distributed on.
+ * \return std::vector<Polynomial> One polynomial per dataset, in the same order.
+ */
+std::vector<Polynomial> Fit(const std::vector<std::vector<highprecision>>& datasets, TaskPool& pool) const;
+
+/**
+ * \brief Fits a polynomial to each of the datasets in parallel on a temporary pool.
+ */
+std::vector<Polynomial> Fit(const std::vector<std::vector<highprecision>>& datasets) const;
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+size_t                                  NumberOfSamples;    //< m, the number of x values.
+int                                     Degree;             //< The degree of the fitted polynomials, n - 1.
+std::vector<std::vector<highprecision>> Reflectors;         //< Householder vector of step k, acting on the rows k..m-1.
+std::vector<highprecision>              ReflectorNorms;     //< The squared norm of each householder vector.
+std::vector<std::vector<highprecision>> R;                  //< The upper triangular factor, R[i][j] for j >= i.
+std::vector<std::vector<highprecision>> BasisToMonomial;    //< Row k: monomial coefficients in x (lowest order first) of T_k of the mapped x.
+
+/* Private Methods ***********************************************************/
+void ApplyReflectors(std::vector<highprecision>& values) const;
+
+};
+
+} // namespace vath
+
+#endif /* _POLYNOMIALFITTER_HPP_ */
@@ -0,0 +1,96 @@
+#ifndef _POLYPHASERESAMPLER_HPP_
+#define _POLYPHASERESAMPLER_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Changes the sample rate of a stream by the rational factor L / M: the input is upsampled by L (L - 1 zeros
+ *        after every sample), filtered by a prototype FIR and every M-th sample is kept. M = 1 interpolates, L = 1
+ *        decimates.
+ *
+ * \remarks The prototype runs at L times the input rate, e.g. a lowpass with cutoff 0.5 / max(L, M) from
+ *          FirDesign. It is split into L phases, h_p[j] = h[p + jL], each stored reversed and contiguous, so every
+ *          output sample is one dot product of a phase with the most recent inputs. Neither the zeros of the
+ *          upsampling nor the samples which the decimation drops are ever computed, which saves a factor L * M of
+ *          the multiply-adds of filtering at the high rate. The phases and the history are held in double
+ *          precision, the dot products use independent partial sums so they pipeline and vectorize.
+ *          The outputs are multiplied by L, so a prototype with unit passband gain keeps the amplitude.
+ *          https://en.wikipedia.org/wiki/Polyphase_quadrature_filter
+ */
+class PolyphaseResampler
+{
+
+public:
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new PolyphaseResampler object.
+ *
+ * \param prototype The prototype filter as polynomial in z^-1, the coefficient of z^-n is h[n] (see
+ *                  FirDesign::ToPolynomial()).
+ * \param interpolation The upsampling factor L, at least 1.
+ * \param decimation The downsampling factor M, at least 1.
+ */
+PolyphaseResampler(const Polynomial& prototype, size_t interpolation, size_t decimation);
+
+/**
+ * \brief Construct a new PolyphaseResampler object.
+ *
+ * \param taps The taps h[0], ..., h[N-1] of the prototype.
+ * \param interpolation The upsampling factor L, at least 1.
+ * \param decimation The downsampling factor M, at least 1.
+ */
+PolyphaseResampler(const std::vector<highprecision>& taps, size_t interpolation, size_t decimation);
+
+/* Accessors/Mutators ********************************************************/
+size_t GetInterpolation() const;
+size_t GetDecimation() const;
+size_t GetTapsPerPhase() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Resamples the next samples of the stream, the samples may come in chunks of any size.
+ *
+ * \param input The next input samples x[n].
+ * \return std::vector<highprecision> Every output sample y[m] = L sum h[k] u[mM - k] whose last input has arrived,
+ *         u being the upsampled input (about input.size() * L / M of them).
+ */
+std::vector<highprecision> Process(const std::vector<highprecision>& input);
+
+/**
+ * \brief Clears the history, the stream starts at rest again.
+ */
+void Reset();
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+size_t                  Interpolation;      //< L.
+size_t                  Decimation;         //< M.
+size_t                  TapsPerPhase;       //< K = ceil(N / L).
+std::vector<double>     Phases;             //< L * h[p + jL] at p * K + (K - 1 - j), the phases one after another.
+std::vector<double>     History;            //< The last K - 1 inputs.
+size_t                  Time;               //< The upsampled index of the next output, relative to the next input.
+
+/* Private Methods ***********************************************************/
+void Initialize(const std::vector<highprecision>& taps, size_t interpolation, size_t decimation);
+static double DotProduct(const double* left, const double* right, size_t length);
+
+};
+
+} // namespace vath
+
+#endif /* _POLYPHASERESAMPLER_HPP_ */
@@ -0,0 +1,138 @@
+#ifndef _POWERSERIES_HPP_
+#define _POWERSERIES_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief A power series truncated after its first n coefficients, i.e. a polynomial modulo x^n. The coefficients
+ *        are stored lowest order first.
+ *
+ * \remarks Products are FFT convolutions (see FastFourierTransform::Convolve()), cut off at x^n. Inverse(),
+ *          InverseSqrt() and Exp() are newton iterations which double the number of correct coefficients per step,
+ *          so each of them costs a constant number of products of length n. Log() is the integral of f' / f.
+ *          Altogether every operation runs in O(n log n).
+ *          The newton inverse amplifies rounding errors by about |f| |1 / f| per step, which is large for a
+ *          denominator with poles close to the unit circle. Short series (a filter denominator) are therefore
+ *          inverted term by term in O(n p), which is also cheaper for small orders p.
+ *          Binary operations yield the precision of the less precise operand.
+ *          https://en.wikipedia.org/wiki/Formal_power_series
+ */
+class PowerSeries
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t DIRECT_INVERSION_MAX_ORDER = 32;    //< Series of at most this order are inverted term by term.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new PowerSeries object.
+ *
+ * \param coefficients The coefficients c_0, c_1, ..., cut off or padded with zeros to the precision.
+ * \param precision The number n of coefficients, at least 1.
+ */
+PowerSeries(const std::vector<highprecision>& coefficients, size_t precision);
+
+/**
+ * \brief Construct a new PowerSeries object from a polynomial, cut off at x^n.
+ */
+PowerSeries(const Polynomial& polynomial, size_t precision);
+
+/* Accessors/Mutators ********************************************************/
+size_t GetPrecision() const;
+std::vector<highprecision> GetCoefficients() const;
+
+/**
+ * \brief Returns the coefficient of x^k, 0 for k >= precision.
+ */
+highprecision GetCoefficient(size_t k) const;
+
+// Friend declaration for operator*, which multiplies like the private Multiply()
+friend PowerSeries operator *(const PowerSeries& left, const PowerSeries& right);
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Returns the series as polynomial of degree < n.
+ */
+Polynomial ToPolynomial() const;
+
+/**
+ * \brief Returns 1 / f, the constant coefficient must not be 0.
+ */
+PowerSeries Inverse() const;
+
+/**
+ * \brief Returns log f, the constant coefficient must be positive.
+ */
+PowerSeries Log() const;
+
+/**
+ * \brief Returns exp f.
+ */
+PowerSeries Exp() const;
+
+/**
+ * \brief Returns the square root with positive constant coefficient, the constant coefficient must be positive.
+ */
+PowerSeries Sqrt() const;
+
+/**
+ * \brief Returns 1 / sqrt(f), the constant coefficient must be positive.
+ */
+PowerSeries InverseSqrt() const;
+
+/**
+ * \brief Returns f', which has one coefficient less.
+ */
+PowerSeries Derivative() const;
+
+/**
+ * \brief Returns the integral of f with constant coefficient 0, which has one coefficient more.
+ */
+PowerSeries Integral() const;
+
+/**
+ * \brief Computes the first samples of the impulse response of a causal filter by one series division.
+ *
+ * \param filter H(z) = B(z) / A(z) in positive powers of z (as from Discretization), B must not have a higher order
+ *               than A and the leading coefficient of A must not be 0.
+ * \param length The number of samples.
+ * \return std::vector<highprecision> h[0], ..., h[length - 1], the coefficients of H as series in z^-1.
+ */
+static std::vector<highprecision> GetImpulseResponse(const PolynomialFraction& filter, size_t length);
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+std::vector<highprecision> Coefficients;    //< c_0, ..., c_(n-1).
+
+/* Private Methods ***********************************************************/
+static std::vector<highprecision> Multiply(const std::vector<highprecision>& left, const std::vector<highprecision>& right, size_t length);
+static std::vector<highprecision> Invert(const std::vector<highprecision>& series, size_t length);
+static std::vector<highprecision> Logarithm(const std::vector<highprecision>& series, size_t length);
+
+};
+
+PowerSeries operator +(const PowerSeries& left, const PowerSeries& right);
+PowerSeries operator -(const PowerSeries& left, const PowerSeries& right);
+PowerSeries operator *(const PowerSeries& left, const PowerSeries& right);
+PowerSeries operator *(const PowerSeries& left, const highprecision right);
+PowerSeries operator /(const PowerSeries& left, const PowerSeries& right);
+
+} // namespace vath
+
+#endif /* _POWERSERIES_HPP_ */
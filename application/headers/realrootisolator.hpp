@@ -0,0 +1,135 @@
+#ifndef _REALROOTISOLATOR_HPP_
+#define _REALROOTISOLATOR_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <mutex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "interval.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Isolates the real zeros of a polynomial with the continued fraction method of Vincent, Akritas and Strzebonski (VAS).
+ *        Descartes' rule of signs bounds the number of positive zeros by the number of sign variations of the coefficients.
+ *        The positive axis is split recursively by Taylor shifts and Moebius transformations until every part has zero or
+ *        one sign variation. Independent parts are processed in parallel on a task pool.
+ *
+ * \remarks Unlike Polynomial::FindZeros, this does not depend on a fixed search interval, every real zero is found.
+ *          The polynomial must be square-free (no multiple zeros), since multiple zeros can not be isolated.
+ *          An instance must not be used by several threads at the same time.
+ *          https://en.wikipedia.org/wiki/Real-root_isolation#Continued_fraction_method
+ */
+class RealRootIsolator
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr int MAX_RECURSION_DEPTH        = 4096;     //< The maximum depth of the continued fraction tree. Deeper means the polynomial is probably not square-free.
+static constexpr int PARALLEL_MIN_ORDER         = 8;        //< Subproblems of polynomials with a smaller order are not worth a task and are solved right away.
+static constexpr int REFINEMENT_MAX_ITERATIONS  = 256;      //< The maximum number of iterations when refining an isolating interval to a zero.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new RealRootIsolator object, which uses one thread per hardware thread.
+ */
+RealRootIsolator();
+
+/**
+ * \brief Construct a new RealRootIsolator object.
+ *
+ * \param numberOfThreads The number of worker threads. 0 processes everything on the calling thread.
+ */
+RealRootIsolator(unsigned int numberOfThreads);
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Isolates all real zeros of a polynomial.
+ *
+ * \param function The (square-free) polynomial which' zeros shall be isolated.
+ * \return std::vector<Interval> Disjoint intervals in ascending order, each containing exactly one zero. Zeros which
+ *         are hit exactly are returned as degenerate intervals [x, x].
+ */
+std::vector<Interval> Isolate(const Polynomial& function);
+
+/**
+ * \brief Finds all real zeros of a polynomial by isolating them and refining every isolating interval by a
+ *        safeguarded newton bisection.
+ *
+ * \param function The (square-free) polynomial which' zeros shall be found.
+ * \return std::vector<highprecision> The zeros in ascending order.
+ */
+std::vector<highprecision> FindZeros(const Polynomial& function);
+
+/**
+ * \brief Counts the sign variations of a coefficient list, ignoring zero coefficients (Descartes' rule of signs).
+ */
+static int CountSignVariations(const std::vector<highprecision>& coefficients);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+
+/**
+ * \brief The moebius transformation x = (A*y + B) / (C*y + D) which maps the positive y-axis to the part of the
+ *        positive x-axis the current polynomial stands for.
+ */
+struct MoebiusTransformation
+{
+    highprecision A;
+    highprecision B;
+    highprecision C;
+    highprecision D;
+};
+
+/* Private Member variables **************************************************/
+TaskPool Pool;  //< The pool the subproblems are processed on.
+
+/* Private Methods ***********************************************************/
+
+void IsolatePositive(
+    std::vector<highprecision> coefficients,
+    const Polynomial& function,
+    MoebiusTransformation transformation,
+    int depth,
+    highprecision positiveBound,
+    bool originIsZero,
+    bool infinityIsZero,
+    std::vector<Interval>& isolated,
+    std::mutex& isolatedMutex
+    );
+
+/**
+ * \brief Replaces the coefficients of p(x) (highest order first) by the ones of p(x + shift).
+ *
+ * \remarks This is the O(n^2) synthetic division scheme. Unlike Polynomial::TaylorShiftCoefficients it never switches
+ *          to the divide and conquer scheme, whose FFT products are not accurate enough for the sign variations.
+ */
+static void TaylorShift(std::vector<highprecision>& coefficients, highprecision shift);
+
+/**
+ * \brief Checks whether the split point, the image of the origin under the transformation, is a zero of the original
+ *        polynomial. The constant term of the coefficients is only a candidate, the decision is made by evaluating the
+ *        original polynomial with an error bound. If that excludes a zero, the sign of the constant term is corrected.
+ */
+static bool IsZeroAtOrigin(std::vector<highprecision>& coefficients, const Polynomial& function, const MoebiusTransformation& transformation);
+static highprecision GetPositiveRootLowerBound(const std::vector<highprecision>& coefficients);
+static highprecision GetPositiveRootUpperBound(const std::vector<highprecision>& coefficients);
+static highprecision Refine(const std::vector<highprecision>& coefficients, const Interval& isolatingInterval);
+
+};
+
+} // namespace vath
+
+#endif /* _REALROOTISOLATOR_HPP_ */
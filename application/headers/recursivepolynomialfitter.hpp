@@ -0,0 +1,109 @@
+#ifndef _RECURSIVEPOLYNOMIALFITTER_HPP_
+#define _RECURSIVEPOLYNOMIALFITTER_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <deque>
+#include <utility>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Keeps the least squares fit of a polynomial of fixed degree over a stream of samples up to date.
+ *        Every sample costs O(n^2) for n = degree + 1 coefficients, independent of the number of samples seen.
+ *
+ * \remarks This is QR based recursive least squares: only the triangular factor R and Q^T y of the (never stored)
+ *          system are kept. A new sample is rotated into R by givens rotations, a sample leaving the sliding window
+ *          is rotated out again by hyperbolic rotations. Old samples can also be faded out by a forgetting factor
+ *          lambda, which weighs a sample seen k updates ago with lambda^k.
+ *          The basis is the monomial one in x, so x should stay in a moderate range around 0 (e.g. time relative
+ *          to the start of the window) to keep the problem well conditioned.
+ *          https://en.wikipedia.org/wiki/Recursive_least_squares_filter
+ */
+class RecursivePolynomialFitter
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr highprecision RANK_TOLERANCE = 1E-12;     //< Relative magnitude of a diagonal element of R below which the fit counts as not determined yet.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new RecursivePolynomialFitter object.
+ *
+ * \param degree The degree of the fitted polynomial.
+ * \param forgettingFactor lambda in (0, 1]. 1 weighs every sample equally.
+ * \param windowSize The number of most recent samples the fit is based on. 0 keeps every sample.
+ */
+RecursivePolynomialFitter(int degree, highprecision forgettingFactor = 1, size_t windowSize = 0);
+
+/* Accessors/Mutators ********************************************************/
+int GetDegree() const;
+highprecision GetForgettingFactor() const;
+size_t GetWindowSize() const;
+
+/**
+ * \brief Returns the number of samples the current fit is based on.
+ */
+size_t Count() const;
+
+/**
+ * \brief Returns the (weighted) sum of the squared residuals of the current fit.
+ */
+highprecision GetResidualSumOfSquares() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Adds a sample and updates the fit. If the window is full, its oldest sample is removed.
+ */
+void Add(highprecision x, highprecision y);
+
+/**
+ * \brief Checks whether the samples determine a unique fit, i.e. whether there are degree + 1 distinct x values.
+ */
+bool IsDetermined() const;
+
+/**
+ * \brief Returns the current fit. Throws if it is not determined yet (see IsDetermined()).
+ */
+Polynomial GetPolynomial() const;
+
+/**
+ * \brief Forgets every sample.
+ */
+void Reset();
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+int                                             Degree;             //< The degree of the fitted polynomial.
+highprecision                                   ForgettingFactor;   //< lambda.
+size_t                                          WindowSize;         //< The maximum number of samples, 0 for unlimited.
+std::vector<std::vector<highprecision>>         R;                  //< The upper triangular factor, R[i][j] for j >= i.
+std::vector<highprecision>                      Z;                  //< Q^T y, the right hand side of R c = z.
+highprecision                                   ResidualSquares;    //< The weighted sum of the squared residuals.
+size_t                                          NumberOfSamples;    //< The number of samples within the fit.
+std::deque<std::pair<highprecision, highprecision>> Window;         //< The samples within the window, oldest first. Only kept if WindowSize > 0.
+
+/* Private Methods ***********************************************************/
+std::vector<highprecision> GetBasis(highprecision x) const;
+void Update(std::vector<highprecision> row, highprecision y);
+void Downdate(std::vector<highprecision> row, highprecision y);
+void RebuildFromWindow();
+
+};
+
+} // namespace vath
+
+#endif /* _RECURSIVEPOLYNOMIALFITTER_HPP_ */
@@ -0,0 +1,123 @@
+#ifndef _SECONDORDERSECTIONS_HPP_
+#define _SECONDORDERSECTIONS_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "zeropolegain.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief How the gain of a second order section cascade is distributed among the sections.
+ */
+enum class SectionScaling
+{
+    None,               //< The whole gain is put into the first section.
+    L2,                 //< The response from the input to the output of every section but the last has unit energy.
+    LInfinity           //< The magnitude response from the input to the output of every section but the last peaks at 1.
+};
+
+/**
+ * \brief A digital filter as cascade of second order sections (biquads)
+ *        H_k(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2), which unlike the expanded transfer function
+ *        stays accurate for high orders.
+ *
+ * \remarks The poles are grouped first: every conjugate pair forms a section, the real poles are paired by
+ *          descending radius, an odd one out forms a first order section. Then the sections, the one with the pole
+ *          closest to the unit circle first, take the zeros nearest to their poles: a conjugate pair, or two real
+ *          zeros. Zeros at infinity (a strictly proper H(z) is a delay) come last and become factors z^-1. Finally
+ *          the sections are ordered by ascending pole radius, so the sharpest resonances come last, and scaled.
+ *          The coefficients b0, b1, b2, a1, a2 of all sections are stored in one contiguous array, ready for a
+ *          filter kernel.
+ *          https://en.wikipedia.org/wiki/Digital_biquad_filter
+ */
+class SecondOrderSections
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t COEFFICIENTS_PER_SECTION    = 5;        //< b0, b1, b2, a1, a2, a0 = 1 is not stored.
+static constexpr size_t SCALING_GRID_SIZE           = 4096;     //< The number of frequencies in [0, pi] the norms for the scaling are computed on.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct the cascade of a filter given by its zeros, poles and gain in the z-plane.
+ *
+ * \param filter The filter, at least as many poles as zeros (causal).
+ * \param scaling The distribution of the gain.
+ */
+SecondOrderSections(const ZeroPoleGain& filter, SectionScaling scaling = SectionScaling::None);
+
+/**
+ * \brief Construct the cascade of a filter given by its transfer function H(z) = B(z) / A(z) in positive powers of
+ *        z (see Discretization), deg B <= deg A.
+ */
+SecondOrderSections(const PolynomialFraction& filter, SectionScaling scaling = SectionScaling::None);
+
+/* Accessors/Mutators ********************************************************/
+size_t Count() const;
+
+/**
+ * \brief Returns b0, b1, b2, a1, a2 of all sections, COEFFICIENTS_PER_SECTION per section, in cascade order.
+ */
+std::vector<highprecision> GetCoefficients() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Evaluates the product of all sections at z.
+ */
+std::complex<highprecision> EvaluateAt(std::complex<highprecision> z) const;
+
+/**
+ * \brief Multiplies the sections to the transfer function H(z) in positive powers of z with a monic denominator.
+ */
+PolynomialFraction ToTransferFunction() const;
+
+/**
+ * \brief Runs a signal through the cascade (transposed direct form II), starting at rest.
+ *
+ * \param signal The input samples.
+ * \return std::vector<highprecision> The output samples.
+ */
+std::vector<highprecision> Filter(const std::vector<highprecision>& signal) const;
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+
+struct Section
+{
+    std::vector<Complex>    Poles;      //< One or two poles.
+    std::vector<Complex>    Zeros;      //< As many zeros as poles, infinite ones stand for z^-1.
+};
+
+/* Private Member variables **************************************************/
+std::vector<highprecision>  Coefficients;   //< b0, b1, b2, a1, a2 per section.
+
+/* Private Methods ***********************************************************/
+void Build(const std::vector<Complex>& zeros, const std::vector<Complex>& poles, highprecision gain, SectionScaling scaling);
+static void SplitRoots(const std::vector<Complex>& roots, std::vector<Complex>& real, std::vector<Complex>& upper);
+static std::vector<Section> GroupPoles(const std::vector<Complex>& poles);
+static void AssignZeros(std::vector<Section>& sections, const std::vector<Complex>& zeros);
+static std::vector<highprecision> ExpandSection(const std::vector<Complex>& roots);
+static Complex EvaluateSection(const highprecision* coefficients, Complex z);
+static highprecision GetNorm(const std::vector<Complex>& response, SectionScaling scaling);
+
+};
+
+} // namespace vath
+
+#endif /* _SECONDORDERSECTIONS_HPP_ */
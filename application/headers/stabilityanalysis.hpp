@@ -0,0 +1,100 @@
+#ifndef _STABILITYANALYSIS_HPP_
+#define _STABILITYANALYSIS_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "taskpool.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Decides whether a polynomial is stable directly from its coefficients, without finding any zero.
+ *        Both tests run in O(n^2) and also work for polynomials with complex zeros.
+ *
+ * \remarks - Schur stable: every zero lies strictly inside the unit circle (discrete time, denominator in z).
+ *            Tested with the Schur-Cohn recursion (equivalent to Jury's table).
+ *            https://en.wikipedia.org/wiki/Jury_stability_criterion
+ *          - Hurwitz stable: every zero lies strictly in the left half plane (continuous time, denominator in s).
+ *            Tested with the Routh array. https://en.wikipedia.org/wiki/Routh%E2%80%93Hurwitz_stability_criterion
+ *          Zeros on the boundary (unit circle or imaginary axis) count as unstable.
+ */
+class StabilityAnalysis
+{
+
+public:
+/* Public constants **********************************************************/
+/* ... */
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Checks whether all zeros of the coefficients (highest order first) lie strictly inside the unit circle.
+ */
+static bool IsSchurStable(const CoefficientList& coefficients);
+
+/**
+ * \brief Checks whether all zeros of the polynomial lie strictly inside the unit circle.
+ */
+static bool IsSchurStable(const Polynomial& denominator);
+
+/**
+ * \brief Checks whether all poles of the rational function (zeros of its denominator) lie strictly inside the unit circle.
+ */
+static bool IsSchurStable(const PolynomialFraction& transferFunction);
+
+/**
+ * \brief Checks a batch of polynomials for schur stability in parallel.
+ *
+ * \param denominators The polynomials to be checked.
+ * \param pool The pool the checks are distributed on.
+ * \return std::vector<bool> One result per polynomial, in the same order.
+ */
+static std::vector<bool> IsSchurStable(const std::vector<Polynomial>& denominators, TaskPool& pool);
+
+/**
+ * \brief Checks a batch of polynomials for schur stability in parallel on a temporary pool.
+ */
+static std::vector<bool> IsSchurStable(const std::vector<Polynomial>& denominators);
+
+/**
+ * \brief Checks whether all zeros of the coefficients (highest order first) lie strictly in the left half plane.
+ */
+static bool IsHurwitzStable(const CoefficientList& coefficients);
+
+/**
+ * \brief Checks whether all zeros of the polynomial lie strictly in the left half plane.
+ */
+static bool IsHurwitzStable(const Polynomial& denominator);
+
+/**
+ * \brief Checks whether all poles of the rational function (zeros of its denominator) lie strictly in the left half plane.
+ */
+static bool IsHurwitzStable(const PolynomialFraction& transferFunction);
+
+/**
+ * \brief Checks a batch of polynomials for hurwitz stability in parallel.
+ *
+ * \param denominators The polynomials to be checked.
+ * \param pool The pool the checks are distributed on.
+ * \return std::vector<bool> One result per polynomial, in the same order.
+ */
+static std::vector<bool> IsHurwitzStable(const std::vector<Polynomial>& denominators, TaskPool& pool);
+
+/**
+ * \brief Checks a batch of polynomials for hurwitz stability in parallel on a temporary pool.
+ */
+static std::vector<bool> IsHurwitzStable(const std::vector<Polynomial>& denominators);
+
+};
+
+} // namespace vath
+
+#endif /* _STABILITYANALYSIS_HPP_ */
@@ -0,0 +1,143 @@
+#ifndef _STATESPACE_HPP_
+#define _STATESPACE_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The canonical forms a transfer function is realized in.
+ */
+enum class CanonicalForm
+{
+    Controllable,       //< Companion matrix with the negated denominator in the first row, B = e_1.
+    Observable          //< The transpose of the controllable form, C = e_1^T.
+};
+
+/**
+ * \brief This represents a discrete time system x[k+1] = A x[k] + B u[k], y[k] = C x[k] + D u[k] with n states,
+ *        p inputs and q outputs. The matrices are stored row by row: a is n x n, b is n x p, c is q x n, d is q x p.
+ */
+typedef struct StateSpaceMatrices
+{
+    std::vector<std::vector<highprecision>> a;
+    std::vector<std::vector<highprecision>> b;
+    std::vector<std::vector<highprecision>> c;
+    std::vector<std::vector<highprecision>> d;
+} StateSpaceMatrices;
+
+/**
+ * \brief Converts between transfer functions and state space realizations and runs a state space system on
+ *        blocks of samples.
+ *
+ * \remarks The way back to transfer functions computes characteristic polynomials only: A is reduced to upper
+ *          hessenberg form by householder reflections, whose characteristic polynomial follows from a recurrence
+ *          over its columns. The numerator from input j to output i is det(zI - A + b_j c_i) + (d_ij - 1) det(zI - A).
+ *          The runtime processes blocks of BLOCK_SIZE samples: B U and later C X + D U are computed for the whole
+ *          block as matrix products tiled for the cache, only x[k+1] = A x[k] + (B U)[k] is sequential. It runs in
+ *          double precision on row major copies of the matrices.
+ *          https://en.wikipedia.org/wiki/State-space_representation
+ *          https://en.wikipedia.org/wiki/Hessenberg_matrix
+ */
+class StateSpace
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t BLOCK_SIZE  = 256;      //< The number of samples the runtime processes at once.
+static constexpr size_t TILE_SIZE   = 64;       //< The edge of the tiles of the matrix products.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new StateSpace object, starting at rest.
+ *
+ * \param matrices The matrices, with consistent dimensions.
+ */
+StateSpace(const StateSpaceMatrices& matrices);
+
+/**
+ * \brief Construct a new StateSpace object realizing a transfer function (see FromTransferFunction()).
+ */
+StateSpace(const PolynomialFraction& transferFunction, CanonicalForm form = CanonicalForm::Controllable);
+
+/* Accessors/Mutators ********************************************************/
+StateSpaceMatrices GetMatrices() const;
+size_t GetOrder() const;
+size_t GetInputCount() const;
+size_t GetOutputCount() const;
+std::vector<highprecision> GetState() const;
+void SetState(const std::vector<highprecision>& state);
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Realizes a proper transfer function H(z) = N(z) / D(z) (positive powers of z) in canonical form.
+ *
+ * \param transferFunction The transfer function, the order of N must not exceed the order of D.
+ * \param form The canonical form.
+ * \return StateSpaceMatrices A realization with one input, one output and order(D) states.
+ */
+static StateSpaceMatrices FromTransferFunction(const PolynomialFraction& transferFunction, CanonicalForm form = CanonicalForm::Controllable);
+
+/**
+ * \brief Returns the transfer function H_ij(z) = c_i (zI - A)^-1 b_j + d_ij from an input to an output.
+ *
+ * \param matrices The matrices.
+ * \param output The index i of the output.
+ * \param input The index j of the input.
+ * \return PolynomialFraction N(z) / D(z) with the monic characteristic polynomial of A as denominator.
+ */
+static PolynomialFraction ToTransferFunction(const StateSpaceMatrices& matrices, size_t output = 0, size_t input = 0);
+
+/**
+ * \brief Runs the system on the next samples of all inputs, continuing from the current state.
+ *
+ * \param inputs One sequence per input, all of the same length.
+ * \return std::vector<std::vector<highprecision>> One sequence per output.
+ */
+std::vector<std::vector<highprecision>> Process(const std::vector<std::vector<highprecision>>& inputs);
+
+/**
+ * \brief Runs a single input, single output system on the next samples.
+ */
+std::vector<highprecision> Process(const std::vector<highprecision>& input);
+
+/**
+ * \brief Sets the state to 0.
+ */
+void Reset();
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+StateSpaceMatrices      Matrices;
+size_t                  Order;          //< n.
+size_t                  InputCount;     //< p.
+size_t                  OutputCount;    //< q.
+std::vector<double>     A;              //< Row major copies for the runtime.
+std::vector<double>     B;
+std::vector<double>     C;
+std::vector<double>     D;
+std::vector<double>     State;          //< x[k].
+
+/* Private Methods ***********************************************************/
+static void Multiply(const double* left, const double* right, double* result, size_t rows, size_t inner, size_t columns);
+static CoefficientList GetCharacteristicPolynomial(std::vector<std::vector<highprecision>> matrix);
+static std::vector<double> Flatten(const std::vector<std::vector<highprecision>>& matrix, size_t rows, size_t columns);
+
+};
+
+} // namespace vath
+
+#endif /* _STATESPACE_HPP_ */
@@ -0,0 +1,101 @@
+#ifndef _STURMSEQUENCE_HPP_
+#define _STURMSEQUENCE_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "interval.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The sturm chain p0 = p, p1 = p', p(k+1) = -rem(p(k-1), p(k)) of a polynomial. It is computed once in the
+ *        constructor, after that every query for the number of distinct real zeros within an interval only needs
+ *        to evaluate the chain at the interval boundaries.
+ *
+ * \remarks The number of distinct real zeros in (a, b] is V(a) - V(b), where V(x) is the number of sign changes of the
+ *          chain evaluated at x. https://en.wikipedia.org/wiki/Sturm%27s_theorem
+ */
+class SturmSequence
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr highprecision REMAINDER_TOLERANCE = 1E-14;   //< Relative magnitude below which a remainder coefficient is treated as 0.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new SturmSequence object by computing the sturm chain of the polynomial.
+ *
+ * \param function The polynomial for which the zeros shall be counted. Must not be the zero polynomial.
+ */
+SturmSequence(const Polynomial& function);
+
+/* Accessors/Mutators ********************************************************/
+
+/**
+ * \brief Returns the polynomials of the chain, starting with the original polynomial.
+ */
+std::vector<Polynomial> GetChain() const;
+
+/**
+ * \brief Returns the number of polynomials in the chain.
+ */
+int Count() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Counts the sign changes of the chain evaluated at x, ignoring zeros.
+ */
+int CountSignChangesAt(highprecision x) const;
+
+/**
+ * \brief Counts the distinct real zeros within the half-open interval (lowerLimit, upperLimit].
+ */
+int CountZeros(highprecision lowerLimit, highprecision upperLimit) const;
+
+/**
+ * \brief Counts the distinct real zeros within the half-open interval (interval.Lower, interval.Upper].
+ */
+int CountZeros(const Interval& interval) const;
+
+/**
+ * \brief Counts all distinct real zeros of the polynomial.
+ */
+int CountZeros() const;
+
+/**
+ * \brief Counts the distinct real zeros for each of the given intervals.
+ *
+ * \param intervals The intervals to be examined, each one is treated as (Lower, Upper].
+ * \return std::vector<int> The number of distinct real zeros per interval.
+ */
+std::vector<int> CountZeros(const std::vector<Interval>& intervals) const;
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+std::vector<std::vector<highprecision>> Chain;  //< The coefficients (highest order first) of each polynomial of the chain.
+
+/* Private Methods ***********************************************************/
+
+/**
+ * \brief Counts the sign changes of the chain at +inf (positive == true) or -inf.
+ */
+int CountSignChangesAtInfinity(bool positive) const;
+
+};
+
+} // namespace vath
+
+#endif /* _STURMSEQUENCE_HPP_ */
@@ -0,0 +1,118 @@
+#ifndef _SUBPRODUCTTREE_HPP_
+#define _SUBPRODUCTTREE_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief The subproduct tree of a fixed set of points x_0, ..., x_(n-1): every node holds the product of (x - x_i)
+ *        over a contiguous range of the points, the root holds M(x) = prod (x - x_i). On top of it, a polynomial
+ *        is evaluated at all the points, or the points are interpolated, in O(n log^2 n) instead of O(n^2).
+ *
+ * \remarks The products are computed by FFT convolution (see FastFourierTransform), the remainders by fast division
+ *          with the reversed divisor's inverse power series. These inverses are computed once with the tree, so
+ *          only the actual work is left when the same points are used for many polynomials.
+ *          Ranges of at most LEAF_SIZE points are not split any further and are handled directly, which is faster
+ *          and more accurate for small sizes. The sorted points are dealt out alternately to the children, so the
+ *          points of every node spread over the whole range. Still, the remainder sequence amplifies rounding errors
+ *          for high orders, so the points should lie in a moderate range around 0 (e.g. [-1, 1]). Interpolation in
+ *          the monomial basis is ill conditioned by itself, it is only accurate for a few dozen real points.
+ *          https://en.wikipedia.org/wiki/Polynomial_evaluation#Multipoint_evaluation
+ */
+class SubproductTree
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr size_t LEAF_SIZE = 16;     //< The maximum number of points of a leaf, which is handled directly.
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new SubproductTree object.
+ *
+ * \param points The points. Must not be empty.
+ */
+SubproductTree(const std::vector<highprecision>& points);
+
+/* Accessors/Mutators ********************************************************/
+std::vector<highprecision> GetPoints() const;
+size_t Count() const;
+
+/**
+ * \brief Returns M(x) = prod (x - x_i), the polynomial whose zeros are the points.
+ */
+Polynomial GetRootPolynomial() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Evaluates the polynomial at every point.
+ *
+ * \param function The polynomial to be evaluated.
+ * \return std::vector<highprecision> The values, in the order of the points.
+ */
+std::vector<highprecision> EvaluateAt(const Polynomial& function) const;
+
+/**
+ * \brief Constructs the polynomial of lowest degree which takes the given values at the points (which have to be
+ *        distinct).
+ *
+ * \param values The values, in the order of the points.
+ * \return Polynomial The interpolating polynomial of degree Count() - 1 (at most).
+ */
+Polynomial Interpolate(const std::vector<highprecision>& values) const;
+
+/**
+ * \brief Constructs the monic polynomial with the given zeros in O(n log^2 n).
+ *
+ * \param roots The zeros, repeated according to their multiplicity. Must not be empty.
+ * \return Polynomial The polynomial prod (x - root_i).
+ */
+static Polynomial FromRoots(const std::vector<highprecision>& roots);
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+struct Node
+{
+    size_t                      Begin;              //< The first point of the range (in tree order).
+    size_t                      End;                //< One past the last point of the range.
+    int                         Left;               //< Index of the left child, -1 for leaves.
+    int                         Right;              //< Index of the right child, -1 for leaves.
+    std::vector<highprecision>  Product;            //< prod (x - x_i) over the range, lowest order first.
+    std::vector<highprecision>  ReversedInverse;    //< 1 / rev(Product) mod x^k, k = deg(parent) - deg(Product). Empty for the root.
+};
+
+/* Private Member variables **************************************************/
+std::vector<highprecision>  Points;     //< The points in tree order, every node covers a contiguous range of them.
+std::vector<size_t>         Order;      //< Order[j] is the index, which the j-th point in tree order was given at.
+std::vector<Node>           Nodes;      //< The nodes, the root is the first one.
+std::vector<highprecision>  Weights;    //< 1 / M'(x_j) in tree order, the barycentric weights used by Interpolate(). Empty if the points are not distinct.
+
+/* Private Methods ***********************************************************/
+int Build(size_t begin, size_t end, int parentOrder);
+void EvaluateAt(int node, const std::vector<highprecision>& remainder, std::vector<highprecision>& values) const;
+std::vector<highprecision> Combine(int node, const std::vector<highprecision>& weightedValues) const;
+
+static std::vector<size_t> Interleave(const std::vector<size_t>& indices);
+static std::vector<highprecision> Multiply(const std::vector<highprecision>& left, const std::vector<highprecision>& right);
+static std::vector<highprecision> InvertSeries(const std::vector<highprecision>& series, size_t length);
+static std::vector<highprecision> Remainder(const std::vector<highprecision>& numerator, const std::vector<highprecision>& denominator, const std::vector<highprecision>& reversedInverse);
+
+};
+
+} // namespace vath
+
+#endif /* _SUBPRODUCTTREE_HPP_ */
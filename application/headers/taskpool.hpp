@@ -0,0 +1,101 @@
+#ifndef _TASKPOOL_HPP_
+#define _TASKPOOL_HPP_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace Vath
+{
+
+/**
+ * \brief A fixed set of worker threads which execute submitted tasks. Tasks may submit further tasks, which is used
+ *        by the divide and conquer algorithms of this library (e.g. the real root isolation).
+ *
+ * \remarks WaitForAll() waits for every task of the pool, so a pool should not be shared between independent callers
+ *          which wait concurrently. It must never be called from within a task.
+ */
+class TaskPool
+{
+
+public:
+/* Public constants **********************************************************/
+/* ... */
+
+/* Constructors **************************************************************/
+
+/**
+ * \brief Construct a new TaskPool object with one worker per hardware thread.
+ */
+TaskPool();
+
+/**
+ * \brief Construct a new TaskPool object.
+ *
+ * \param numberOfThreads The number of worker threads. If 0, every task is executed directly within Submit().
+ */
+TaskPool(unsigned int numberOfThreads);
+
+TaskPool(const TaskPool& other) = delete;
+TaskPool& operator =(const TaskPool& right) = delete;
+
+/**
+ * \brief Destroys the TaskPool object. Waits for the remaining tasks and joins all workers.
+ */
+~TaskPool();
+
+/* Accessors/Mutators ********************************************************/
+unsigned int GetNumberOfThreads() const;
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Enqueues a task, which is then executed by the next free worker.
+ *
+ * \param task The task to be executed.
+ */
+void Submit(std::function<void()> task);
+
+/**
+ * \brief Blocks until every submitted task (including tasks submitted by tasks) has finished.
+ *
+ * \remarks If a task threw an exception, the first of these exceptions is rethrown here.
+ */
+void WaitForAll();
+
+/**
+ * \brief Executes body(i) for every i in [0, count) on the pool and waits until all of them have finished.
+ *        The indices are split into one contiguous chunk per worker.
+ *
+ * \param count The number of indices.
+ * \param body The function to be executed for every index.
+ */
+void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+/*****************************************************************************/
+private:
+
+/* Private Member variables **************************************************/
+std::vector<std::thread>            Workers;            //< The worker threads.
+std::deque<std::function<void()>>   Tasks;              //< The tasks, which are not yet picked up by a worker.
+std::mutex                          Mutex;              //< Guards every member below.
+std::condition_variable             TaskAvailable;      //< Signalled when a task was submitted or the pool shuts down.
+std::condition_variable             AllTasksDone;       //< Signalled when the last unfinished task has finished.
+size_t                              UnfinishedTasks;    //< The number of submitted tasks which have not finished yet.
+bool                                ShuttingDown;       //< Set by the destructor to stop the workers.
+std::exception_ptr                  FirstException;     //< The first exception thrown by a task.
+
+/* Private Methods ***********************************************************/
+void Work();
+
+};
+
+} // namespace vath
+
+#endif /* _TASKPOOL_HPP_ */
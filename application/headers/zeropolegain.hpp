@@ -0,0 +1,120 @@
+#ifndef _ZEROPOLEGAIN_HPP_
+#define _ZEROPOLEGAIN_HPP_
+
+#include <stdbool.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <optional>
+
+#include "monomial.hpp"
+#include "polynomial.hpp"
+#include "analogprototype.hpp"
+
+namespace Vath
+{
+
+/**
+ * \brief Represents a real rational function by its zeros, poles and gain, H(x) = gain * prod (x - z_i) / prod (x - p_i).
+ *
+ * \remarks Cascading (operator*) only concatenates the zeros and poles and multiplies the gains, no polynomial is
+ *          multiplied and no accuracy is lost. The transfer function is expanded only when ToTransferFunction() is
+ *          called and is kept until the ZeroPoleGain is changed. Every real zero and every conjugate pair becomes
+ *          a real factor of degree 1 or 2, and the factors are multiplied in a balanced product tree (see
+ *          FastFourierTransform::Convolve()), so the rounding errors grow with log n instead of n.
+ *          The cached transfer function makes concurrent calls of ToTransferFunction() on the same object unsafe,
+ *          distinct objects can be used from different threads.
+ */
+class ZeroPoleGain
+{
+
+public:
+/* Public constants **********************************************************/
+static constexpr highprecision CONJUGATE_TOLERANCE = 1E-9;      //< Relative distance below which two non-real zeros count as conjugate pair.
+
+/* Constructors **************************************************************/
+ZeroPoleGain();                                 // Default ctor, H(x) = 1
+
+/**
+ * \brief Construct a new ZeroPoleGain object.
+ *
+ * \param zeros The zeros, non-real ones in conjugate pairs.
+ * \param poles The poles, non-real ones in conjugate pairs.
+ * \param gain The gain, the ratio of the leading coefficients.
+ */
+ZeroPoleGain(const std::vector<std::complex<highprecision>>& zeros, const std::vector<std::complex<highprecision>>& poles, highprecision gain);
+
+/**
+ * \brief Construct a new ZeroPoleGain object from an analog prototype (see AnalogPrototype::Design()).
+ */
+ZeroPoleGain(const PoleZeroSet& prototype);
+
+/* Accessors/Mutators ********************************************************/
+std::vector<std::complex<highprecision>> GetZeros() const;
+std::vector<std::complex<highprecision>> GetPoles() const;
+highprecision GetGain() const;
+void SetGain(highprecision gain);
+
+/**
+ * \brief Returns whether the transfer function was expanded and is held in the cache.
+ */
+bool IsExpanded() const;
+
+/* Operators *****************************************************************/
+
+/**
+ * \brief Cascades another rational function, i.e. multiplies by it.
+ */
+ZeroPoleGain& operator *=(const ZeroPoleGain& other);
+
+/* Public Methods ************************************************************/
+
+/**
+ * \brief Finds the zeros and poles of a transfer function, per square-free factor (see
+ *        Polynomial::SquareFreeFactorization() and Polynomial::FindComplexZeros()), so multiple ones stay accurate.
+ *
+ * \param transferFunction N(x) / D(x), N and D must not be 0.
+ */
+static ZeroPoleGain FromTransferFunction(const PolynomialFraction& transferFunction);
+
+/**
+ * \brief Expands the rational function to N(x) / D(x) with a monic denominator, or returns the cached expansion.
+ */
+PolynomialFraction ToTransferFunction() const;
+
+/**
+ * \brief Evaluates H(x) directly from the zeros and poles, without expanding it.
+ */
+std::complex<highprecision> EvaluateAt(std::complex<highprecision> x) const;
+
+/*****************************************************************************/
+private:
+
+/* Private types *************************************************************/
+typedef std::complex<highprecision> Complex;
+
+/* Private Member variables **************************************************/
+std::vector<Complex>                        Zeros;              //< The zeros, repeated according to their multiplicity.
+std::vector<Complex>                        Poles;              //< The poles, repeated according to their multiplicity.
+highprecision                               Gain;               //< The ratio of the leading coefficients.
+mutable std::optional<PolynomialFraction>   TransferFunction;   //< The expansion, empty until it is needed.
+
+/* Private Methods ***********************************************************/
+static std::vector<Complex> FindRoots(const CoefficientList& coefficients);
+static CoefficientList ExpandRoots(const std::vector<Complex>& roots, highprecision gain);
+static std::vector<std::vector<highprecision>> GetRealFactors(const std::vector<Complex>& roots);
+static std::vector<highprecision> MultiplyFactors(const std::vector<std::vector<highprecision>>& factors, size_t begin, size_t end);
+
+};
+
+/**
+ * \brief Cascades two rational functions by concatenating their zeros and poles.
+ */
+ZeroPoleGain operator *(const ZeroPoleGain& left, const ZeroPoleGain& right);
+
+} // namespace vath
+
+#endif /* _ZEROPOLEGAIN_HPP_ */
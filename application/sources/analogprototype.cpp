@@ -0,0 +1,378 @@
+#include "../headers/analogprototype.hpp"
+#include <algorithm>
+#include <numbers>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+std::map<AnalogPrototype::CacheKey, AnalogPrototype::CacheEntry> AnalogPrototype::Cache;
+std::mutex AnalogPrototype::CacheMutex;
+
+/* Public Methods ************************************************************/
+
+PoleZeroSet AnalogPrototype::Design(PrototypeType type, int order, highprecision ripple, highprecision attenuation)
+{
+    return AnalogPrototype::Lookup(type, order, ripple, attenuation).Prototype;
+}
+
+PolynomialFraction AnalogPrototype::DesignTransferFunction(PrototypeType type, int order, highprecision ripple, highprecision attenuation)
+{
+    return AnalogPrototype::Lookup(type, order, ripple, attenuation).TransferFunction;
+}
+
+PoleZeroSet AnalogPrototype::Butterworth(int order)
+{
+    if(order < 1)
+    {
+        throw std::runtime_error("The order of a prototype has to be at least 1.");
+    }
+
+    // p_k = e^(j pi (2k + n - 1) / 2n), evenly spaced on the left half of the unit circle
+    PoleZeroSet prototype{ .zeros = {}, .poles = {}, .gain = 1 };
+    for(int k = 1; k <= order / 2; k++)
+    {
+        highprecision theta = std::numbers::pi_v<highprecision> * (2 * k - 1) / (2 * order);
+        Complex pole(-std::sin(theta), std::cos(theta));
+        prototype.poles.push_back(pole);
+        prototype.poles.push_back(std::conj(pole));
+    }
+    if(order % 2 == 1)
+    {
+        prototype.poles.push_back(-1);
+    }
+    return prototype;
+}
+
+PoleZeroSet AnalogPrototype::ChebyshevI(int order, highprecision ripple)
+{
+    if(order < 1)
+    {
+        throw std::runtime_error("The order of a prototype has to be at least 1.");
+    }
+    if(!(ripple > 0))
+    {
+        throw std::runtime_error("The passband ripple has to be positive.");
+    }
+
+    // |H(jw)|^2 = 1 / (1 + e^2 T_n(w)^2), the butterworth poles squeezed onto an ellipse
+    highprecision epsilon = std::sqrt(std::pow(10.0L, ripple / 10) - 1);
+    highprecision mu = std::asinh(1 / epsilon) / order;
+    PoleZeroSet prototype{ .zeros = {}, .poles = {}, .gain = 1 };
+    for(int k = 1; k <= order / 2; k++)
+    {
+        highprecision theta = std::numbers::pi_v<highprecision> * (2 * k - 1) / (2 * order);
+        Complex pole(-std::sinh(mu) * std::sin(theta), std::cosh(mu) * std::cos(theta));
+        prototype.poles.push_back(pole);
+        prototype.poles.push_back(std::conj(pole));
+    }
+    if(order % 2 == 1)
+    {
+        prototype.poles.push_back(-std::sinh(mu));
+    }
+
+    // Odd orders start at the top of the ripple, even ones at its bottom
+    Complex product = 1;
+    for(const Complex& pole : prototype.poles)
+    {
+        product *= -pole;
+    }
+    prototype.gain = product.real() * ((order % 2 == 1) ? 1 : 1 / std::sqrt(1 + epsilon * epsilon));
+    return prototype;
+}
+
+PoleZeroSet AnalogPrototype::ChebyshevII(int order, highprecision attenuation)
+{
+    if(order < 1)
+    {
+        throw std::runtime_error("The order of a prototype has to be at least 1.");
+    }
+    if(!(attenuation > 0))
+    {
+        throw std::runtime_error("The stopband attenuation has to be positive.");
+    }
+
+    // |H(jw)|^2 = e^2 T_n(1/w)^2 / (1 + e^2 T_n(1/w)^2): the zeros are at 1 / (zeros of T_n), the poles are the
+    // reciprocals of the chebyshev I poles for the same e
+    highprecision epsilon = 1 / std::sqrt(std::pow(10.0L, attenuation / 10) - 1);
+    highprecision mu = std::asinh(1 / epsilon) / order;
+    PoleZeroSet prototype{ .zeros = {}, .poles = {}, .gain = 1 };
+    for(int k = 1; k <= order / 2; k++)
+    {
+        highprecision theta = std::numbers::pi_v<highprecision> * (2 * k - 1) / (2 * order);
+        Complex zero(0, 1 / std::cos(theta));
+        prototype.zeros.push_back(zero);
+        prototype.zeros.push_back(std::conj(zero));
+        Complex pole = Complex(1) / Complex(-std::sinh(mu) * std::sin(theta), std::cosh(mu) * std::cos(theta));
+        prototype.poles.push_back(pole);
+        prototype.poles.push_back(std::conj(pole));
+    }
+    if(order % 2 == 1)
+    {
+        prototype.poles.push_back(-1 / std::sinh(mu));
+    }
+
+    Complex product = 1;
+    for(const Complex& pole : prototype.poles)
+    {
+        product *= -pole;
+    }
+    for(const Complex& zero : prototype.zeros)
+    {
+        product /= -zero;
+    }
+    prototype.gain = product.real();
+    return prototype;
+}
+
+PoleZeroSet AnalogPrototype::Elliptic(int order, highprecision ripple, highprecision attenuation)
+{
+    if(order < 1)
+    {
+        throw std::runtime_error("The order of a prototype has to be at least 1.");
+    }
+    if(!(ripple > 0) || !(attenuation > ripple))
+    {
+        throw std::runtime_error("The passband ripple has to be positive and below the stopband attenuation.");
+    }
+
+    // The selectivity k = 1 / ws follows from the order and the discrimination k1 = ep / es (degree equation)
+    highprecision passbandEpsilon = std::sqrt(std::pow(10.0L, ripple / 10) - 1);
+    highprecision stopbandEpsilon = std::sqrt(std::pow(10.0L, attenuation / 10) - 1);
+    highprecision k1 = passbandEpsilon / stopbandEpsilon;
+    highprecision k = AnalogPrototype::SolveDegreeEquation(order, k1);
+
+    // Zeros j / (k cd(u_i K)), poles j cd((u_i - j v0) K) and j sn(j v0 K) for odd orders, u_i = (2i - 1) / n
+    Complex v0 = Complex(0, -1) * AnalogPrototype::InverseSn(Complex(0, 1 / passbandEpsilon), k1) / (highprecision)order;
+    PoleZeroSet prototype{ .zeros = {}, .poles = {}, .gain = 1 };
+    for(int i = 1; i <= order / 2; i++)
+    {
+        highprecision u = (highprecision)(2 * i - 1) / order;
+        Complex zero = Complex(0, 1) / (k * AnalogPrototype::EvaluateCd(u, k));
+        zero = Complex(0, std::abs(zero.imag()));
+        prototype.zeros.push_back(zero);
+        prototype.zeros.push_back(std::conj(zero));
+        Complex pole = Complex(0, 1) * AnalogPrototype::EvaluateCd(u - Complex(0, 1) * v0, k);
+        pole = Complex(-std::abs(pole.real()), std::abs(pole.imag()));
+        prototype.poles.push_back(pole);
+        prototype.poles.push_back(std::conj(pole));
+    }
+    if(order % 2 == 1)
+    {
+        Complex pole = Complex(0, 1) * AnalogPrototype::EvaluateSn(Complex(0, 1) * v0, k);
+        prototype.poles.push_back(-std::abs(pole.real()));
+    }
+
+    Complex product = 1;
+    for(const Complex& pole : prototype.poles)
+    {
+        product *= -pole;
+    }
+    for(const Complex& zero : prototype.zeros)
+    {
+        product /= -zero;
+    }
+    prototype.gain = product.real() * ((order % 2 == 1) ? 1 : 1 / std::sqrt(1 + passbandEpsilon * passbandEpsilon));
+    return prototype;
+}
+
+PoleZeroSet AnalogPrototype::Bessel(int order)
+{
+    if(order < 1)
+    {
+        throw std::runtime_error("The order of a prototype has to be at least 1.");
+    }
+
+    CoefficientList coefficients = AnalogPrototype::GetBesselCoefficients(order);
+    return PoleZeroSet
+    {
+        .zeros = {},
+        .poles = Polynomial::FindComplexZeros(Polynomial(coefficients)),
+        .gain = coefficients.back()
+    };
+}
+
+PolynomialFraction AnalogPrototype::ToTransferFunction(const PoleZeroSet& prototype)
+{
+    return PolynomialFraction
+    {
+        .numerator = Polynomial::FromZeros(prototype.zeros, prototype.gain),
+        .denominator = Polynomial::FromZeros(prototype.poles)
+    };
+}
+
+size_t AnalogPrototype::GetCacheSize()
+{
+    std::lock_guard<std::mutex> lock(AnalogPrototype::CacheMutex);
+    return AnalogPrototype::Cache.size();
+}
+
+void AnalogPrototype::ClearCache()
+{
+    std::lock_guard<std::mutex> lock(AnalogPrototype::CacheMutex);
+    AnalogPrototype::Cache.clear();
+}
+
+/* Private Methods ***********************************************************/
+
+AnalogPrototype::CacheEntry AnalogPrototype::Lookup(PrototypeType type, int order, highprecision ripple, highprecision attenuation)
+{
+    // Parameters which the type does not use must not split the cache
+    bool usesRipple = (type == PrototypeType::ChebyshevI || type == PrototypeType::Elliptic);
+    bool usesAttenuation = (type == PrototypeType::ChebyshevII || type == PrototypeType::Elliptic);
+    CacheKey key(type, order, usesRipple ? ripple : 0, usesAttenuation ? attenuation : 0);
+    {
+        std::lock_guard<std::mutex> lock(AnalogPrototype::CacheMutex);
+        auto found = AnalogPrototype::Cache.find(key);
+        if(found != AnalogPrototype::Cache.end())
+        {
+            return found->second;
+        }
+    }
+
+    // Designed without holding the lock, if two threads race for the same prototype, both results are equal
+    CacheEntry entry;
+    switch(type)
+    {
+        case PrototypeType::Butterworth:
+            entry.Prototype = AnalogPrototype::Butterworth(order);
+            break;
+        case PrototypeType::ChebyshevI:
+            entry.Prototype = AnalogPrototype::ChebyshevI(order, ripple);
+            break;
+        case PrototypeType::ChebyshevII:
+            entry.Prototype = AnalogPrototype::ChebyshevII(order, attenuation);
+            break;
+        case PrototypeType::Elliptic:
+            entry.Prototype = AnalogPrototype::Elliptic(order, ripple, attenuation);
+            break;
+        case PrototypeType::Bessel:
+            entry.Prototype = AnalogPrototype::Bessel(order);
+            break;
+    }
+    if(type == PrototypeType::Bessel)
+    {
+        // The exact coefficients instead of the ones expanded from the approximated poles
+        CoefficientList coefficients = AnalogPrototype::GetBesselCoefficients(order);
+        entry.TransferFunction = PolynomialFraction{ .numerator = Polynomial(CoefficientList{coefficients.back()}), .denominator = Polynomial(coefficients) };
+    }
+    else
+    {
+        entry.TransferFunction = AnalogPrototype::ToTransferFunction(entry.Prototype);
+    }
+
+    std::lock_guard<std::mutex> lock(AnalogPrototype::CacheMutex);
+    if(AnalogPrototype::Cache.size() >= AnalogPrototype::CACHE_MAX_SIZE)
+    {
+        AnalogPrototype::Cache.clear();
+    }
+    AnalogPrototype::Cache.emplace(key, entry);
+    return entry;
+}
+
+CoefficientList AnalogPrototype::GetBesselCoefficients(int order)
+{
+    // Reverse bessel polynomial, a_k = (2n - k)! / (2^(n - k) k! (n - k)!), so a_(k-1) = a_k k (2n - k + 1) / (2 (n - k + 1))
+    CoefficientList coefficients{1};
+    highprecision a = 1;
+    for(int k = order; k > 0; k--)
+    {
+        a *= (highprecision)k * (2 * order - k + 1) / (2 * (order - k + 1));
+        coefficients.push_back(a);
+    }
+    return coefficients;
+}
+
+std::vector<highprecision> AnalogPrototype::GetLandenSequence(highprecision modulus)
+{
+    // Descending landen transformation k_n = (k_(n-1) / (1 + k'_(n-1)))^2, which converges to 0 quadratically
+    std::vector<highprecision> sequence;
+    highprecision k = modulus;
+    for(int i = 0; i < AnalogPrototype::LANDEN_MAX_ITERATIONS && k > std::numeric_limits<highprecision>::epsilon(); i++)
+    {
+        highprecision complement = std::sqrt((1 - k) * (1 + k));
+        k = (k / (1 + complement)) * (k / (1 + complement));
+        sequence.push_back(k);
+    }
+    return sequence;
+}
+
+highprecision AnalogPrototype::GetQuarterPeriod(highprecision modulus)
+{
+    // K = pi / 2 * prod (1 + k_n)
+    highprecision quarterPeriod = std::numbers::pi_v<highprecision> / 2;
+    for(highprecision k : AnalogPrototype::GetLandenSequence(modulus))
+    {
+        quarterPeriod *= 1 + k;
+    }
+    return quarterPeriod;
+}
+
+AnalogPrototype::Complex AnalogPrototype::EvaluateCd(Complex u, highprecision modulus)
+{
+    // cd(u K, k) by ascending from cos(u pi / 2), the limit for k = 0
+    std::vector<highprecision> sequence = AnalogPrototype::GetLandenSequence(modulus);
+    Complex w = std::cos(u * std::numbers::pi_v<highprecision> / 2.0L);
+    for(size_t n = sequence.size(); n-- > 0;)
+    {
+        w = (1 + sequence[n]) * w / (1.0L + sequence[n] * w * w);
+    }
+    return w;
+}
+
+AnalogPrototype::Complex AnalogPrototype::EvaluateSn(Complex u, highprecision modulus)
+{
+    // sn(u K, k) by ascending from sin(u pi / 2)
+    std::vector<highprecision> sequence = AnalogPrototype::GetLandenSequence(modulus);
+    Complex w = std::sin(u * std::numbers::pi_v<highprecision> / 2.0L);
+    for(size_t n = sequence.size(); n-- > 0;)
+    {
+        w = (1 + sequence[n]) * w / (1.0L + sequence[n] * w * w);
+    }
+    return w;
+}
+
+AnalogPrototype::Complex AnalogPrototype::InverseCd(Complex w, highprecision modulus)
+{
+    // Descending to k = 0, where cd(u K) = cos(u pi / 2)
+    std::vector<highprecision> sequence = AnalogPrototype::GetLandenSequence(modulus);
+    highprecision previous = modulus;
+    for(highprecision k : sequence)
+    {
+        w = w / (1.0L + std::sqrt(1.0L - w * w * previous * previous)) * (2 / (1 + k));
+        previous = k;
+    }
+    Complex u = std::acos(w) * (2 / std::numbers::pi_v<highprecision>);
+
+    // Reduced into the fundamental period rectangle, 4 in the real and 2 K' / K in the imaginary direction
+    highprecision complementaryModulus = std::sqrt((1 - modulus) * (1 + modulus));
+    highprecision ratio = AnalogPrototype::GetQuarterPeriod(complementaryModulus) / AnalogPrototype::GetQuarterPeriod(modulus);
+    auto symmetricRemainder = [](highprecision x, highprecision period)
+    {
+        return x - period * std::round(x / period);
+    };
+    return Complex(symmetricRemainder(u.real(), 4), symmetricRemainder(u.imag(), 2 * ratio));
+}
+
+AnalogPrototype::Complex AnalogPrototype::InverseSn(Complex w, highprecision modulus)
+{
+    // sn(u K) = cd((1 - u) K)
+    return 1.0L - AnalogPrototype::InverseCd(w, modulus);
+}
+
+highprecision AnalogPrototype::SolveDegreeEquation(int order, highprecision modulus)
+{
+    // k' = k1'^n prod sn(u_i K', k1')^4, u_i = (2i - 1) / n
+    highprecision complement = std::sqrt((1 - modulus) * (1 + modulus));
+    highprecision result = std::pow(complement, (highprecision)order);
+    for(int i = 1; i <= order / 2; i++)
+    {
+        highprecision sn = AnalogPrototype::EvaluateSn((highprecision)(2 * i - 1) / order, complement).real();
+        result *= sn * sn * sn * sn;
+    }
+    return std::sqrt((1 - result) * (1 + result));
+}
+
+} // namespace Vath
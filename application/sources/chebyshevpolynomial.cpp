@@ -0,0 +1,388 @@
+#include "../headers/chebyshevpolynomial.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include <algorithm>
+#include <numbers>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+ChebyshevPolynomial::ChebyshevPolynomial() :
+    Coefficients(std::vector<highprecision>{0}),
+    Domain(Interval(-1, 1))
+{
+}
+
+ChebyshevPolynomial::ChebyshevPolynomial(const std::vector<highprecision>& coefficients, const Interval& domain) :
+    Coefficients(coefficients),
+    Domain(domain)
+{
+    if(!(domain.Lower < domain.Upper) || std::isinf(domain.Lower) || std::isinf(domain.Upper))
+    {
+        throw std::runtime_error("The domain of a chebyshev polynomial has to be a finite interval of non-zero width.");
+    }
+    if(this->Coefficients.empty())
+    {
+        this->Coefficients.push_back(0);
+    }
+}
+
+ChebyshevPolynomial::ChebyshevPolynomial(const ChebyshevPolynomial& original) :
+    Coefficients(original.Coefficients),
+    Domain(original.Domain)
+{
+}
+
+/* Accessors/Mutators ********************************************************/
+
+std::vector<highprecision> ChebyshevPolynomial::GetCoefficients() const
+{
+    return this->Coefficients;
+}
+
+Interval ChebyshevPolynomial::GetDomain() const
+{
+    return this->Domain;
+}
+
+int ChebyshevPolynomial::GetOrder() const
+{
+    return this->Coefficients.size() - 1;
+}
+
+std::vector<highprecision> ChebyshevPolynomial::GetValues() const
+{
+    size_t n = this->Coefficients.size() - 1;
+    if(n == 0)
+    {
+        return this->Coefficients;
+    }
+
+    // p(cos(pi j / n)) = sum_k c_k cos(pi jk / n), which is half the DCT-I of c with doubled end coefficients
+    std::vector<highprecision> coefficients(this->Coefficients);
+    coefficients[0] *= 2;
+    coefficients[n] *= 2;
+    std::vector<highprecision> values = FastFourierTransform<highprecision>::DiscreteCosineTransform(coefficients);
+    for(highprecision& value : values)
+    {
+        value /= 2;
+    }
+    // The transform yields the values for descending points
+    std::reverse(values.begin(), values.end());
+    return values;
+}
+
+/* Operators *****************************************************************/
+
+// For toString() method
+std::ostream& operator <<(std::ostream& os, const ChebyshevPolynomial& polynomial)
+{
+    os  << std::scientific
+        << std::setprecision(18);
+    for(size_t k = 0; k < polynomial.Coefficients.size(); k++)
+    {
+        if(k > 0)
+        {
+            os << " + ";
+        }
+        os << polynomial.Coefficients[k] << "*T" << k;
+    }
+    os << " on " << polynomial.Domain;
+    return os;
+}
+
+bool ChebyshevPolynomial::operator ==(const ChebyshevPolynomial& other) const
+{
+    return this->IsEqual(other);
+}
+
+bool ChebyshevPolynomial::operator !=(const ChebyshevPolynomial& other) const
+{
+    return !this->IsEqual(other);
+}
+
+ChebyshevPolynomial& ChebyshevPolynomial::operator =(const ChebyshevPolynomial& right)
+{
+    this->Coefficients = right.Coefficients;
+    this->Domain = right.Domain;
+    return *this;
+}
+
+/* Public Methods ************************************************************/
+
+highprecision ChebyshevPolynomial::EvaluateAt(highprecision x) const
+{
+    // Clenshaw: b_k = c_k + 2t b_(k+1) - b_(k+2), p = c_0 + t b_1 - b_2
+    highprecision t = this->MapToUnitInterval(x);
+    highprecision b1 = 0, b2 = 0;
+    for(size_t k = this->Coefficients.size() - 1; k > 0; k--)
+    {
+        highprecision b0 = this->Coefficients[k] + 2 * t * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return this->Coefficients[0] + t * b1 - b2;
+}
+
+std::vector<highprecision> ChebyshevPolynomial::EvaluateAt(const std::vector<highprecision>& x) const
+{
+    constexpr size_t lanes = ChebyshevPolynomial::BATCH_LANES;
+    std::vector<highprecision> y(x.size());
+    size_t blocks = x.size() / lanes;
+    for(size_t block = 0; block < blocks; block++)
+    {
+        highprecision t[lanes], b1[lanes], b2[lanes];
+        for(size_t lane = 0; lane < lanes; lane++)
+        {
+            t[lane] = this->MapToUnitInterval(x[block * lanes + lane]);
+            b1[lane] = 0;
+            b2[lane] = 0;
+        }
+        for(size_t k = this->Coefficients.size() - 1; k > 0; k--)
+        {
+            highprecision c = this->Coefficients[k];
+            for(size_t lane = 0; lane < lanes; lane++)
+            {
+                highprecision b0 = c + 2 * t[lane] * b1[lane] - b2[lane];
+                b2[lane] = b1[lane];
+                b1[lane] = b0;
+            }
+        }
+        for(size_t lane = 0; lane < lanes; lane++)
+        {
+            y[block * lanes + lane] = this->Coefficients[0] + t[lane] * b1[lane] - b2[lane];
+        }
+    }
+    for(size_t i = blocks * lanes; i < x.size(); i++)
+    {
+        y[i] = this->EvaluateAt(x[i]);
+    }
+    return y;
+}
+
+void ChebyshevPolynomial::Differentiate()
+{
+    size_t n = this->Coefficients.size() - 1;
+    if(n == 0)
+    {
+        this->Coefficients = std::vector<highprecision>{0};
+        return;
+    }
+
+    // d_(k-1) = d_(k+1) + 2k c_k, and d_0 is halved at the end
+    std::vector<highprecision> derivative(n + 2, 0);
+    for(size_t k = n; k > 0; k--)
+    {
+        derivative[k - 1] = derivative[k + 1] + 2 * k * this->Coefficients[k];
+    }
+    derivative[0] /= 2;
+    derivative.resize(n);
+
+    // Chain rule for t = (2x - a - b) / (b - a)
+    highprecision scale = 2 / this->Domain.GetWidth();
+    for(highprecision& c : derivative)
+    {
+        c *= scale;
+    }
+    this->Coefficients = derivative;
+}
+
+ChebyshevPolynomial ChebyshevPolynomial::Differentiate(const ChebyshevPolynomial& p)
+{
+    ChebyshevPolynomial derivative(p);
+    derivative.Differentiate();
+    return derivative;
+}
+
+void ChebyshevPolynomial::Integrate()
+{
+    size_t n = this->Coefficients.size() - 1;
+    auto c = [this, n](size_t k) { return (k <= n) ? this->Coefficients[k] : 0; };
+
+    // Integral of T_0 is T_1, of T_1 is T_2 / 4, of T_k is T_(k+1) / (2(k+1)) - T_(k-1) / (2(k-1))
+    std::vector<highprecision> integral(n + 2, 0);
+    integral[1] = c(0) - c(2) / 2;
+    for(size_t k = 2; k <= n + 1; k++)
+    {
+        integral[k] = (c(k - 1) - c(k + 1)) / (2 * k);
+    }
+
+    highprecision scale = this->Domain.GetWidth() / 2;
+    highprecision valueAtLowerLimit = 0;
+    for(size_t k = 1; k < integral.size(); k++)
+    {
+        integral[k] *= scale;
+        // T_k(-1) = (-1)^k
+        valueAtLowerLimit += (k % 2 == 0) ? integral[k] : -integral[k];
+    }
+    integral[0] = -valueAtLowerLimit;
+    this->Coefficients = integral;
+}
+
+ChebyshevPolynomial ChebyshevPolynomial::Integrate(const ChebyshevPolynomial& p)
+{
+    ChebyshevPolynomial integral(p);
+    integral.Integrate();
+    return integral;
+}
+
+highprecision ChebyshevPolynomial::GetArea(highprecision lowerLimit, highprecision upperLimit) const
+{
+    ChebyshevPolynomial integral = ChebyshevPolynomial::Integrate(*this);
+    return integral.EvaluateAt(upperLimit) - integral.EvaluateAt(lowerLimit);
+}
+
+Polynomial ChebyshevPolynomial::ToPolynomial() const
+{
+    // Clenshaw with polynomials in x (lowest order first) instead of numbers, t = slope * x + offset
+    highprecision slope = 2 / this->Domain.GetWidth();
+    highprecision offset = -(this->Domain.Lower + this->Domain.Upper) / this->Domain.GetWidth();
+    size_t n = this->Coefficients.size() - 1;
+
+    auto multiplyByT = [slope, offset](const std::vector<highprecision>& p)
+    {
+        std::vector<highprecision> product(p.size() + 1, 0);
+        for(size_t i = 0; i < p.size(); i++)
+        {
+            product[i] += offset * p[i];
+            product[i + 1] += slope * p[i];
+        }
+        return product;
+    };
+
+    std::vector<highprecision> b1(n + 1, 0), b2(n + 1, 0);
+    for(size_t k = n; k > 0; k--)
+    {
+        std::vector<highprecision> b0 = multiplyByT(b1);
+        b0.resize(n + 1);
+        for(size_t i = 0; i <= n; i++)
+        {
+            b0[i] = 2 * b0[i] - b2[i];
+        }
+        b0[0] += this->Coefficients[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    std::vector<highprecision> result = multiplyByT(b1);
+    result.resize(n + 1);
+    for(size_t i = 0; i <= n; i++)
+    {
+        result[i] -= b2[i];
+    }
+    result[0] += this->Coefficients[0];
+
+    return Polynomial(CoefficientList(result.rbegin(), result.rend()));
+}
+
+ChebyshevPolynomial ChebyshevPolynomial::FromPolynomial(const Polynomial& function, const Interval& domain)
+{
+    // Horner in the chebyshev basis: p = (...(a_n x + a_(n-1)) x + ...) + a_0, with x = halfWidth * t + center
+    // and t T_0 = T_1, t T_k = (T_(k+1) + T_(k-1)) / 2
+    CoefficientList coefficients = function.GetCoefficients();
+    highprecision halfWidth = domain.GetWidth() / 2;
+    highprecision center = domain.GetMidpoint();
+
+    std::vector<highprecision> result{coefficients[0]};
+    for(size_t i = 1; i < coefficients.size(); i++)
+    {
+        std::vector<highprecision> product(result.size() + 1, 0);
+        for(size_t k = 0; k < result.size(); k++)
+        {
+            product[k] += center * result[k];
+            if(k == 0)
+            {
+                product[1] += halfWidth * result[0];
+            }
+            else
+            {
+                product[k + 1] += halfWidth * result[k] / 2;
+                product[k - 1] += halfWidth * result[k] / 2;
+            }
+        }
+        product[0] += coefficients[i];
+        result = product;
+    }
+    return ChebyshevPolynomial(result, domain);
+}
+
+ChebyshevPolynomial ChebyshevPolynomial::FromValues(const std::vector<highprecision>& values, const Interval& domain)
+{
+    if(values.empty())
+    {
+        throw std::runtime_error("At least one value is needed.");
+    }
+    size_t n = values.size() - 1;
+    if(n == 0)
+    {
+        return ChebyshevPolynomial(values, domain);
+    }
+
+    // c_k = DCT-I(v)_k / n for the values at the descending points cos(pi j / n), c_0 and c_n halved
+    std::vector<highprecision> descending(values.rbegin(), values.rend());
+    std::vector<highprecision> coefficients = FastFourierTransform<highprecision>::DiscreteCosineTransform(descending);
+    for(highprecision& c : coefficients)
+    {
+        c /= n;
+    }
+    coefficients[0] /= 2;
+    coefficients[n] /= 2;
+    return ChebyshevPolynomial(coefficients, domain);
+}
+
+ChebyshevPolynomial ChebyshevPolynomial::Interpolate(const std::function<highprecision(highprecision)>& function, int order, const Interval& domain)
+{
+    std::vector<highprecision> points = ChebyshevPolynomial::GetChebyshevPoints(order, domain);
+    std::vector<highprecision> values(points.size());
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        values[j] = function(points[j]);
+    }
+    return ChebyshevPolynomial::FromValues(values, domain);
+}
+
+std::vector<highprecision> ChebyshevPolynomial::GetChebyshevPoints(int order, const Interval& domain)
+{
+    if(order < 0)
+    {
+        throw std::runtime_error("The order must not be negative.");
+    }
+    if(order == 0)
+    {
+        return std::vector<highprecision>{domain.GetMidpoint()};
+    }
+
+    // -cos(pi j / n) = sin(pi (2j - n) / 2n), the latter is exactly symmetric around 0
+    std::vector<highprecision> points(order + 1);
+    highprecision halfWidth = domain.GetWidth() / 2;
+    highprecision center = domain.GetMidpoint();
+    for(int j = 0; j <= order; j++)
+    {
+        highprecision t = std::sin(std::numbers::pi_v<highprecision> * (2 * j - order) / (2 * order));
+        points[j] = center + halfWidth * t;
+    }
+    points.front() = domain.Lower;
+    points.back() = domain.Upper;
+    return points;
+}
+
+std::string ChebyshevPolynomial::to_string() const
+{
+    return this->toString();
+}
+
+bool ChebyshevPolynomial::IsEqual(const ChebyshevPolynomial& other) const
+{
+    return (this->Coefficients == other.Coefficients) && (this->Domain == other.Domain);
+}
+
+/* Private Methods ***********************************************************/
+
+highprecision ChebyshevPolynomial::MapToUnitInterval(highprecision x) const
+{
+    return (2 * x - this->Domain.Lower - this->Domain.Upper) / this->Domain.GetWidth();
+}
+
+} // namespace Vath
@@ -0,0 +1,305 @@
+#include "../headers/discretization.hpp"
+#include <algorithm>
+#include <numbers>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+PolynomialFraction Discretization::Bilinear(const PolynomialFraction& analog, highprecision sampleRate)
+{
+    return Discretization::Discretize(analog, sampleRate, DiscretizationMethod::Bilinear, 0);
+}
+
+PolynomialFraction Discretization::Bilinear(const PolynomialFraction& analog, highprecision sampleRate, highprecision prewarpFrequency)
+{
+    return Discretization::Discretize(analog, sampleRate, DiscretizationMethod::Bilinear, prewarpFrequency);
+}
+
+PolynomialFraction Discretization::MatchedZ(const PolynomialFraction& analog, highprecision sampleRate)
+{
+    return Discretization::Discretize(analog, sampleRate, DiscretizationMethod::MatchedZ, 0);
+}
+
+PolynomialFraction Discretization::ImpulseInvariance(const PolynomialFraction& analog, highprecision sampleRate)
+{
+    return Discretization::Discretize(analog, sampleRate, DiscretizationMethod::ImpulseInvariance, 0);
+}
+
+PolynomialFraction Discretization::Discretize(const PolynomialFraction& analog, highprecision sampleRate, DiscretizationMethod method, highprecision prewarpFrequency)
+{
+    return Discretization::Discretize(Discretization::Analyze(analog, method), sampleRate, method, prewarpFrequency);
+}
+
+std::vector<PolynomialFraction> Discretization::Discretize(const PolynomialFraction& analog, const std::vector<highprecision>& sampleRates, DiscretizationMethod method, TaskPool& pool, highprecision prewarpFrequency)
+{
+    AnalogPoleZero analysis = Discretization::Analyze(analog, method);
+    std::vector<PolynomialFraction> results(sampleRates.size());
+    pool.ParallelFor(sampleRates.size(), [&](size_t i)
+    {
+        results[i] = Discretization::Discretize(analysis, sampleRates[i], method, prewarpFrequency);
+    });
+    return results;
+}
+
+std::vector<PolynomialFraction> Discretization::Discretize(const PolynomialFraction& analog, const std::vector<highprecision>& sampleRates, DiscretizationMethod method, highprecision prewarpFrequency)
+{
+    TaskPool pool;
+    return Discretization::Discretize(analog, sampleRates, method, pool, prewarpFrequency);
+}
+
+/* Private Methods ***********************************************************/
+
+Discretization::AnalogPoleZero Discretization::Analyze(const PolynomialFraction& analog, DiscretizationMethod method)
+{
+    AnalogPoleZero analysis;
+    analysis.Numerator = Polynomial::TrimCoefficients(analog.numerator.GetCoefficients(), 0);
+    analysis.Denominator = Polynomial::TrimCoefficients(analog.denominator.GetCoefficients(), 0);
+    if(analysis.Denominator.size() == 1 && analysis.Denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator of a transfer function must not be 0.");
+    }
+    if(analysis.Numerator.size() > analysis.Denominator.size())
+    {
+        throw std::runtime_error("An improper transfer function (deg N > deg D) can not be discretized.");
+    }
+
+    switch(method)
+    {
+        case DiscretizationMethod::Bilinear:
+            break;
+
+        case DiscretizationMethod::MatchedZ:
+            analysis.Poles = Polynomial::FindComplexZeros(Polynomial(analysis.Denominator));
+            if(analysis.Numerator.size() > 1 || analysis.Numerator[0] != 0)
+            {
+                analysis.Zeros = Polynomial::FindComplexZeros(Polynomial(analysis.Numerator));
+            }
+            break;
+
+        case DiscretizationMethod::ImpulseInvariance:
+        {
+            if(analysis.Numerator.size() == analysis.Denominator.size())
+            {
+                throw std::runtime_error("Impulse invariance needs a strictly proper transfer function (deg N < deg D).");
+            }
+            analysis.Poles = Polynomial::FindComplexZeros(Polynomial(analysis.Denominator));
+            for(size_t i = 0; i < analysis.Poles.size(); i++)
+            {
+                for(size_t j = i + 1; j < analysis.Poles.size(); j++)
+                {
+                    highprecision scale = std::max<highprecision>(1, std::abs(analysis.Poles[i]));
+                    if(std::abs(analysis.Poles[i] - analysis.Poles[j]) <= Discretization::SIMPLE_POLE_TOLERANCE * scale)
+                    {
+                        throw std::runtime_error("Impulse invariance needs a transfer function with simple poles.");
+                    }
+                }
+            }
+
+            // r_i = N(p_i) / D'(p_i)
+            CoefficientList derivative = Polynomial::Differentiate(Polynomial(analysis.Denominator)).GetCoefficients();
+            for(const Complex& pole : analysis.Poles)
+            {
+                analysis.Residues.push_back(Discretization::EvaluateAt(analysis.Numerator, pole) / Discretization::EvaluateAt(derivative, pole));
+            }
+            break;
+        }
+    }
+    return analysis;
+}
+
+PolynomialFraction Discretization::Discretize(const AnalogPoleZero& analog, highprecision sampleRate, DiscretizationMethod method, highprecision prewarpFrequency)
+{
+    if(!(sampleRate > 0))
+    {
+        throw std::runtime_error("The sample rate has to be positive.");
+    }
+
+    switch(method)
+    {
+        case DiscretizationMethod::Bilinear:
+        {
+            highprecision k = 2 * sampleRate;
+            if(prewarpFrequency != 0)
+            {
+                if(!(prewarpFrequency > 0 && prewarpFrequency < std::numbers::pi_v<highprecision> * sampleRate))
+                {
+                    throw std::runtime_error("The prewarp frequency has to lie between 0 and pi times the sample rate.");
+                }
+                k = prewarpFrequency / std::tan(prewarpFrequency / (2 * sampleRate));
+            }
+            return Discretization::Bilinear(analog.Numerator, analog.Denominator, k);
+        }
+
+        case DiscretizationMethod::MatchedZ:
+            return Discretization::MatchedZ(analog, sampleRate);
+
+        case DiscretizationMethod::ImpulseInvariance:
+            return Discretization::ImpulseInvariance(analog, sampleRate);
+    }
+    throw std::runtime_error("Unknown discretization method.");
+}
+
+PolynomialFraction Discretization::Bilinear(const CoefficientList& numerator, const CoefficientList& denominator, highprecision k)
+{
+    // Both are multiplied by the same (z + 1)^n, n = deg D, which cancels in the fraction
+    int order = denominator.size() - 1;
+    return Discretization::Normalize(
+        Discretization::SubstituteBilinear(numerator, order, k),
+        Discretization::SubstituteBilinear(denominator, order, k));
+}
+
+CoefficientList Discretization::SubstituteBilinear(const CoefficientList& coefficients, int order, highprecision k)
+{
+    // (z + 1)^n P(k (z - 1) / (z + 1)) with (z - 1) / (z + 1) = 1 - 2 / (z + 1):
+    // 1. Q(s) = P(k s)
+    // 2. R(t) = Q(1 - 2t), a taylor shift by 1 followed by a scaling by -2
+    // 3. w^n R(1 / w), the coefficients reversed and padded to order n
+    // 4. w = z + 1, another taylor shift by 1
+    CoefficientList q(coefficients);
+    highprecision power = 1;
+    for(size_t i = q.size(); i-- > 0;)
+    {
+        q[i] *= power;
+        power *= k;
+    }
+
+    CoefficientList r = Polynomial::TaylorShiftCoefficients(q, 1);
+    power = 1;
+    for(size_t i = r.size(); i-- > 0;)
+    {
+        r[i] *= power;
+        power *= -2;
+    }
+
+    CoefficientList reversed(r.rbegin(), r.rend());
+    reversed.resize(order + 1, 0);
+    return Polynomial::TaylorShiftCoefficients(reversed, 1);
+}
+
+PolynomialFraction Discretization::MatchedZ(const AnalogPoleZero& analog, highprecision sampleRate)
+{
+    highprecision period = 1 / sampleRate;
+    std::vector<Complex> zeros, poles;
+    for(const Complex& zero : analog.Zeros)
+    {
+        zeros.push_back(std::exp(zero * period));
+    }
+    for(const Complex& pole : analog.Poles)
+    {
+        poles.push_back(std::exp(pole * period));
+    }
+    // Zeros at infinity are mapped to the nyquist frequency
+    while(zeros.size() < poles.size())
+    {
+        zeros.push_back(-1);
+    }
+    CoefficientList numerator = Polynomial::FromZeros(zeros).GetCoefficients();
+    CoefficientList denominator = Polynomial::FromZeros(poles).GetCoefficients();
+
+    // Match the gain at DC (s = 0, z = 1) if possible, otherwise the magnitude at fs / 4 (s = j pi fs / 2, z = j)
+    highprecision gain;
+    if(analog.Numerator.back() != 0 && analog.Denominator.back() != 0)
+    {
+        highprecision analogValue = analog.Numerator.back() / analog.Denominator.back();
+        gain = analogValue / std::real(Discretization::EvaluateAt(numerator, 1) / Discretization::EvaluateAt(denominator, 1));
+    }
+    else
+    {
+        Complex s(0, std::numbers::pi_v<highprecision> * sampleRate / 2);
+        Complex z(0, 1);
+        highprecision analogMagnitude = std::abs(Discretization::EvaluateAt(analog.Numerator, s) / Discretization::EvaluateAt(analog.Denominator, s));
+        highprecision digitalMagnitude = std::abs(Discretization::EvaluateAt(numerator, z) / Discretization::EvaluateAt(denominator, z));
+        gain = analogMagnitude / digitalMagnitude;
+    }
+    if(!std::isfinite(gain))
+    {
+        throw std::runtime_error("The gain of the matched-z transform could not be matched.");
+    }
+
+    for(highprecision& c : numerator)
+    {
+        c *= gain;
+    }
+    return Discretization::Normalize(numerator, denominator);
+}
+
+PolynomialFraction Discretization::ImpulseInvariance(const AnalogPoleZero& analog, highprecision sampleRate)
+{
+    highprecision period = 1 / sampleRate;
+    size_t order = analog.Poles.size();
+
+    // A(z) = prod (z - q_j), q_j = e^(p_j T), lowest order first
+    std::vector<Complex> denominator{1};
+    std::vector<Complex> mapped;
+    for(const Complex& pole : analog.Poles)
+    {
+        Complex q = std::exp(pole * period);
+        mapped.push_back(q);
+        denominator.push_back(0);
+        for(size_t j = denominator.size() - 1; j > 0; j--)
+        {
+            denominator[j] = denominator[j - 1] - q * denominator[j];
+        }
+        denominator[0] *= -q;
+    }
+
+    // B(z) = T z sum r_i A(z) / (z - q_i), every quotient by synthetic division
+    std::vector<Complex> numerator(order, 0);
+    std::vector<Complex> quotient(order, 0);
+    for(size_t i = 0; i < order; i++)
+    {
+        quotient[order - 1] = denominator[order];
+        for(size_t j = order - 1; j > 0; j--)
+        {
+            quotient[j - 1] = denominator[j] + mapped[i] * quotient[j];
+        }
+        for(size_t j = 0; j < order; j++)
+        {
+            numerator[j] += analog.Residues[i] * quotient[j];
+        }
+    }
+
+    CoefficientList b, a;
+    for(size_t j = order; j-- > 0;)
+    {
+        b.push_back(period * numerator[j].real());
+    }
+    b.push_back(0);
+    for(size_t j = order + 1; j-- > 0;)
+    {
+        a.push_back(denominator[j].real());
+    }
+    return Discretization::Normalize(b, a);
+}
+
+Discretization::Complex Discretization::EvaluateAt(const CoefficientList& coefficients, Complex x)
+{
+    Complex value = 0;
+    for(highprecision c : coefficients)
+    {
+        value = value * x + c;
+    }
+    return value;
+}
+
+PolynomialFraction Discretization::Normalize(const CoefficientList& numerator, const CoefficientList& denominator)
+{
+    CoefficientList a = Polynomial::TrimCoefficients(denominator, 0);
+    CoefficientList b(numerator);
+    highprecision leadingCoefficient = a[0];
+    for(highprecision& c : a)
+    {
+        c /= leadingCoefficient;
+    }
+    for(highprecision& c : b)
+    {
+        c /= leadingCoefficient;
+    }
+    return PolynomialFraction{ .numerator = Polynomial(b), .denominator = Polynomial(a) };
+}
+
+} // namespace Vath
@@ -0,0 +1,243 @@
+#include "../headers/fastfouriertransform.hpp"
+#include <algorithm>
+#include <numbers>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+template<typename T>
+void FastFourierTransform<T>::Transform(std::vector<std::complex<T>>& data, bool inverse)
+{
+    size_t n = data.size();
+    if(n <= 1)
+    {
+        return;
+    }
+
+    if((n & (n - 1)) == 0)
+    {
+        FastFourierTransform<T>::TransformPowerOfTwo(data, inverse);
+    }
+    else
+    {
+        FastFourierTransform<T>::TransformBluestein(data, inverse);
+    }
+
+    if(inverse)
+    {
+        for(std::complex<T>& value : data)
+        {
+            value /= (T)n;
+        }
+    }
+}
+
+template<typename T>
+std::vector<T> FastFourierTransform<T>::DiscreteCosineTransform(const std::vector<T>& values)
+{
+    if(values.size() <= 1)
+    {
+        return values;
+    }
+
+    // The DCT-I of v is the DFT of the even extension v_0, ..., v_N, v_(N-1), ..., v_1 of length 2N
+    size_t n = values.size() - 1;
+    std::vector<std::complex<T>> extended(2 * n);
+    for(size_t j = 0; j <= n; j++)
+    {
+        extended[j] = values[j];
+    }
+    for(size_t j = 1; j < n; j++)
+    {
+        extended[2 * n - j] = values[j];
+    }
+    FastFourierTransform<T>::Transform(extended);
+
+    std::vector<T> transformed(n + 1);
+    for(size_t k = 0; k <= n; k++)
+    {
+        transformed[k] = extended[k].real();
+    }
+    return transformed;
+}
+
+template<typename T>
+std::vector<T> FastFourierTransform<T>::Convolve(const std::vector<T>& left, const std::vector<T>& right)
+{
+    if(left.empty() || right.empty())
+    {
+        return std::vector<T>();
+    }
+
+    size_t length = left.size() + right.size() - 1;
+    if(std::min(left.size(), right.size()) <= FastFourierTransform<T>::DIRECT_CONVOLUTION_MAX_LENGTH)
+    {
+        std::vector<T> result(length, 0);
+        for(size_t i = 0; i < left.size(); i++)
+        {
+            for(size_t j = 0; j < right.size(); j++)
+            {
+                result[i + j] += left[i] * right[j];
+            }
+        }
+        return result;
+    }
+
+    // Both real sequences are packed into one complex transform: z = left + i * right
+    size_t size = FastFourierTransform<T>::GetNextPowerOfTwo(length);
+    std::vector<std::complex<T>> packed(size, 0);
+    for(size_t i = 0; i < left.size(); i++)
+    {
+        packed[i].real(left[i]);
+    }
+    for(size_t i = 0; i < right.size(); i++)
+    {
+        packed[i].imag(right[i]);
+    }
+    FastFourierTransform<T>::TransformPowerOfTwo(packed, false);
+
+    // L_k = (Z_k + conj(Z_(n-k))) / 2, R_k = (Z_k - conj(Z_(n-k))) / 2i, so L_k R_k = (Z_k^2 - conj(Z_(n-k))^2) / 4i
+    std::vector<std::complex<T>> product(size);
+    for(size_t k = 0; k < size; k++)
+    {
+        std::complex<T> z = packed[k];
+        std::complex<T> zMirrored = std::conj(packed[(size - k) & (size - 1)]);
+        product[k] = (z * z - zMirrored * zMirrored) / std::complex<T>(0, 4);
+    }
+    FastFourierTransform<T>::TransformPowerOfTwo(product, true);
+
+    std::vector<T> result(length);
+    for(size_t i = 0; i < length; i++)
+    {
+        result[i] = product[i].real() / (T)size;
+    }
+    return result;
+}
+
+template<typename T>
+void FastFourierTransform<T>::Transform(std::vector<std::complex<T>>& data, const std::vector<std::complex<T>>& twiddleFactors)
+{
+    size_t n = data.size();
+    if(n <= 1)
+    {
+        return;
+    }
+    if((n & (n - 1)) != 0 || twiddleFactors.size() != n / 2)
+    {
+        throw std::runtime_error("The twiddle factors do not fit the length of the data.");
+    }
+
+    // Bit reversal permutation
+    for(size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if(i < j)
+        {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    for(size_t length = 2; length <= n; length <<= 1)
+    {
+        size_t half = length / 2;
+        size_t stride = n / length;
+        for(size_t start = 0; start < n; start += length)
+        {
+            for(size_t j = 0; j < half; j++)
+            {
+                std::complex<T> even = data[start + j];
+                std::complex<T> odd = data[start + j + half] * twiddleFactors[j * stride];
+                data[start + j] = even + odd;
+                data[start + j + half] = even - odd;
+            }
+        }
+    }
+}
+
+template<typename T>
+std::vector<std::complex<T>> FastFourierTransform<T>::GetTwiddleFactors(size_t n, bool inverse)
+{
+    const T sign = inverse ? 1 : -1;
+    std::vector<std::complex<T>> roots(n / 2);
+    for(size_t j = 0; j < n / 2; j++)
+    {
+        T angle = sign * 2 * std::numbers::pi_v<T> * (T)j / (T)n;
+        roots[j] = std::complex<T>(std::cos(angle), std::sin(angle));
+    }
+    return roots;
+}
+
+template<typename T>
+size_t FastFourierTransform<T>::GetNextPowerOfTwo(size_t n)
+{
+    size_t power = 1;
+    while(power < n)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+
+/* Private Methods ***********************************************************/
+
+template<typename T>
+void FastFourierTransform<T>::TransformPowerOfTwo(std::vector<std::complex<T>>& data, bool inverse)
+{
+    FastFourierTransform<T>::Transform(data, FastFourierTransform<T>::GetTwiddleFactors(data.size(), inverse));
+}
+
+template<typename T>
+void FastFourierTransform<T>::TransformBluestein(std::vector<std::complex<T>>& data, bool inverse)
+{
+    // jk = (j^2 + k^2 - (k - j)^2) / 2 turns the DFT into a convolution with the chirp e^(-+i pi j^2 / n)
+    size_t n = data.size();
+    const T sign = inverse ? 1 : -1;
+    std::vector<std::complex<T>> chirp(n);
+    for(size_t j = 0; j < n; j++)
+    {
+        // j^2 mod 2n keeps the angle small and thus exact
+        size_t square = (j * j) % (2 * n);
+        T angle = sign * std::numbers::pi_v<T> * (T)square / (T)n;
+        chirp[j] = std::complex<T>(std::cos(angle), std::sin(angle));
+    }
+
+    size_t size = FastFourierTransform<T>::GetNextPowerOfTwo(2 * n - 1);
+    std::vector<std::complex<T>> a(size, 0), b(size, 0);
+    for(size_t j = 0; j < n; j++)
+    {
+        a[j] = data[j] * chirp[j];
+    }
+    b[0] = std::conj(chirp[0]);
+    for(size_t j = 1; j < n; j++)
+    {
+        b[j] = std::conj(chirp[j]);
+        b[size - j] = std::conj(chirp[j]);
+    }
+
+    FastFourierTransform<T>::TransformPowerOfTwo(a, false);
+    FastFourierTransform<T>::TransformPowerOfTwo(b, false);
+    for(size_t k = 0; k < size; k++)
+    {
+        a[k] *= b[k];
+    }
+    FastFourierTransform<T>::TransformPowerOfTwo(a, true);
+
+    for(size_t k = 0; k < n; k++)
+    {
+        data[k] = a[k] * chirp[k] / (T)size;
+    }
+}
+
+template class FastFourierTransform<double>;
+template class FastFourierTransform<long double>;
+
+} // namespace Vath
@@ -0,0 +1,554 @@
+#include "../headers/firdesign.hpp"
+#include "../headers/chebyshevpolynomial.hpp"
+#include <algorithm>
+#include <array>
+#include <numbers>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+std::vector<highprecision> FirDesign::GetWindow(WindowType type, size_t length, highprecision beta)
+{
+    if(length == 0)
+    {
+        throw std::runtime_error("A window needs at least one sample.");
+    }
+    std::vector<highprecision> window(length, 1);
+    if(length == 1)
+    {
+        return window;
+    }
+
+    const highprecision pi = std::numbers::pi_v<highprecision>;
+    for(size_t n = 0; n < length; n++)
+    {
+        // phase runs from 0 to 2 pi, position from -1 to 1
+        highprecision phase = 2 * pi * n / (length - 1);
+        highprecision position = 2.0L * n / (length - 1) - 1;
+        switch(type)
+        {
+            case WindowType::Rectangular:
+                break;
+            case WindowType::Hann:
+                window[n] = 0.5L - 0.5L * std::cos(phase);
+                break;
+            case WindowType::Hamming:
+                window[n] = 0.54L - 0.46L * std::cos(phase);
+                break;
+            case WindowType::Blackman:
+                window[n] = 0.42L - 0.5L * std::cos(phase) + 0.08L * std::cos(2 * phase);
+                break;
+            case WindowType::Kaiser:
+                window[n] = FirDesign::GetBesselI0(beta * std::sqrt(std::max<highprecision>(0, 1 - position * position))) / FirDesign::GetBesselI0(beta);
+                break;
+        }
+    }
+
+    // Exactly symmetric
+    for(size_t n = 0; n < length / 2; n++)
+    {
+        window[length - 1 - n] = window[n];
+    }
+    return window;
+}
+
+highprecision FirDesign::GetKaiserBeta(highprecision attenuation)
+{
+    if(attenuation > 50)
+    {
+        return 0.1102L * (attenuation - 8.7L);
+    }
+    if(attenuation >= 21)
+    {
+        return 0.5842L * std::pow(attenuation - 21, 0.4L) + 0.07886L * (attenuation - 21);
+    }
+    return 0;
+}
+
+std::vector<highprecision> FirDesign::WindowedSinc(size_t taps, highprecision lowerCutoff, highprecision upperCutoff, WindowType window, highprecision beta)
+{
+    if(taps == 0)
+    {
+        throw std::runtime_error("A filter needs at least one tap.");
+    }
+    if(!(lowerCutoff >= 0 && lowerCutoff < upperCutoff && upperCutoff <= 0.5L))
+    {
+        throw std::runtime_error("The cutoff frequencies have to satisfy 0 <= lower < upper <= 0.5.");
+    }
+    if(upperCutoff == 0.5L && taps % 2 == 0)
+    {
+        throw std::runtime_error("A passband up to the nyquist frequency needs an odd number of taps.");
+    }
+
+    // Ideal bandpass 2 f2 sinc(2 f2 m) - 2 f1 sinc(2 f1 m), centered at m = 0
+    const highprecision pi = std::numbers::pi_v<highprecision>;
+    auto lowpass = [pi](highprecision cutoff, highprecision m)
+    {
+        return (m == 0) ? 2 * cutoff : std::sin(2 * pi * cutoff * m) / (pi * m);
+    };
+    std::vector<highprecision> weights = FirDesign::GetWindow(window, taps, beta);
+    std::vector<highprecision> h(taps);
+    highprecision center = (taps - 1) / 2.0L;
+    for(size_t n = 0; n < taps; n++)
+    {
+        highprecision m = n - center;
+        h[n] = (lowpass(upperCutoff, m) - lowpass(lowerCutoff, m)) * weights[n];
+    }
+
+    // Unit gain at the center of the passband (DC for a lowpass, nyquist for a highpass)
+    highprecision passbandCenter = (lowerCutoff == 0) ? 0 : ((upperCutoff == 0.5L) ? 0.5L : (lowerCutoff + upperCutoff) / 2);
+    highprecision gain = 0;
+    for(size_t n = 0; n < taps; n++)
+    {
+        gain += h[n] * std::cos(2 * pi * passbandCenter * (n - center));
+    }
+    for(highprecision& tap : h)
+    {
+        tap /= gain;
+    }
+    return h;
+}
+
+std::vector<highprecision> FirDesign::Remez(size_t taps, const std::vector<FirBand>& bands, TaskPool& pool)
+{
+    if(taps < 3)
+    {
+        throw std::runtime_error("The remez exchange needs at least 3 taps.");
+    }
+    if(bands.empty())
+    {
+        throw std::runtime_error("At least one band is needed.");
+    }
+    for(size_t b = 0; b < bands.size(); b++)
+    {
+        if(!(bands[b].lowerFrequency >= 0 && bands[b].lowerFrequency <= bands[b].upperFrequency && bands[b].upperFrequency <= 0.5L) ||
+           !(bands[b].weight > 0) || (b > 0 && !(bands[b].lowerFrequency > bands[b - 1].upperFrequency)))
+        {
+            throw std::runtime_error("The bands have to be ascending, disjoint, within [0, 0.5] and positively weighted.");
+        }
+    }
+
+    // Type I: A(w) = sum_(k<r) a_k cos(kw). Type II: A(w) = cos(w / 2) sum_(k<r) b_k cos(kw), so the sum is
+    // approximated with desired / cos(w / 2) and weight * cos(w / 2) instead (see BuildGrid()).
+    bool typeOne = (taps % 2 == 1);
+    size_t r = typeOne ? (taps + 1) / 2 : taps / 2;
+    RemezGrid grid;
+    std::vector<size_t> reference = FirDesign::SolveRemez(r, typeOne, bands, pool, grid);
+    std::vector<highprecision> points, weights, values;
+    FirDesign::LevelReference(grid, reference, pool, points, weights, values);
+
+    // The chebyshev coefficients of A (in x = cos(w)) are the cosine coefficients
+    std::vector<highprecision> chebyshevPoints = ChebyshevPolynomial::GetChebyshevPoints(r - 1);
+    std::vector<highprecision> chebyshevValues(r);
+    for(size_t j = 0; j < r; j++)
+    {
+        chebyshevValues[j] = FirDesign::EvaluateBarycentric(points, weights, values, chebyshevPoints[j]);
+    }
+    std::vector<highprecision> a = ChebyshevPolynomial::FromValues(chebyshevValues).GetCoefficients();
+    a.resize(r, 0);
+
+    std::vector<highprecision> h(taps);
+    if(typeOne)
+    {
+        // A(w) = h[M] + sum 2 h[M - k] cos(kw)
+        size_t m = r - 1;
+        h[m] = a[0];
+        for(size_t k = 1; k < r; k++)
+        {
+            h[m - k] = a[k] / 2;
+            h[m + k] = a[k] / 2;
+        }
+    }
+    else
+    {
+        // cos(w / 2) sum b_k cos(kw) = sum_(n=1..L) c_n cos((n - 1/2) w) = sum 2 h[L - n] cos((n - 1/2) w)
+        size_t l = r;
+        // with cos(w / 2) cos(kw) = (cos((k + 1/2) w) + cos((k - 1/2) w)) / 2 and cos(-w / 2) = cos(w / 2)
+        std::vector<highprecision> c(l + 1, 0);
+        for(size_t k = 0; k < l; k++)
+        {
+            c[k + 1] += a[k] / 2;
+            c[std::max<size_t>(k, 1)] += a[k] / 2;
+        }
+        for(size_t n = 1; n <= l; n++)
+        {
+            h[l - n] = c[n] / 2;
+            h[l - 1 + n] = c[n] / 2;
+        }
+    }
+    return h;
+}
+
+std::vector<highprecision> FirDesign::Remez(size_t taps, const std::vector<FirBand>& bands)
+{
+    TaskPool pool;
+    return FirDesign::Remez(taps, bands, pool);
+}
+
+Polynomial FirDesign::ToPolynomial(const std::vector<highprecision>& taps)
+{
+    return Polynomial(CoefficientList(taps.rbegin(), taps.rend()));
+}
+
+/* Private Methods ***********************************************************/
+
+FirDesign::RemezGrid FirDesign::BuildGrid(size_t r, bool typeOne, const std::vector<FirBand>& bands)
+{
+    // The points are distributed over the bands according to their width, uniformly within each band
+    const highprecision pi = std::numbers::pi_v<highprecision>;
+    highprecision totalWidth = 0;
+    for(const FirBand& band : bands)
+    {
+        totalWidth += band.upperFrequency - band.lowerFrequency;
+    }
+    highprecision spacing = totalWidth / (FirDesign::REMEZ_GRID_DENSITY * r);
+
+    RemezGrid grid;
+    for(const FirBand& band : bands)
+    {
+        grid.BandBegin.push_back(grid.X.size());
+        highprecision lower = band.lowerFrequency;
+        highprecision upper = typeOne ? band.upperFrequency : std::min(band.upperFrequency, 0.5L - spacing);
+        size_t count = (upper < lower) ? 0 : ((spacing > 0) ? (size_t)std::ceil((upper - lower) / spacing) + 1 : 1);
+        for(size_t j = 0; j < count; j++)
+        {
+            highprecision frequency = (count == 1) ? lower : lower + (upper - lower) * j / (count - 1);
+            highprecision scale = typeOne ? 1 : std::cos(pi * frequency);
+            grid.Frequency.push_back(frequency);
+            grid.X.push_back(std::cos(2 * pi * frequency));
+            grid.Desired.push_back(band.gain / scale);
+            grid.Weight.push_back(band.weight * scale);
+        }
+        grid.BandEnd.push_back(grid.X.size());
+    }
+    return grid;
+}
+
+std::vector<size_t> FirDesign::SolveRemez(size_t r, bool typeOne, const std::vector<FirBand>& bands, TaskPool& pool, RemezGrid& grid)
+{
+    grid = FirDesign::BuildGrid(r, typeOne, bands);
+    size_t gridSize = grid.X.size();
+    if(gridSize < r + 1)
+    {
+        throw std::runtime_error("The bands are too narrow for the number of taps.");
+    }
+
+    // Long filters start from the optimal reference of the half as long filter, stretched onto this grid. The
+    // evenly spread reference is too far off for them, the first exchange then yields an unusable reference.
+    std::vector<size_t> reference;
+    if(r >= FirDesign::REMEZ_SCALING_MIN_TERMS)
+    {
+        RemezGrid smallGrid;
+        std::vector<size_t> smallReference = FirDesign::SolveRemez(r / 2, typeOne, bands, pool, smallGrid);
+        reference = FirDesign::ScaleReference(smallGrid, smallReference, grid, r);
+    }
+    if(reference.empty())
+    {
+        reference.resize(r + 1);
+        for(size_t k = 0; k <= r; k++)
+        {
+            reference[k] = (size_t)std::llround((highprecision)k * (gridSize - 1) / r);
+        }
+    }
+
+    std::vector<highprecision> points, weights, values, amplitude(gridSize), error(gridSize);
+    std::vector<double> gridX(grid.X.begin(), grid.X.end()), abscissas(r + 1), scaledWeights(r + 1), weightedValues(r + 1);
+    for(int iteration = 0; iteration < FirDesign::REMEZ_MAX_ITERATIONS; iteration++)
+    {
+        highprecision delta = FirDesign::LevelReference(grid, reference, pool, points, weights, values);
+
+        // A on the whole grid by the barycentric formula, blockwise. This runs in double, which unlike long double
+        // is vectorized, its rounding errors stay far below any achievable ripple. The weights are scaled to at most
+        // 1, which the formula does not notice.
+        highprecision largestWeight = 0;
+        for(highprecision w : weights)
+        {
+            largestWeight = std::max(largestWeight, std::abs(w));
+        }
+        for(size_t k = 0; k < points.size(); k++)
+        {
+            abscissas[k] = (double)points[k];
+            scaledWeights[k] = (double)(weights[k] / largestWeight);
+            weightedValues[k] = (double)(weights[k] / largestWeight * values[k]);
+        }
+        size_t blocks = (gridSize + FirDesign::REMEZ_BLOCK_SIZE - 1) / FirDesign::REMEZ_BLOCK_SIZE;
+        pool.ParallelFor(blocks, [&](size_t block)
+        {
+            size_t begin = block * FirDesign::REMEZ_BLOCK_SIZE;
+            size_t length = std::min(gridSize, begin + FirDesign::REMEZ_BLOCK_SIZE) - begin;
+            const double* x = gridX.data() + begin;
+            std::array<double, FirDesign::REMEZ_BLOCK_SIZE> sums{}, normalizers{};
+            for(size_t k = 0; k < abscissas.size(); k++)
+            {
+                double xk = abscissas[k];
+                double wk = scaledWeights[k];
+                double weightedValue = weightedValues[k];
+                for(size_t i = 0; i < length; i++)
+                {
+                    double t = 1 / (x[i] - xk);
+                    sums[i] += weightedValue * t;
+                    normalizers[i] += wk * t;
+                }
+            }
+            for(size_t i = 0; i < length; i++)
+            {
+                amplitude[begin + i] = sums[i] / normalizers[i];
+            }
+        });
+        for(size_t k = 0; k < reference.size(); k++)
+        {
+            amplitude[reference[k]] = values[k];
+        }
+
+        highprecision maxError = 0;
+        for(size_t i = 0; i < gridSize; i++)
+        {
+            error[i] = grid.Weight[i] * (grid.Desired[i] - amplitude[i]);
+            maxError = std::max(maxError, std::abs(error[i]));
+        }
+        if(maxError - std::abs(delta) <= FirDesign::REMEZ_TOLERANCE * maxError)
+        {
+            break;
+        }
+
+        // Exchange: the local extrema of the error within each band, the ones of equal sign merged, reduced to r + 1
+        std::vector<size_t> alternating;
+        for(size_t b = 0; b < grid.BandBegin.size(); b++)
+        {
+            for(size_t i = grid.BandBegin[b]; i < grid.BandEnd[b]; i++)
+            {
+                bool hasLeft = (i > grid.BandBegin[b]);
+                bool hasRight = (i + 1 < grid.BandEnd[b]);
+                highprecision e = error[i];
+                bool isMaximum = e > 0 && (!hasLeft || e >= error[i - 1]) && (!hasRight || e >= error[i + 1]);
+                bool isMinimum = e < 0 && (!hasLeft || e <= error[i - 1]) && (!hasRight || e <= error[i + 1]);
+                if(!isMaximum && !isMinimum)
+                {
+                    continue;
+                }
+                if(!alternating.empty() && (error[alternating.back()] > 0) == (e > 0))
+                {
+                    if(std::abs(e) > std::abs(error[alternating.back()]))
+                    {
+                        alternating.back() = i;
+                    }
+                }
+                else
+                {
+                    alternating.push_back(i);
+                }
+            }
+        }
+        while(alternating.size() > r + 1)
+        {
+            if(alternating.size() == r + 2)
+            {
+                // Dropping an end keeps the alternation
+                if(std::abs(error[alternating.front()]) < std::abs(error[alternating.back()]))
+                {
+                    alternating.erase(alternating.begin());
+                }
+                else
+                {
+                    alternating.pop_back();
+                }
+                continue;
+            }
+            size_t smallest = 0;
+            for(size_t j = 1; j < alternating.size(); j++)
+            {
+                if(std::abs(error[alternating[j]]) < std::abs(error[alternating[smallest]]))
+                {
+                    smallest = j;
+                }
+            }
+            if(smallest == 0 || smallest == alternating.size() - 1)
+            {
+                alternating.erase(alternating.begin() + smallest);
+                continue;
+            }
+            // Dropping an inner one leaves two neighbours of equal sign, of which the larger one is kept
+            size_t weaker = (std::abs(error[alternating[smallest - 1]]) < std::abs(error[alternating[smallest + 1]])) ? smallest - 1 : smallest + 1;
+            alternating.erase(alternating.begin() + std::max(smallest, weaker));
+            alternating.erase(alternating.begin() + std::min(smallest, weaker));
+        }
+        if(alternating.size() < r + 1 || alternating == reference)
+        {
+            break;
+        }
+        reference = alternating;
+    }
+    return reference;
+}
+
+std::vector<size_t> FirDesign::ScaleReference(const RemezGrid& smallGrid, const std::vector<size_t>& smallReference, const RemezGrid& grid, size_t r)
+{
+    // Every band gets the share of the reference it had in the small design, the frequencies are interpolated
+    // linearly over the index within the band (J. Filip, "A robust and scalable implementation of the
+    // Parks-McClellan algorithm for designing FIR filters", 2016)
+    size_t bandCount = grid.BandBegin.size();
+    std::vector<std::vector<highprecision>> smallFrequencies(bandCount);
+    for(size_t index : smallReference)
+    {
+        for(size_t b = 0; b < bandCount; b++)
+        {
+            if(index >= smallGrid.BandBegin[b] && index < smallGrid.BandEnd[b])
+            {
+                smallFrequencies[b].push_back(smallGrid.Frequency[index]);
+            }
+        }
+    }
+
+    std::vector<size_t> counts(bandCount);
+    size_t total = 0;
+    for(size_t b = 0; b < bandCount; b++)
+    {
+        counts[b] = (size_t)std::llround((highprecision)smallFrequencies[b].size() * (r + 1) / smallReference.size());
+        total += counts[b];
+    }
+    size_t largest = std::max_element(counts.begin(), counts.end()) - counts.begin();
+    if(counts[largest] + (r + 1) < total)
+    {
+        return std::vector<size_t>();
+    }
+    counts[largest] = counts[largest] + (r + 1) - total;
+
+    std::vector<size_t> reference;
+    for(size_t b = 0; b < bandCount; b++)
+    {
+        size_t begin = grid.BandBegin[b];
+        size_t end = grid.BandEnd[b];
+        if(counts[b] == 0)
+        {
+            continue;
+        }
+        if(end - begin < counts[b])
+        {
+            return std::vector<size_t>();
+        }
+        highprecision lower = grid.Frequency[begin];
+        highprecision upper = grid.Frequency[end - 1];
+        const std::vector<highprecision>& old = smallFrequencies[b];
+        for(size_t j = 0; j < counts[b]; j++)
+        {
+            highprecision frequency = lower;
+            if(old.size() >= 2 && counts[b] >= 2)
+            {
+                highprecision position = (highprecision)j * (old.size() - 1) / (counts[b] - 1);
+                size_t i = std::min<size_t>((size_t)position, old.size() - 2);
+                frequency = old[i] + (position - i) * (old[i + 1] - old[i]);
+            }
+            else if(counts[b] >= 2)
+            {
+                frequency = lower + (upper - lower) * j / (counts[b] - 1);
+            }
+            else if(!old.empty())
+            {
+                frequency = old[0];
+            }
+
+            size_t index = begin;
+            if(upper > lower)
+            {
+                index = begin + (size_t)std::llround(std::clamp<highprecision>((frequency - lower) / (upper - lower), 0, 1) * (end - begin - 1));
+            }
+            if(!reference.empty() && index <= reference.back())
+            {
+                index = reference.back() + 1;
+            }
+            if(index >= end)
+            {
+                return std::vector<size_t>();
+            }
+            reference.push_back(index);
+        }
+    }
+    return reference;
+}
+
+highprecision FirDesign::LevelReference(const RemezGrid& grid, const std::vector<size_t>& reference, TaskPool& pool, std::vector<highprecision>& points, std::vector<highprecision>& weights, std::vector<highprecision>& values)
+{
+    // Levelled error delta, such that A(x_k) = D_k - (-1)^k delta / W_k is solvable with r coefficients
+    size_t count = reference.size();
+    points.resize(count);
+    values.resize(count);
+    for(size_t k = 0; k < count; k++)
+    {
+        points[k] = grid.X[reference[k]];
+    }
+    weights = FirDesign::GetBarycentricWeights(points, pool);
+    highprecision numerator = 0, denominator = 0;
+    for(size_t k = 0; k < count; k++)
+    {
+        highprecision sign = (k % 2 == 0) ? 1 : -1;
+        numerator += weights[k] * grid.Desired[reference[k]];
+        denominator += weights[k] * sign / grid.Weight[reference[k]];
+    }
+    highprecision delta = numerator / denominator;
+    for(size_t k = 0; k < count; k++)
+    {
+        highprecision sign = (k % 2 == 0) ? 1 : -1;
+        values[k] = grid.Desired[reference[k]] - sign * delta / grid.Weight[reference[k]];
+    }
+    return delta;
+}
+
+highprecision FirDesign::GetBesselI0(highprecision x)
+{
+    // I0(x) = sum ((x / 2)^k / k!)^2
+    highprecision sum = 1;
+    highprecision term = 1;
+    for(int k = 1; k < 500; k++)
+    {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+        if(term <= std::numeric_limits<highprecision>::epsilon() * sum)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+std::vector<highprecision> FirDesign::GetBarycentricWeights(const std::vector<highprecision>& points, TaskPool& pool)
+{
+    // w_k = 1 / prod 2 (x_k - x_j), the factor 2 (the inverse capacity of [-1, 1]) keeps the products in range and
+    // cancels in every formula the weights are used in
+    std::vector<highprecision> weights(points.size());
+    pool.ParallelFor(points.size(), [&](size_t k)
+    {
+        highprecision product = 1;
+        for(size_t j = 0; j < points.size(); j++)
+        {
+            if(j != k)
+            {
+                product *= 2 * (points[k] - points[j]);
+            }
+        }
+        weights[k] = 1 / product;
+    });
+    return weights;
+}
+
+highprecision FirDesign::EvaluateBarycentric(const std::vector<highprecision>& points, const std::vector<highprecision>& weights, const std::vector<highprecision>& values, highprecision x)
+{
+    highprecision sum = 0, normalizer = 0;
+    for(size_t k = 0; k < points.size(); k++)
+    {
+        if(x == points[k])
+        {
+            return values[k];
+        }
+        highprecision t = weights[k] / (x - points[k]);
+        sum += t * values[k];
+        normalizer += t;
+    }
+    return sum / normalizer;
+}
+
+} // namespace Vath
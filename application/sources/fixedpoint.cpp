@@ -0,0 +1,399 @@
+#include "../headers/fixedpoint.hpp"
+#include "../headers/stabilityanalysis.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+int FixedPoint::GetFractionalBits(FixedPointFormat format)
+{
+    return (format == FixedPointFormat::Q15) ? FixedPoint::Q15_FRACTIONAL_BITS : FixedPoint::Q31_FRACTIONAL_BITS;
+}
+
+QuantizedCoefficients FixedPoint::Quantize(const std::vector<highprecision>& coefficients, FixedPointFormat format, RoundingMode rounding)
+{
+    int fractionalBits = FixedPoint::GetFractionalBits(format);
+    highprecision limit = std::ldexp(1.0L, fractionalBits) - 1;
+    for(int integerBits = 0; integerBits <= FixedPoint::MAX_INTEGER_BITS; integerBits++)
+    {
+        std::vector<int32_t> values;
+        for(highprecision c : coefficients)
+        {
+            highprecision value = FixedPoint::Round(std::ldexp(c, fractionalBits - integerBits), rounding);
+            if(!(std::abs(value) <= limit))
+            {
+                break;
+            }
+            values.push_back((int32_t)value);
+        }
+        if(values.size() == coefficients.size())
+        {
+            return QuantizedCoefficients{ .values = values, .format = format, .integerBits = integerBits };
+        }
+    }
+    throw std::runtime_error("The coefficients are too large to be quantized.");
+}
+
+QuantizedCoefficients FixedPoint::Quantize(const Polynomial& polynomial, FixedPointFormat format, RoundingMode rounding)
+{
+    CoefficientList coefficients = polynomial.GetCoefficients();
+    return FixedPoint::Quantize(std::vector<highprecision>(coefficients.begin(), coefficients.end()), format, rounding);
+}
+
+QuantizedFraction FixedPoint::Quantize(const PolynomialFraction& fraction, FixedPointFormat format, RoundingMode rounding)
+{
+    return QuantizedFraction{
+        .numerator = FixedPoint::Quantize(fraction.numerator, format, rounding),
+        .denominator = FixedPoint::Quantize(fraction.denominator, format, rounding)
+    };
+}
+
+QuantizedCoefficients FixedPoint::Quantize(const SecondOrderSections& sections, FixedPointFormat format, RoundingMode rounding)
+{
+    return FixedPoint::Quantize(sections.GetCoefficients(), format, rounding);
+}
+
+std::vector<highprecision> FixedPoint::Dequantize(const QuantizedCoefficients& coefficients)
+{
+    int exponent = coefficients.integerBits - FixedPoint::GetFractionalBits(coefficients.format);
+    std::vector<highprecision> values;
+    for(int32_t value : coefficients.values)
+    {
+        values.push_back(std::ldexp((highprecision)value, exponent));
+    }
+    return values;
+}
+
+std::vector<int16_t> FixedPoint::ToQ15(const std::vector<highprecision>& signal)
+{
+    std::vector<int16_t> values;
+    for(highprecision x : signal)
+    {
+        if(!std::isfinite(x))
+        {
+            throw std::runtime_error("The signal contains a sample which is not finite. Cant convert it to fixed point.");
+        }
+        values.push_back((int16_t)FixedPoint::Saturate((int64_t)std::round(std::clamp<highprecision>(std::ldexp(x, 15), -65536, 65536)), FixedPointFormat::Q15));
+    }
+    return values;
+}
+
+std::vector<int32_t> FixedPoint::ToQ31(const std::vector<highprecision>& signal)
+{
+    std::vector<int32_t> values;
+    for(highprecision x : signal)
+    {
+        if(!std::isfinite(x))
+        {
+            throw std::runtime_error("The signal contains a sample which is not finite. Cant convert it to fixed point.");
+        }
+        values.push_back((int32_t)FixedPoint::Saturate((int64_t)std::round(std::clamp<highprecision>(std::ldexp(x, 31), -4294967296.0L, 4294967296.0L)), FixedPointFormat::Q31));
+    }
+    return values;
+}
+
+std::vector<highprecision> FixedPoint::FromFixedPoint(const std::vector<int16_t>& signal)
+{
+    std::vector<highprecision> values;
+    for(int16_t x : signal)
+    {
+        values.push_back(std::ldexp((highprecision)x, -15));
+    }
+    return values;
+}
+
+std::vector<highprecision> FixedPoint::FromFixedPoint(const std::vector<int32_t>& signal)
+{
+    std::vector<highprecision> values;
+    for(int32_t x : signal)
+    {
+        values.push_back(std::ldexp((highprecision)x, -31));
+    }
+    return values;
+}
+
+std::vector<int16_t> FixedPoint::FilterFir(const QuantizedCoefficients& taps, const std::vector<int16_t>& signal)
+{
+    FixedPoint::RequireFormat(taps, FixedPointFormat::Q15, 1);
+
+    // y[n] = sum_j reversed[j] padded[n + j], both contiguous for the dot product
+    size_t count = taps.values.size();
+    std::vector<int16_t> reversed(taps.values.rbegin(), taps.values.rend());
+    std::vector<int16_t> padded(count - 1 + signal.size(), 0);
+    std::copy(signal.begin(), signal.end(), padded.begin() + (count - 1));
+
+    // Q15 x Q(15 - integerBits) products are in Q(30 - integerBits)
+    int shift = FixedPoint::Q15_FRACTIONAL_BITS - taps.integerBits;
+    std::vector<int16_t> output(signal.size());
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        int64_t sum = FixedPoint::DotProduct(reversed.data(), padded.data() + n, count);
+        output[n] = (int16_t)FixedPoint::Saturate(FixedPoint::RoundShift(sum, shift), FixedPointFormat::Q15);
+    }
+    return output;
+}
+
+std::vector<int32_t> FixedPoint::FilterFir(const QuantizedCoefficients& taps, const std::vector<int32_t>& signal)
+{
+    FixedPoint::RequireFormat(taps, FixedPointFormat::Q31, 1);
+
+    // The 62 bit products drop guard bits, so the sum of all of them fits into 64 bits
+    size_t count = taps.values.size();
+    int guardBits = std::min<int>(std::bit_width(count), FixedPoint::Q31_FRACTIONAL_BITS - taps.integerBits);
+    int shift = FixedPoint::Q31_FRACTIONAL_BITS - taps.integerBits - guardBits;
+    std::vector<int32_t> output(signal.size());
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        int64_t sum = 0;
+        for(size_t k = 0; k < count && k <= n; k++)
+        {
+            sum += ((int64_t)taps.values[k] * signal[n - k]) >> guardBits;
+        }
+        output[n] = (int32_t)FixedPoint::Saturate(FixedPoint::RoundShift(sum, shift), FixedPointFormat::Q31);
+    }
+    return output;
+}
+
+std::vector<int16_t> FixedPoint::FilterBiquads(const QuantizedCoefficients& sections, const std::vector<int16_t>& signal)
+{
+    FixedPoint::RequireFormat(sections, FixedPointFormat::Q15, SecondOrderSections::COEFFICIENTS_PER_SECTION);
+    return FixedPoint::FilterBiquadsGeneric(sections, signal, FixedPointFormat::Q15, 0);
+}
+
+std::vector<int32_t> FixedPoint::FilterBiquads(const QuantizedCoefficients& sections, const std::vector<int32_t>& signal)
+{
+    FixedPoint::RequireFormat(sections, FixedPointFormat::Q31, SecondOrderSections::COEFFICIENTS_PER_SECTION);
+    // Five 62 bit products, three guard bits
+    return FixedPoint::FilterBiquadsGeneric(sections, signal, FixedPointFormat::Q31, 3);
+}
+
+PoleMovement FixedPoint::AnalyzePoleMovement(const PolynomialFraction& filter, FixedPointFormat format, RoundingMode rounding)
+{
+    CoefficientList denominator = Polynomial::TrimCoefficients(filter.denominator.GetCoefficients(), 0);
+    std::vector<highprecision> quantized = FixedPoint::Dequantize(FixedPoint::Quantize(Polynomial(denominator), format, rounding));
+    CoefficientList quantizedDenominator(quantized.begin(), quantized.end());
+
+    std::vector<Complex> originalPoles, quantizedPoles;
+    if(denominator.size() > 1)
+    {
+        originalPoles = Polynomial::FindComplexZeros(Polynomial(denominator));
+        quantizedPoles = Polynomial::FindComplexZeros(Polynomial(quantizedDenominator));
+    }
+    PoleMovement movement = FixedPoint::MatchPoles(originalPoles, quantizedPoles);
+    movement.isStable = std::isfinite(movement.maximumRadius) && StabilityAnalysis::IsSchurStable(quantizedDenominator);
+    return movement;
+}
+
+PoleMovement FixedPoint::AnalyzePoleMovement(const SecondOrderSections& sections, FixedPointFormat format, RoundingMode rounding)
+{
+    std::vector<Complex> originalPoles = FixedPoint::GetSectionPoles(sections.GetCoefficients());
+    std::vector<Complex> quantizedPoles = FixedPoint::GetSectionPoles(FixedPoint::Dequantize(FixedPoint::Quantize(sections, format, rounding)));
+    PoleMovement movement = FixedPoint::MatchPoles(originalPoles, quantizedPoles);
+    movement.isStable = movement.maximumRadius < 1;
+    return movement;
+}
+
+/* Private Methods ***********************************************************/
+
+highprecision FixedPoint::Round(highprecision value, RoundingMode rounding)
+{
+    switch(rounding)
+    {
+        case RoundingMode::Nearest:
+            return std::round(value);
+
+        case RoundingMode::Convergent:
+        {
+            highprecision rounded = std::round(value);
+            if(std::abs(value - std::trunc(value)) == 0.5L)
+            {
+                rounded = 2 * std::round(value / 2);
+            }
+            return rounded;
+        }
+
+        case RoundingMode::Floor:
+            return std::floor(value);
+
+        case RoundingMode::TowardZero:
+            return std::trunc(value);
+    }
+    throw std::runtime_error("Unknown rounding mode.");
+}
+
+int64_t FixedPoint::DotProduct(const int16_t* left, const int16_t* right, size_t length)
+{
+    // pmaddwd yields sums of two products in 32 bits, which are widened to 64 bits before they are accumulated.
+    // The quantized values are never -2^15, so these sums can not overflow.
+    int64_t sum = 0;
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i accumulator = _mm256_setzero_si256();
+    for(; i + 16 <= length; i += 16)
+    {
+        __m256i products = _mm256_madd_epi16(
+            _mm256_loadu_si256((const __m256i*)(left + i)),
+            _mm256_loadu_si256((const __m256i*)(right + i))
+        );
+        accumulator = _mm256_add_epi64(accumulator, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(products)));
+        accumulator = _mm256_add_epi64(accumulator, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(products, 1)));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, accumulator);
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__)
+    __m128i accumulator = _mm_setzero_si128();
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i products = _mm_madd_epi16(
+            _mm_loadu_si128((const __m128i*)(left + i)),
+            _mm_loadu_si128((const __m128i*)(right + i))
+        );
+        __m128i sign = _mm_srai_epi32(products, 31);
+        accumulator = _mm_add_epi64(accumulator, _mm_unpacklo_epi32(products, sign));
+        accumulator = _mm_add_epi64(accumulator, _mm_unpackhi_epi32(products, sign));
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128((__m128i*)lanes, accumulator);
+    sum = lanes[0] + lanes[1];
+#endif
+    for(; i < length; i++)
+    {
+        sum += (int32_t)left[i] * right[i];
+    }
+    return sum;
+}
+
+int64_t FixedPoint::RoundShift(int64_t value, int shift)
+{
+    if(shift <= 0)
+    {
+        return value;
+    }
+    return (value + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+int64_t FixedPoint::Saturate(int64_t value, FixedPointFormat format)
+{
+    int64_t limit = (int64_t)1 << FixedPoint::GetFractionalBits(format);
+    return std::clamp<int64_t>(value, -limit, limit - 1);
+}
+
+void FixedPoint::RequireFormat(const QuantizedCoefficients& coefficients, FixedPointFormat format, size_t multipleOf)
+{
+    if(coefficients.format != format)
+    {
+        throw std::runtime_error("The coefficients are quantized in another format than the signal.");
+    }
+    if(coefficients.values.empty() || coefficients.values.size() % multipleOf != 0)
+    {
+        throw std::runtime_error("The number of coefficients does not fit the filter.");
+    }
+}
+
+template <typename T>
+std::vector<T> FixedPoint::FilterBiquadsGeneric(const QuantizedCoefficients& sections, const std::vector<T>& signal, FixedPointFormat format, int guardBits)
+{
+    int shift = FixedPoint::GetFractionalBits(format) - sections.integerBits - guardBits;
+    if(shift < 0)
+    {
+        throw std::runtime_error("The biquad coefficients need too many integer bits.");
+    }
+
+    // Direct form I, section by section over the whole signal
+    std::vector<T> output(signal);
+    for(size_t k = 0; k < sections.values.size(); k += SecondOrderSections::COEFFICIENTS_PER_SECTION)
+    {
+        int64_t b0 = sections.values[k], b1 = sections.values[k + 1], b2 = sections.values[k + 2];
+        int64_t a1 = sections.values[k + 3], a2 = sections.values[k + 4];
+        int64_t x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+        for(T& sample : output)
+        {
+            int64_t x0 = sample;
+            int64_t sum = ((b0 * x0) >> guardBits) + ((b1 * x1) >> guardBits) + ((b2 * x2) >> guardBits)
+                        - ((a1 * y1) >> guardBits) - ((a2 * y2) >> guardBits);
+            int64_t y0 = FixedPoint::Saturate(FixedPoint::RoundShift(sum, shift), format);
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            sample = (T)y0;
+        }
+    }
+    return output;
+}
+
+PoleMovement FixedPoint::MatchPoles(const std::vector<Complex>& originalPoles, const std::vector<Complex>& quantizedPoles)
+{
+    // The smallest poles choose first. If the leading coefficient was rounded away, the quantized denominator lacks
+    // the largest ones, which have moved to infinity.
+    const highprecision infinity = std::numeric_limits<highprecision>::infinity();
+    PoleMovement movement{ .originalPoles = originalPoles, .quantizedPoles = std::vector<Complex>(originalPoles.size(), Complex(infinity, 0)), .maximumDisplacement = 0, .maximumRadius = 0, .isStable = true };
+    std::vector<size_t> order(originalPoles.size());
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t left, size_t right){ return std::abs(originalPoles[left]) < std::abs(originalPoles[right]); });
+
+    std::vector<bool> used(quantizedPoles.size(), false);
+    for(size_t i : order)
+    {
+        const Complex& pole = originalPoles[i];
+        size_t nearest = quantizedPoles.size();
+        for(size_t j = 0; j < quantizedPoles.size(); j++)
+        {
+            if(!used[j] && (nearest == quantizedPoles.size() || std::abs(quantizedPoles[j] - pole) < std::abs(quantizedPoles[nearest] - pole)))
+            {
+                nearest = j;
+            }
+        }
+        if(nearest == quantizedPoles.size())
+        {
+            movement.maximumDisplacement = infinity;
+            movement.maximumRadius = infinity;
+            continue;
+        }
+        used[nearest] = true;
+        movement.quantizedPoles[i] = quantizedPoles[nearest];
+        movement.maximumDisplacement = std::max(movement.maximumDisplacement, std::abs(quantizedPoles[nearest] - pole));
+        movement.maximumRadius = std::max(movement.maximumRadius, std::abs(quantizedPoles[nearest]));
+    }
+    return movement;
+}
+
+std::vector<FixedPoint::Complex> FixedPoint::GetSectionPoles(const std::vector<highprecision>& coefficients)
+{
+    // The zeros of z^2 + a1 z + a2 in closed form
+    std::vector<Complex> poles;
+    for(size_t k = 0; k < coefficients.size(); k += SecondOrderSections::COEFFICIENTS_PER_SECTION)
+    {
+        highprecision a1 = coefficients[k + 3], a2 = coefficients[k + 4];
+        highprecision discriminant = a1 * a1 - 4 * a2;
+        if(discriminant >= 0)
+        {
+            // Without cancellation: q = -(a1 + sign(a1) sqrt(d)) / 2, the zeros are q and a2 / q
+            highprecision q = -(a1 + std::copysign(std::sqrt(discriminant), a1)) / 2;
+            poles.push_back(Complex(q, 0));
+            poles.push_back(Complex((q != 0) ? a2 / q : 0, 0));
+        }
+        else
+        {
+            highprecision imaginary = std::sqrt(-discriminant) / 2;
+            poles.push_back(Complex(-a1 / 2, -imaginary));
+            poles.push_back(Complex(-a1 / 2, imaginary));
+        }
+    }
+    return poles;
+}
+
+} // namespace Vath
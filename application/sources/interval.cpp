@@ -0,0 +1,191 @@
+#include "../headers/interval.hpp"
+#include <stdio.h>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+Interval::Interval()
+{
+    this->Lower = 0;
+    this->Upper = 0;
+}
+
+Interval::Interval(highprecision value)
+{
+    this->Lower = value;
+    this->Upper = value;
+}
+
+Interval::Interval(highprecision lower, highprecision upper)
+{
+    if(lower > upper)
+    {
+        throw std::runtime_error("The lower boundary of an interval must not be greater than its upper boundary.");
+    }
+    this->Lower = lower;
+    this->Upper = upper;
+}
+
+Interval::Interval(const Interval& other)
+{
+    this->Lower = other.Lower;
+    this->Upper = other.Upper;
+}
+
+/* Public Methods ************************************************************/
+
+// For toString() method
+std::ostream& operator <<(std::ostream& os, const Interval& interval)
+{
+    os  << std::scientific
+        << std::setprecision(18)
+        << "["
+        << interval.Lower
+        << ", "
+        << interval.Upper
+        << "]";
+    return os;
+}
+
+// Operators
+
+bool Interval::operator ==(const Interval& other) const
+{
+    return this->IsEqual(other);
+}
+
+bool Interval::operator !=(const Interval& other) const
+{
+    return !this->IsEqual(other);
+}
+
+Interval& Interval::operator =(const Interval& right)
+{
+    this->Lower = right.Lower;
+    this->Upper = right.Upper;
+    return *this;
+}
+
+// Methods
+
+highprecision Interval::GetMidpoint() const
+{
+    return this->Lower + (this->Upper - this->Lower) / 2;
+}
+
+highprecision Interval::GetWidth() const
+{
+    return this->Upper - this->Lower;
+}
+
+bool Interval::Contains(highprecision value) const
+{
+    return (this->Lower <= value) && (value <= this->Upper);
+}
+
+bool Interval::ContainsInInterior(const Interval& other) const
+{
+    return (this->Lower < other.Lower) && (other.Upper < this->Upper);
+}
+
+bool Interval::Intersects(const Interval& other) const
+{
+    return (this->Lower <= other.Upper) && (other.Lower <= this->Upper);
+}
+
+Interval Interval::Intersect(const Interval& left, const Interval& right)
+{
+    if(!left.Intersects(right))
+    {
+        throw std::runtime_error("The intervals do not intersect.");
+    }
+    return Interval(std::max(left.Lower, right.Lower), std::min(left.Upper, right.Upper));
+}
+
+Interval Interval::Hull(const Interval& left, const Interval& right)
+{
+    return Interval(std::min(left.Lower, right.Lower), std::max(left.Upper, right.Upper));
+}
+
+Interval Interval::RoundOutward(highprecision lower, highprecision upper)
+{
+    // Every basic operation is correctly rounded to nearest, so the exact result is at most half an ulp away.
+    // Stepping one ulp outwards thus always yields an enclosure of the exact result.
+    return Interval(
+        std::nextafter(lower, -std::numeric_limits<highprecision>::infinity()),
+        std::nextafter(upper, std::numeric_limits<highprecision>::infinity())
+    );
+}
+
+// Overriden methods
+
+std::string Interval::to_string() const
+{
+    return this->toString();
+}
+
+bool Interval::IsEqual(const Interval& other) const
+{
+    return (this->Lower == other.Lower) && (this->Upper == other.Upper);
+}
+
+// Operators for the class
+
+Interval operator +(const Interval& left, const Interval& right)
+{
+    return Interval::RoundOutward(left.Lower + right.Lower, left.Upper + right.Upper);
+}
+
+Interval operator -(const Interval& left, const Interval& right)
+{
+    return Interval::RoundOutward(left.Lower - right.Upper, left.Upper - right.Lower);
+}
+
+Interval operator *(const Interval& left, const Interval& right)
+{
+    highprecision products[4] =
+    {
+        left.Lower * right.Lower,
+        left.Lower * right.Upper,
+        left.Upper * right.Lower,
+        left.Upper * right.Upper
+    };
+    return Interval::RoundOutward(
+        *std::min_element(std::begin(products), std::end(products)),
+        *std::max_element(std::begin(products), std::end(products))
+    );
+}
+
+Interval operator /(const Interval& left, const Interval& right)
+{
+    if(right.Contains(0))
+    {
+        throw std::runtime_error("You can't divide by an interval containing 0!");
+    }
+    highprecision quotients[4] =
+    {
+        left.Lower / right.Lower,
+        left.Lower / right.Upper,
+        left.Upper / right.Lower,
+        left.Upper / right.Upper
+    };
+    return Interval::RoundOutward(
+        *std::min_element(std::begin(quotients), std::end(quotients)),
+        *std::max_element(std::begin(quotients), std::end(quotients))
+    );
+}
+
+Interval operator -(const Interval& interval)
+{
+    // Negation is exact, no rounding necessary
+    return Interval(-interval.Upper, -interval.Lower);
+}
+
+} // namespace Vath
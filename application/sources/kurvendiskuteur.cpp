@@ -0,0 +1,337 @@
+#include "../headers/kurvendiskuteur.hpp"
+#include <algorithm>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+Kurvendiskuteur::Kurvendiskuteur(const Polynomial& function) :
+    Kurvendiskuteur(PolynomialFraction{ .numerator = function, .denominator = Polynomial(CoefficientList{1}) })
+{
+}
+
+Kurvendiskuteur::Kurvendiskuteur(const PolynomialFraction& rationalFunction) :
+    Numerator(rationalFunction.numerator),
+    Denominator(rationalFunction.denominator),
+    IsRational(false),
+    Symmetry(SymmetryType::Unknown)
+{
+    CoefficientList denominator = Polynomial::TrimCoefficients(this->Denominator.GetCoefficients(), 0);
+    if(denominator.size() == 1 && denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator of the function must not be 0.");
+    }
+
+    // Cancel common zeros and poles, otherwise they would show up as both
+    CoefficientList numerator = this->Numerator.GetCoefficients();
+    if(denominator.size() > 1 && Polynomial::TrimCoefficients(numerator, 0) != CoefficientList{0})
+    {
+        Polynomial gcd = Polynomial::GreatestCommonDivisor(this->Numerator, this->Denominator);
+        if(gcd.GetOrder() > 0)
+        {
+            CoefficientList quotient, remainder;
+            Polynomial::DivideCoefficients(numerator, gcd.GetCoefficients(), quotient, remainder);
+            numerator = quotient;
+            Polynomial::DivideCoefficients(denominator, gcd.GetCoefficients(), quotient, remainder);
+            denominator = quotient;
+        }
+    }
+
+    // A constant denominator just scales the polynomial
+    if(denominator.size() == 1)
+    {
+        for(highprecision& c : numerator)
+        {
+            c /= denominator[0];
+        }
+        denominator = CoefficientList{1};
+    }
+
+    this->Numerator = Polynomial(numerator);
+    this->Denominator = Polynomial(denominator);
+    this->IsRational = (denominator.size() > 1);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+PolynomialFraction Kurvendiskuteur::GetFunction() const
+{
+    return PolynomialFraction{ .numerator = this->Numerator, .denominator = this->Denominator };
+}
+
+std::vector<highprecision> Kurvendiskuteur::GetZeros() const
+{
+    return this->Zeros;
+}
+
+std::vector<highprecision> Kurvendiskuteur::GetPoles() const
+{
+    return this->Poles;
+}
+
+std::vector<CurvePoint> Kurvendiskuteur::GetMaxima() const
+{
+    return this->Maxima;
+}
+
+std::vector<CurvePoint> Kurvendiskuteur::GetMinima() const
+{
+    return this->Minima;
+}
+
+std::vector<CurvePoint> Kurvendiskuteur::GetInflectionPoints() const
+{
+    return this->InflectionPoints;
+}
+
+std::vector<MonotonicSection> Kurvendiskuteur::GetMonotonicity() const
+{
+    return this->Monotonicity;
+}
+
+std::vector<CurvatureSection> Kurvendiskuteur::GetCurvature() const
+{
+    return this->Curvature;
+}
+
+std::optional<highprecision> Kurvendiskuteur::GetYAxisIntercept() const
+{
+    return this->YAxisIntercept;
+}
+
+SymmetryType Kurvendiskuteur::GetSymmetry() const
+{
+    return this->Symmetry;
+}
+
+std::optional<Polynomial> Kurvendiskuteur::GetAsymptote() const
+{
+    return this->Asymptote;
+}
+
+/* Public Methods ************************************************************/
+
+void Kurvendiskuteur::FullDiscussion()
+{
+    TaskPool pool;
+    this->FullDiscussion(pool);
+}
+
+void Kurvendiskuteur::FullDiscussion(TaskPool& pool)
+{
+    const Polynomial& u = this->Numerator;
+    const Polynomial& v = this->Denominator;
+
+    // Derivative chain, computed once:
+    // f   = u / v
+    // f'  = N1 / v^2   with N1 = u'v - uv'
+    // f'' = N2 / v^3   with N2 = N1'v - 2 N1 v'
+    Polynomial uPrime = Polynomial::Differentiate(u);
+    Polynomial vPrime = Polynomial::Differentiate(v);
+    Polynomial n1 = (uPrime * v) - (u * vPrime);
+    Polynomial n2 = (Polynomial::Differentiate(n1) * v) - (n1 * vPrime * 2);
+
+    // Zeros of N1 or N2 which are poles as well (multiple poles) are no zeros of f' or f''
+    auto distinctZerosWithoutPoles = [&v, this](const Polynomial& numerator)
+    {
+        std::vector<highprecision> zeros;
+        Polynomial reduced(numerator);
+        if(this->IsRational && Polynomial::TrimCoefficients(numerator.GetCoefficients(), 0) != CoefficientList{0})
+        {
+            Polynomial gcd = Polynomial::GreatestCommonDivisor(numerator, v);
+            if(gcd.GetOrder() > 0)
+            {
+                CoefficientList quotient, remainder;
+                Polynomial::DivideCoefficients(numerator.GetCoefficients(), gcd.GetCoefficients(), quotient, remainder);
+                reduced = Polynomial(quotient);
+            }
+        }
+        for(const MultipleZero& zero : Polynomial::FindZerosWithMultiplicity(reduced))
+        {
+            zeros.push_back(zero.value);
+        }
+        return zeros;
+    };
+
+    std::vector<highprecision> criticalPoints, inflectionCandidates;
+
+    pool.Submit([this, &u]()
+    {
+        this->Zeros.clear();
+        for(const MultipleZero& zero : Polynomial::FindZerosWithMultiplicity(u))
+        {
+            this->Zeros.push_back(zero.value);
+        }
+    });
+    pool.Submit([this, &v]()
+    {
+        this->Poles.clear();
+        for(const MultipleZero& pole : Polynomial::FindZerosWithMultiplicity(v))
+        {
+            this->Poles.push_back(pole.value);
+        }
+    });
+    pool.Submit([&criticalPoints, &n1, &distinctZerosWithoutPoles]()
+    {
+        criticalPoints = distinctZerosWithoutPoles(n1);
+    });
+    pool.Submit([&inflectionCandidates, &n2, &distinctZerosWithoutPoles]()
+    {
+        inflectionCandidates = distinctZerosWithoutPoles(n2);
+    });
+    pool.Submit([this, &u, &v]()
+    {
+        // Parity of a polynomial: 1 if even, -1 if odd, 0 if neither
+        auto parity = [](const Polynomial& p)
+        {
+            bool even = true, odd = true;
+            for(const Monomial& m : p)
+            {
+                if(m.Coefficient != 0)
+                {
+                    even = even && (m.Exponent % 2 == 0);
+                    odd = odd && (m.Exponent % 2 != 0);
+                }
+            }
+            return even ? 1 : (odd ? -1 : 0);
+        };
+        int symmetry = parity(u) * parity(v);
+        this->Symmetry =    (symmetry > 0) ? SymmetryType::AxialSymmetric :
+                            (symmetry < 0) ? SymmetryType::PointSymmetric :
+                                             SymmetryType::NonSymmetric;
+
+        highprecision v0 = v.EvaluateAt(0);
+        this->YAxisIntercept = (v0 != 0) ? std::optional<highprecision>(u.EvaluateAt(0) / v0) : std::nullopt;
+
+        this->Asymptote = std::nullopt;
+        if(this->IsRational)
+        {
+            CoefficientList quotient, remainder;
+            Polynomial::DivideCoefficients(u.GetCoefficients(), v.GetCoefficients(), quotient, remainder);
+            this->Asymptote = Polynomial(quotient);
+        }
+    });
+    pool.WaitForAll();
+
+    // Monotonicity and extrema from the sign of f' = N1 / v^2, which is the sign of N1
+    std::vector<std::pair<Interval, int>> sections;
+    std::vector<std::pair<highprecision, int>> turningPoints;
+    this->SplitIntoSections(criticalPoints, [&n1](highprecision x){ highprecision y = n1.EvaluateAt(x); return (y > 0) - (y < 0); }, sections, turningPoints);
+    this->Monotonicity.clear();
+    this->Maxima.clear();
+    this->Minima.clear();
+    for(const std::pair<Interval, int>& section : sections)
+    {
+        this->Monotonicity.push_back(MonotonicSection{ .range = section.first, .increasing = (section.second > 0) });
+    }
+    for(const std::pair<highprecision, int>& point : turningPoints)
+    {
+        CurvePoint extremum{ .x = point.first, .y = this->EvaluateAt(point.first) };
+        if(point.second > 0)
+        {
+            this->Maxima.push_back(extremum);
+        }
+        else
+        {
+            this->Minima.push_back(extremum);
+        }
+    }
+
+    // Curvature and inflection points from the sign of f'' = N2 / v^3, which is the sign of N2 * v
+    sections.clear();
+    turningPoints.clear();
+    this->SplitIntoSections(inflectionCandidates, [&n2, &v](highprecision x){ highprecision y = n2.EvaluateAt(x) * v.EvaluateAt(x); return (y > 0) - (y < 0); }, sections, turningPoints);
+    this->Curvature.clear();
+    this->InflectionPoints.clear();
+    for(const std::pair<Interval, int>& section : sections)
+    {
+        this->Curvature.push_back(CurvatureSection{ .range = section.first, .convex = (section.second > 0) });
+    }
+    for(const std::pair<highprecision, int>& point : turningPoints)
+    {
+        this->InflectionPoints.push_back(CurvePoint{ .x = point.first, .y = this->EvaluateAt(point.first) });
+    }
+}
+
+/* Private Methods ***********************************************************/
+
+highprecision Kurvendiskuteur::EvaluateAt(highprecision x) const
+{
+    return this->Numerator.EvaluateAt(x) / this->Denominator.EvaluateAt(x);
+}
+
+void Kurvendiskuteur::SplitIntoSections(
+    const std::vector<highprecision>& zeros,
+    const std::function<int(highprecision)>& signAt,
+    std::vector<std::pair<Interval, int>>& sections,
+    std::vector<std::pair<highprecision, int>>& turningPoints
+    ) const
+{
+    constexpr highprecision infinity = std::numeric_limits<highprecision>::infinity();
+
+    // Breakpoints in ascending order, flagged whether they are a pole
+    std::vector<std::pair<highprecision, bool>> breakpoints;
+    for(highprecision zero : zeros)
+    {
+        breakpoints.push_back(std::make_pair(zero, false));
+    }
+    for(highprecision pole : this->Poles)
+    {
+        breakpoints.push_back(std::make_pair(pole, true));
+    }
+    std::sort(breakpoints.begin(), breakpoints.end());
+
+    // The sign within every part between two breakpoints, tested at a point inside
+    std::vector<int> signs;
+    for(size_t i = 0; i <= breakpoints.size(); i++)
+    {
+        highprecision testPoint = 0;
+        if(breakpoints.empty())
+        {
+            testPoint = 0;
+        }
+        else if(i == 0)
+        {
+            highprecision b = breakpoints.front().first;
+            testPoint = b - std::max((highprecision)1, std::abs(b));
+        }
+        else if(i == breakpoints.size())
+        {
+            highprecision b = breakpoints.back().first;
+            testPoint = b + std::max((highprecision)1, std::abs(b));
+        }
+        else
+        {
+            testPoint = breakpoints[i - 1].first + (breakpoints[i].first - breakpoints[i - 1].first) / 2;
+        }
+        signs.push_back(signAt(testPoint));
+    }
+
+    highprecision sectionStart = -infinity;
+    for(size_t i = 0; i <= breakpoints.size(); i++)
+    {
+        bool lastPart = (i == breakpoints.size());
+        bool merge = !lastPart && !breakpoints[i].second && (signs[i] == signs[i + 1]);
+        if(merge)
+        {
+            continue;
+        }
+
+        highprecision sectionEnd = lastPart ? infinity : breakpoints[i].first;
+        if(signs[i] != 0)
+        {
+            sections.push_back(std::make_pair(Interval(sectionStart, sectionEnd), signs[i]));
+        }
+        if(!lastPart && !breakpoints[i].second && signs[i] != 0 && signs[i + 1] != 0)
+        {
+            turningPoints.push_back(std::make_pair(breakpoints[i].first, signs[i]));
+        }
+        sectionStart = sectionEnd;
+    }
+}
+
+} // namespace Vath
@@ -0,0 +1,264 @@
+#include "../headers/latticefilter.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+LatticeFilter::LatticeFilter(const std::vector<highprecision>& reflectionCoefficients, const std::vector<highprecision>& ladderCoefficients) :
+    Reflection(reflectionCoefficients),
+    Ladder(ladderCoefficients),
+    Backward(reflectionCoefficients.size() + 1, 0)
+{
+    if(ladderCoefficients.size() != reflectionCoefficients.size() + 1)
+    {
+        throw std::runtime_error("A lattice of order p needs p + 1 ladder coefficients.");
+    }
+    for(highprecision k : reflectionCoefficients)
+    {
+        if(!(std::abs(k) < 1))
+        {
+            throw std::runtime_error("The reflection coefficients of a stable lattice have to be less than 1 in magnitude.");
+        }
+    }
+}
+
+LatticeFilter::LatticeFilter(const PolynomialFraction& filter)
+{
+    CoefficientList denominator = Polynomial::TrimCoefficients(filter.denominator.GetCoefficients(), 0);
+    CoefficientList numerator = Polynomial::TrimCoefficients(filter.numerator.GetCoefficients(), 0);
+    if(denominator.empty() || denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator must not be 0.");
+    }
+    if(numerator.size() > denominator.size())
+    {
+        throw std::runtime_error("Only proper rational functions can be realized, the numerator must not have a higher order than the denominator.");
+    }
+
+    // B(z) / A(z) = (b_0 + b_1 z^-1 + ...) / (1 + a_1 z^-1 + ...) after normalizing and padding the numerator
+    size_t p = denominator.size() - 1;
+    std::vector<highprecision> residual(p + 1, 0);
+    for(size_t i = 0; i < numerator.size(); i++)
+    {
+        residual[p + 1 - numerator.size() + i] = numerator[i] / denominator[0];
+    }
+    std::vector<std::vector<highprecision>> stages = LatticeFilter::StepDown(denominator);
+
+    // B = sum v_m z^-m A_m(1 / z), the highest remaining power z^-m is only reached by the stage m
+    this->Reflection.resize(p);
+    this->Ladder.resize(p + 1);
+    for(size_t m = p + 1; m-- > 0;)
+    {
+        if(m > 0)
+        {
+            this->Reflection[m - 1] = stages[m][m];
+        }
+        this->Ladder[m] = residual[m];
+        for(size_t j = 0; j <= m; j++)
+        {
+            residual[j] -= this->Ladder[m] * stages[m][m - j];
+        }
+    }
+    this->Backward = std::vector<highprecision>(p + 1, 0);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+std::vector<highprecision> LatticeFilter::GetReflectionCoefficients() const
+{
+    return this->Reflection;
+}
+
+std::vector<highprecision> LatticeFilter::GetLadderCoefficients() const
+{
+    return this->Ladder;
+}
+
+/* Public Methods ************************************************************/
+
+std::vector<highprecision> LatticeFilter::Process(const std::vector<highprecision>& input)
+{
+    size_t p = this->Reflection.size();
+    std::vector<highprecision> output(input.size());
+    for(size_t n = 0; n < input.size(); n++)
+    {
+        // Stage m reads g_(m-1)[n-1] and overwrites g_m[n-1] by g_m[n], which the stage m + 1 has already used
+        highprecision forward = input[n];
+        for(size_t m = p; m >= 1; m--)
+        {
+            forward -= this->Reflection[m - 1] * this->Backward[m - 1];
+            this->Backward[m] = this->Reflection[m - 1] * forward + this->Backward[m - 1];
+        }
+        this->Backward[0] = forward;
+
+        highprecision y = 0;
+        for(size_t m = 0; m <= p; m++)
+        {
+            y += this->Ladder[m] * this->Backward[m];
+        }
+        output[n] = y;
+    }
+    return output;
+}
+
+void LatticeFilter::Reset()
+{
+    std::fill(this->Backward.begin(), this->Backward.end(), 0);
+}
+
+std::vector<highprecision> LatticeFilter::GetAutocorrelation(const std::vector<highprecision>& frame, size_t maxLag)
+{
+    std::vector<highprecision> autocorrelation(maxLag + 1, 0);
+    for(size_t j = 0; j <= maxLag && j < frame.size(); j++)
+    {
+        highprecision sum = 0;
+        for(size_t n = 0; n + j < frame.size(); n++)
+        {
+            sum += frame[n] * frame[n + j];
+        }
+        autocorrelation[j] = sum;
+    }
+    return autocorrelation;
+}
+
+LinearPredictor LatticeFilter::LevinsonDurbin(const std::vector<highprecision>& autocorrelation, size_t order)
+{
+    if(autocorrelation.size() <= order)
+    {
+        throw std::runtime_error("A predictor of order p needs the autocorrelation up to lag p.");
+    }
+    std::vector<highprecision> predictor(order + 1), reflectionCoefficients(order);
+    highprecision error = LatticeFilter::LevinsonDurbin(autocorrelation.data(), order, predictor.data(), reflectionCoefficients.data());
+    return LinearPredictor{
+        .predictor = Polynomial(CoefficientList(predictor.begin(), predictor.end())),
+        .reflectionCoefficients = reflectionCoefficients,
+        .predictionError = error
+    };
+}
+
+highprecision LatticeFilter::LevinsonDurbin(const highprecision* autocorrelation, size_t order, highprecision* predictor, highprecision* reflectionCoefficients)
+{
+    if(autocorrelation[0] < 0)
+    {
+        throw std::runtime_error("The autocorrelation sequence is not positive definite.");
+    }
+
+    // A silent frame predicts nothing
+    std::fill(predictor, predictor + order + 1, 0);
+    std::fill(reflectionCoefficients, reflectionCoefficients + order, 0);
+    predictor[0] = 1;
+    highprecision error = autocorrelation[0];
+    if(error == 0)
+    {
+        return 0;
+    }
+
+    for(size_t i = 1; i <= order; i++)
+    {
+        highprecision sum = autocorrelation[i];
+        for(size_t j = 1; j < i; j++)
+        {
+            sum += predictor[j] * autocorrelation[i - j];
+        }
+        highprecision k = -sum / error;
+        if(!(std::abs(k) < 1))
+        {
+            throw std::runtime_error("The autocorrelation sequence is not positive definite.");
+        }
+
+        // a_j += k a_(i-j) for j < i, both members of a pair at once
+        for(size_t j = 1; j <= i / 2; j++)
+        {
+            highprecision updated = predictor[j] + k * predictor[i - j];
+            predictor[i - j] += k * predictor[j];
+            predictor[j] = updated;
+        }
+        predictor[i] = k;
+        reflectionCoefficients[i - 1] = k;
+        error *= 1 - k * k;
+    }
+    return error;
+}
+
+std::vector<LinearPredictor> LatticeFilter::LevinsonDurbin(const std::vector<std::vector<highprecision>>& autocorrelations, size_t order, TaskPool& pool)
+{
+    std::vector<LinearPredictor> predictors(autocorrelations.size());
+    pool.ParallelFor(autocorrelations.size(), [&](size_t i)
+    {
+        predictors[i] = LatticeFilter::LevinsonDurbin(autocorrelations[i], order);
+    });
+    return predictors;
+}
+
+std::vector<LinearPredictor> LatticeFilter::LevinsonDurbin(const std::vector<std::vector<highprecision>>& autocorrelations, size_t order)
+{
+    TaskPool pool;
+    return LatticeFilter::LevinsonDurbin(autocorrelations, order, pool);
+}
+
+std::vector<highprecision> LatticeFilter::ToReflectionCoefficients(const Polynomial& denominator)
+{
+    std::vector<std::vector<highprecision>> stages = LatticeFilter::StepDown(Polynomial::TrimCoefficients(denominator.GetCoefficients(), 0));
+    std::vector<highprecision> reflectionCoefficients;
+    for(size_t m = 1; m < stages.size(); m++)
+    {
+        reflectionCoefficients.push_back(stages[m][m]);
+    }
+    return reflectionCoefficients;
+}
+
+Polynomial LatticeFilter::FromReflectionCoefficients(const std::vector<highprecision>& reflectionCoefficients)
+{
+    std::vector<highprecision> coefficients{1};
+    for(highprecision k : reflectionCoefficients)
+    {
+        size_t m = coefficients.size();
+        coefficients.push_back(0);
+        for(size_t j = 1; j <= m / 2; j++)
+        {
+            highprecision updated = coefficients[j] + k * coefficients[m - j];
+            coefficients[m - j] += k * coefficients[j];
+            coefficients[j] = updated;
+        }
+        coefficients[m] = k;
+    }
+    return Polynomial(CoefficientList(coefficients.begin(), coefficients.end()));
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<std::vector<highprecision>> LatticeFilter::StepDown(const CoefficientList& denominator)
+{
+    if(denominator.empty() || denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator must not be 0.");
+    }
+
+    // stages[m] holds 1, a_1, ..., a_m of A_m, a_(j) of A_(m-1) = (a_j - k_m a_(m-j)) / (1 - k_m^2)
+    size_t p = denominator.size() - 1;
+    std::vector<std::vector<highprecision>> stages(p + 1);
+    for(highprecision c : denominator)
+    {
+        stages[p].push_back(c / denominator[0]);
+    }
+    for(size_t m = p; m >= 1; m--)
+    {
+        highprecision k = stages[m][m];
+        if(!(std::abs(k) < 1))
+        {
+            throw std::runtime_error("The denominator is not schur stable and has no lattice realization.");
+        }
+        stages[m - 1].resize(m);
+        for(size_t j = 0; j < m; j++)
+        {
+            stages[m - 1][j] = (stages[m][j] - k * stages[m][m - j]) / (1 - k * k);
+        }
+    }
+    return stages;
+}
+
+} // namespace Vath
@@ -0,0 +1,171 @@
+#include "../headers/padeapproximant.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <map>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+PolynomialFraction PadeApproximant::Approximate(const PowerSeries& series, size_t numeratorOrder, size_t denominatorOrder)
+{
+    std::vector<std::vector<highprecision>> denominators = PadeApproximant::GetDenominators(series, numeratorOrder, denominatorOrder);
+    return PadeApproximant::GetApproximant(series, numeratorOrder, denominators[denominatorOrder]);
+}
+
+std::vector<PolynomialFraction> PadeApproximant::Approximate(const PowerSeries& series, const std::vector<PadeOrder>& orders, TaskPool& pool)
+{
+    // One recursion per numerator order, up to its largest denominator order
+    std::map<size_t, size_t> maxDenominatorOrders;
+    for(const PadeOrder& order : orders)
+    {
+        size_t& maxOrder = maxDenominatorOrders[order.numeratorOrder];
+        maxOrder = std::max(maxOrder, order.denominatorOrder);
+    }
+    std::vector<size_t> numeratorOrders;
+    for(const std::pair<const size_t, size_t>& entry : maxDenominatorOrders)
+    {
+        numeratorOrders.push_back(entry.first);
+    }
+
+    std::vector<std::vector<std::vector<highprecision>>> denominators(numeratorOrders.size());
+    pool.ParallelFor(numeratorOrders.size(), [&](size_t i)
+    {
+        denominators[i] = PadeApproximant::GetDenominators(series, numeratorOrders[i], maxDenominatorOrders.at(numeratorOrders[i]));
+    });
+
+    std::vector<PolynomialFraction> approximants(orders.size());
+    pool.ParallelFor(orders.size(), [&](size_t i)
+    {
+        size_t group = std::lower_bound(numeratorOrders.begin(), numeratorOrders.end(), orders[i].numeratorOrder) - numeratorOrders.begin();
+        approximants[i] = PadeApproximant::GetApproximant(series, orders[i].numeratorOrder, denominators[group][orders[i].denominatorOrder]);
+    });
+    return approximants;
+}
+
+std::vector<PolynomialFraction> PadeApproximant::Approximate(const PowerSeries& series, const std::vector<PadeOrder>& orders)
+{
+    TaskPool pool;
+    return PadeApproximant::Approximate(series, orders, pool);
+}
+
+std::vector<highprecision> PadeApproximant::SolveToeplitz(const std::vector<highprecision>& column, const std::vector<highprecision>& row, const std::vector<highprecision>& rightSide)
+{
+    if(column.size() != rightSide.size() || row.size() != rightSide.size())
+    {
+        throw std::runtime_error("The first row, the first column and the right side must have the same size.");
+    }
+    if(rightSide.empty())
+    {
+        return std::vector<highprecision>();
+    }
+    if(row[0] != column[0])
+    {
+        throw std::runtime_error("The first row and the first column must start with the same element.");
+    }
+    return PadeApproximant::Levinson(column, row, rightSide).back();
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<std::vector<highprecision>> PadeApproximant::Levinson(const std::vector<highprecision>& column, const std::vector<highprecision>& row, const std::vector<highprecision>& rightSide)
+{
+    // The forward and backward vectors solve T_m f = e_1 and T_m b = e_m for the leading m x m block T_m
+    size_t n = rightSide.size();
+    std::vector<std::vector<highprecision>> solutions;
+    if(column[0] == 0)
+    {
+        throw std::runtime_error("The toeplitz matrix has a singular leading block.");
+    }
+    std::vector<highprecision> forward{1 / column[0]};
+    std::vector<highprecision> backward{1 / column[0]};
+    std::vector<highprecision> solution{rightSide[0] / column[0]};
+    solutions.push_back(solution);
+
+    for(size_t m = 1; m < n; m++)
+    {
+        // Errors of the extended vectors in the new last (forward, solution) and first (backward) row
+        highprecision forwardError = 0, backwardError = 0, solutionError = 0;
+        for(size_t j = 0; j < m; j++)
+        {
+            forwardError += column[m - j] * forward[j];
+            backwardError += row[j + 1] * backward[j];
+            solutionError += column[m - j] * solution[j];
+        }
+        highprecision determinant = 1 - forwardError * backwardError;
+        if(determinant == 0)
+        {
+            throw std::runtime_error("The toeplitz matrix has a singular leading block.");
+        }
+
+        std::vector<highprecision> nextForward(m + 1), nextBackward(m + 1);
+        for(size_t j = 0; j <= m; j++)
+        {
+            highprecision f = (j < m) ? forward[j] : 0;
+            highprecision b = (j > 0) ? backward[j - 1] : 0;
+            nextForward[j] = (f - forwardError * b) / determinant;
+            nextBackward[j] = (b - backwardError * f) / determinant;
+        }
+        forward = nextForward;
+        backward = nextBackward;
+
+        solution.push_back(0);
+        for(size_t j = 0; j <= m; j++)
+        {
+            solution[j] += (rightSide[m] - solutionError) * backward[j];
+        }
+        solutions.push_back(solution);
+    }
+    return solutions;
+}
+
+std::vector<std::vector<highprecision>> PadeApproximant::GetDenominators(const PowerSeries& series, size_t numeratorOrder, size_t maxDenominatorOrder)
+{
+    if(series.GetPrecision() < numeratorOrder + maxDenominatorOrder + 1)
+    {
+        throw std::runtime_error("The [L/M] Padé approximant needs the series up to x^(L+M).");
+    }
+
+    // T_ij = c_(L+i-j), y_i = -c_(L+i) with c_k = 0 for k < 0
+    std::vector<highprecision> column(maxDenominatorOrder), row(maxDenominatorOrder), rightSide(maxDenominatorOrder);
+    for(size_t k = 0; k < maxDenominatorOrder; k++)
+    {
+        column[k] = series.GetCoefficient(numeratorOrder + k);
+        row[k] = (k <= numeratorOrder) ? series.GetCoefficient(numeratorOrder - k) : 0;
+        rightSide[k] = -series.GetCoefficient(numeratorOrder + k + 1);
+    }
+
+    std::vector<std::vector<highprecision>> denominators{{1}};
+    if(maxDenominatorOrder == 0)
+    {
+        return denominators;
+    }
+    for(const std::vector<highprecision>& solution : PadeApproximant::Levinson(column, row, rightSide))
+    {
+        std::vector<highprecision> denominator{1};
+        denominator.insert(denominator.end(), solution.begin(), solution.end());
+        denominators.push_back(denominator);
+    }
+    return denominators;
+}
+
+PolynomialFraction PadeApproximant::GetApproximant(const PowerSeries& series, size_t numeratorOrder, const std::vector<highprecision>& denominator)
+{
+    // p_k = sum_j q_j c_(k-j), k = 0..L
+    std::vector<highprecision> numerator(numeratorOrder + 1, 0);
+    for(size_t k = 0; k <= numeratorOrder; k++)
+    {
+        for(size_t j = 0; j <= k && j < denominator.size(); j++)
+        {
+            numerator[k] += denominator[j] * series.GetCoefficient(k - j);
+        }
+    }
+    return PolynomialFraction{
+        .numerator = PowerSeries(numerator, numerator.size()).ToPolynomial(),
+        .denominator = PowerSeries(denominator, denominator.size()).ToPolynomial()
+    };
+}
+
+} // namespace Vath
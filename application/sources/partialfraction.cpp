@@ -0,0 +1,253 @@
+#include "../headers/partialfraction.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+PartialFractionExpansion PartialFraction::Expand(const PolynomialFraction& fraction)
+{
+    CoefficientList numerator = Polynomial::TrimCoefficients(fraction.numerator.GetCoefficients(), 0);
+    CoefficientList denominator = Polynomial::TrimCoefficients(fraction.denominator.GetCoefficients(), 0);
+    if(denominator.size() == 1 && denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator of a partial fraction expansion must not be 0.");
+    }
+
+    // The improper part by polynomial division, the proper remainder is left in the Rest of the quotient
+    PartialFractionExpansion expansion{ .terms = {}, .direct = Polynomial() };
+    CoefficientList remainder = numerator;
+    if(denominator.size() == 1)
+    {
+        expansion.direct = Polynomial(numerator) / denominator[0];
+        return expansion;
+    }
+    if(numerator.size() >= denominator.size())
+    {
+        Polynomial quotient = Polynomial(numerator) / Polynomial(denominator);
+        remainder = Polynomial::TrimCoefficients(Polynomial(quotient.GetRest()).GetCoefficients(), 0);
+        quotient.SetRest(Terms{Monomial(0,0)});
+        expansion.direct = quotient;
+    }
+    if(remainder.size() == 1 && remainder[0] == 0)
+    {
+        return expansion;
+    }
+
+    std::vector<SquareFreeFactor> factors = Polynomial::SquareFreeFactorization(Polynomial(denominator));
+    if(!Polynomial::VerifySquareFreeFactorization(Polynomial(denominator), factors))
+    {
+        // Close poles were merged or the denominator is badly scaled, take every pole as simple one
+        factors = std::vector<SquareFreeFactor>{ SquareFreeFactor{ .factor = Polynomial(denominator), .multiplicity = 1 } };
+    }
+    std::vector<PoleWithMultiplicity> poles;
+    for(const SquareFreeFactor& f : factors)
+    {
+        for(const Complex& pole : Polynomial::FindComplexZeros(f.factor))
+        {
+            poles.push_back(PoleWithMultiplicity{ .Pole = pole, .Multiplicity = f.multiplicity });
+        }
+    }
+    auto compareFn = [](const PoleWithMultiplicity& a, const PoleWithMultiplicity& b)
+    {
+        return a.Pole.real() < b.Pole.real() || (a.Pole.real() == b.Pole.real() && a.Pole.imag() < b.Pole.imag());
+    };
+    std::sort(poles.begin(), poles.end(), compareFn);
+
+    for(const PoleWithMultiplicity& p : poles)
+    {
+        // Taylor series of (x - p)^m N(x) / D(x) = N(x) / (d0 prod (x - q)^mq) around p, up to (x - p)^(m-1)
+        std::vector<Complex> series = PartialFraction::GetTaylorCoefficients(remainder, p.Pole, p.Multiplicity);
+        for(const PoleWithMultiplicity& q : poles)
+        {
+            if(&q == &p)
+            {
+                continue;
+            }
+            // 1 / (x - q) = 1 / ((x - p) + c) = sum (-1)^k (x - p)^k / c^(k+1)
+            Complex c = p.Pole - q.Pole;
+            std::vector<Complex> inverse(p.Multiplicity);
+            inverse[0] = 1.0L / c;
+            for(int k = 1; k < p.Multiplicity; k++)
+            {
+                inverse[k] = -inverse[k - 1] / c;
+            }
+            for(int k = 0; k < q.Multiplicity; k++)
+            {
+                series = PartialFraction::MultiplyTruncated(series, inverse);
+            }
+        }
+
+        for(int power = 1; power <= p.Multiplicity; power++)
+        {
+            Complex residue = series[p.Multiplicity - power] / denominator[0];
+            if(p.Pole.imag() == 0)
+            {
+                residue = Complex(residue.real(), 0);
+            }
+            expansion.terms.push_back(PartialFractionTerm{ .pole = p.Pole, .residue = residue, .power = power });
+        }
+    }
+
+    // The residues of conjugate poles are conjugate, make them exactly so
+    for(PartialFractionTerm& term : expansion.terms)
+    {
+        if(term.pole.imag() >= 0)
+        {
+            continue;
+        }
+        for(const PartialFractionTerm& partner : expansion.terms)
+        {
+            if(partner.pole == std::conj(term.pole) && partner.power == term.power)
+            {
+                term.residue = std::conj(partner.residue);
+                break;
+            }
+        }
+    }
+    return expansion;
+}
+
+std::vector<PartialFractionExpansion> PartialFraction::Expand(const std::vector<PolynomialFraction>& fractions, TaskPool& pool)
+{
+    std::vector<PartialFractionExpansion> expansions(fractions.size());
+    pool.ParallelFor(fractions.size(), [&](size_t i)
+    {
+        expansions[i] = PartialFraction::Expand(fractions[i]);
+    });
+    return expansions;
+}
+
+std::vector<PartialFractionExpansion> PartialFraction::Expand(const std::vector<PolynomialFraction>& fractions)
+{
+    TaskPool pool;
+    return PartialFraction::Expand(fractions, pool);
+}
+
+PolynomialFraction PartialFraction::Combine(const PartialFractionExpansion& expansion)
+{
+    // Every distinct pole with the highest power of its terms
+    std::vector<PoleWithMultiplicity> poles;
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        if(term.power < 1)
+        {
+            throw std::runtime_error("The power of a partial fraction must be at least 1.");
+        }
+        auto found = std::find_if(poles.begin(), poles.end(), [&](const PoleWithMultiplicity& p){ return p.Pole == term.pole; });
+        if(found == poles.end())
+        {
+            poles.push_back(PoleWithMultiplicity{ .Pole = term.pole, .Multiplicity = term.power });
+        }
+        else
+        {
+            found->Multiplicity = std::max(found->Multiplicity, term.power);
+        }
+    }
+
+    // prod (x - zero_i), highest order first
+    auto expandZeros = [](const std::vector<PoleWithMultiplicity>& zeros, const Complex& skippedZero, int skippedPower)
+    {
+        std::vector<Complex> coefficients{ Complex(1) };
+        for(const PoleWithMultiplicity& z : zeros)
+        {
+            int multiplicity = z.Multiplicity - (z.Pole == skippedZero ? skippedPower : 0);
+            for(int k = 0; k < multiplicity; k++)
+            {
+                coefficients.push_back(Complex(0));
+                for(size_t i = coefficients.size() - 1; i > 0; i--)
+                {
+                    coefficients[i] -= z.Pole * coefficients[i - 1];
+                }
+            }
+        }
+        return coefficients;
+    };
+
+    std::vector<Complex> denominator = expandZeros(poles, Complex(0), 0);
+    std::vector<Complex> numerator(denominator.size(), Complex(0));
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        std::vector<Complex> cofactor = expandZeros(poles, term.pole, term.power);
+        size_t offset = numerator.size() - cofactor.size();
+        for(size_t i = 0; i < cofactor.size(); i++)
+        {
+            numerator[offset + i] += term.residue * cofactor[i];
+        }
+    }
+
+    CoefficientList realNumerator, realDenominator;
+    for(const Complex& c : numerator)
+    {
+        realNumerator.push_back(c.real());
+    }
+    for(const Complex& c : denominator)
+    {
+        realDenominator.push_back(c.real());
+    }
+    Polynomial denominatorPolynomial(realDenominator);
+    Polynomial numeratorPolynomial = Polynomial(realNumerator) + expansion.direct * denominatorPolynomial;
+    return PolynomialFraction{
+        .numerator = Polynomial(Polynomial::TrimCoefficients(numeratorPolynomial.GetCoefficients(), 0)),
+        .denominator = denominatorPolynomial
+    };
+}
+
+highprecision PartialFraction::GetImpulseResponse(const PartialFractionExpansion& expansion, highprecision t)
+{
+    if(t < 0)
+    {
+        return 0;
+    }
+    Complex response = 0;
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        // t^(k-1) / (k-1)!
+        highprecision factor = 1;
+        for(int k = 1; k < term.power; k++)
+        {
+            factor *= t / k;
+        }
+        response += term.residue * factor * std::exp(term.pole * t);
+    }
+    return response.real();
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<PartialFraction::Complex> PartialFraction::GetTaylorCoefficients(const CoefficientList& coefficients, Complex x, int count)
+{
+    // Repeated synthetic division by (y - x), every remainder is the next taylor coefficient
+    std::vector<Complex> work(coefficients.begin(), coefficients.end());
+    std::vector<Complex> taylor;
+    size_t length = work.size();
+    for(int k = 0; k < count && length > 0; k++)
+    {
+        for(size_t i = 1; i < length; i++)
+        {
+            work[i] += work[i - 1] * x;
+        }
+        taylor.push_back(work[length - 1]);
+        length--;
+    }
+    taylor.resize(count, Complex(0));
+    return taylor;
+}
+
+std::vector<PartialFraction::Complex> PartialFraction::MultiplyTruncated(const std::vector<Complex>& left, const std::vector<Complex>& right)
+{
+    std::vector<Complex> product(left.size(), Complex(0));
+    for(size_t k = 0; k < product.size(); k++)
+    {
+        for(size_t j = 0; j <= k && k - j < right.size(); j++)
+        {
+            product[k] += left[j] * right[k - j];
+        }
+    }
+    return product;
+}
+
+} // namespace Vath
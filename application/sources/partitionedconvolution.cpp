@@ -0,0 +1,219 @@
+#include "../headers/partitionedconvolution.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include <algorithm>
+#include <numbers>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+PartitionedConvolution::PartitionedConvolution(const Polynomial& filter, size_t blockSize)
+{
+    CoefficientList coefficients = filter.GetCoefficients();
+    this->Initialize(std::vector<highprecision>(coefficients.rbegin(), coefficients.rend()), blockSize);
+}
+
+PartitionedConvolution::PartitionedConvolution(const std::vector<highprecision>& taps, size_t blockSize)
+{
+    this->Initialize(taps, blockSize);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+size_t PartitionedConvolution::GetBlockSize() const
+{
+    return this->Filter->BlockSize;
+}
+
+size_t PartitionedConvolution::GetPartitionCount() const
+{
+    return this->Filter->PartitionCount;
+}
+
+size_t PartitionedConvolution::GetLatency() const
+{
+    return this->Filter->BlockSize;
+}
+
+/* Public Methods ************************************************************/
+
+std::vector<highprecision> PartitionedConvolution::Process(const std::vector<highprecision>& input)
+{
+    size_t blockSize = this->Filter->BlockSize;
+    std::vector<highprecision> output(input.size());
+    for(size_t n = 0; n < input.size(); n++)
+    {
+        this->Window[blockSize + this->Position] = (double)input[n];
+        output[n] = this->Output[this->Position];
+        if(++this->Position == blockSize)
+        {
+            this->ProcessBlock();
+            this->Position = 0;
+        }
+    }
+    return output;
+}
+
+void PartitionedConvolution::Reset()
+{
+    std::fill(this->Window.begin(), this->Window.end(), 0);
+    std::fill(this->Output.begin(), this->Output.end(), 0);
+    std::fill(this->DelayLineReal.begin(), this->DelayLineReal.end(), 0);
+    std::fill(this->DelayLineImaginary.begin(), this->DelayLineImaginary.end(), 0);
+    this->Head = 0;
+    this->Position = 0;
+}
+
+std::vector<std::vector<highprecision>> PartitionedConvolution::Process(std::vector<PartitionedConvolution>& channels, const std::vector<std::vector<highprecision>>& inputs, TaskPool& pool)
+{
+    if(channels.size() != inputs.size())
+    {
+        throw std::runtime_error("Every stream needs its own convolution.");
+    }
+    std::vector<std::vector<highprecision>> outputs(inputs.size());
+    pool.ParallelFor(inputs.size(), [&](size_t i)
+    {
+        outputs[i] = channels[i].Process(inputs[i]);
+    });
+    return outputs;
+}
+
+std::vector<std::vector<highprecision>> PartitionedConvolution::Process(std::vector<PartitionedConvolution>& channels, const std::vector<std::vector<highprecision>>& inputs)
+{
+    TaskPool pool;
+    return PartitionedConvolution::Process(channels, inputs, pool);
+}
+
+/* Private Methods ***********************************************************/
+
+void PartitionedConvolution::Initialize(const std::vector<highprecision>& taps, size_t blockSize)
+{
+    if(blockSize == 0 || (blockSize & (blockSize - 1)) != 0)
+    {
+        throw std::runtime_error("The block size has to be a power of two.");
+    }
+    if(taps.empty())
+    {
+        throw std::runtime_error("A filter needs at least one tap.");
+    }
+
+    std::shared_ptr<Kernel> kernel = std::make_shared<Kernel>();
+    size_t bins = blockSize + 1;
+    kernel->BlockSize = blockSize;
+    kernel->PartitionCount = (taps.size() + blockSize - 1) / blockSize;
+    kernel->ForwardTwiddleFactors = FastFourierTransform<double>::GetTwiddleFactors(blockSize, false);
+    kernel->InverseTwiddleFactors = FastFourierTransform<double>::GetTwiddleFactors(blockSize, true);
+    for(size_t k = 0; k <= blockSize; k++)
+    {
+        highprecision angle = -std::numbers::pi_v<highprecision> * k / blockSize;
+        kernel->RealTwiddleFactors.push_back(Complex((double)std::cos(angle), (double)std::sin(angle)));
+    }
+
+    // Every partition is zero padded to 2B, the inverse transforms are not normalized, so the spectra carry 1 / B
+    kernel->SpectraReal.resize(kernel->PartitionCount * bins);
+    kernel->SpectraImaginary.resize(kernel->PartitionCount * bins);
+    std::vector<double> samples(2 * blockSize);
+    std::vector<Complex> buffer(blockSize);
+    for(size_t p = 0; p < kernel->PartitionCount; p++)
+    {
+        std::fill(samples.begin(), samples.end(), 0);
+        for(size_t j = 0; j < blockSize && p * blockSize + j < taps.size(); j++)
+        {
+            samples[j] = (double)(taps[p * blockSize + j] / blockSize);
+        }
+        PartitionedConvolution::TransformReal(*kernel, samples.data(), buffer, &kernel->SpectraReal[p * bins], &kernel->SpectraImaginary[p * bins]);
+    }
+
+    this->Filter = kernel;
+    this->Window = std::vector<double>(2 * blockSize, 0);
+    this->Output = std::vector<double>(blockSize, 0);
+    this->DelayLineReal = std::vector<double>(kernel->PartitionCount * bins, 0);
+    this->DelayLineImaginary = std::vector<double>(kernel->PartitionCount * bins, 0);
+    this->Accumulator = std::vector<double>(2 * bins, 0);
+    this->Buffer = std::vector<Complex>(blockSize);
+    this->Head = 0;
+    this->Position = 0;
+}
+
+void PartitionedConvolution::ProcessBlock()
+{
+    const Kernel& kernel = *this->Filter;
+    size_t blockSize = kernel.BlockSize;
+    size_t bins = blockSize + 1;
+    size_t partitions = kernel.PartitionCount;
+
+    // The newest spectrum goes in front of the delay line, the one of block (current - p) is at Head + p
+    this->Head = (this->Head + partitions - 1) % partitions;
+    PartitionedConvolution::TransformReal(kernel, this->Window.data(), this->Buffer, &this->DelayLineReal[this->Head * bins], &this->DelayLineImaginary[this->Head * bins]);
+
+    double* accumulatorReal = this->Accumulator.data();
+    double* accumulatorImaginary = this->Accumulator.data() + bins;
+    std::fill(this->Accumulator.begin(), this->Accumulator.end(), 0);
+    for(size_t p = 0; p < partitions; p++)
+    {
+        size_t slot = (this->Head + p) % partitions;
+        const double* hReal = &kernel.SpectraReal[p * bins];
+        const double* hImaginary = &kernel.SpectraImaginary[p * bins];
+        const double* xReal = &this->DelayLineReal[slot * bins];
+        const double* xImaginary = &this->DelayLineImaginary[slot * bins];
+        for(size_t k = 0; k < bins; k++)
+        {
+            accumulatorReal[k] += hReal[k] * xReal[k] - hImaginary[k] * xImaginary[k];
+            accumulatorImaginary[k] += hReal[k] * xImaginary[k] + hImaginary[k] * xReal[k];
+        }
+    }
+    PartitionedConvolution::TransformRealInverse(kernel, accumulatorReal, accumulatorImaginary, this->Buffer, this->Output.data());
+
+    // The current block is the previous one of the next window
+    std::copy(this->Window.begin() + blockSize, this->Window.end(), this->Window.begin());
+}
+
+void PartitionedConvolution::TransformReal(const Kernel& kernel, const double* samples, std::vector<Complex>& buffer, double* real, double* imaginary)
+{
+    // The even and odd samples are packed into one complex transform of half the length: z_j = x_2j + i x_2j+1
+    size_t n = kernel.BlockSize;
+    for(size_t j = 0; j < n; j++)
+    {
+        buffer[j] = Complex(samples[2 * j], samples[2 * j + 1]);
+    }
+    FastFourierTransform<double>::Transform(buffer, kernel.ForwardTwiddleFactors);
+
+    // E_k = (Z_k + conj(Z_(n-k))) / 2, O_k = (Z_k - conj(Z_(n-k))) / 2i, X_k = E_k + e^(-2 pi i k / 2n) O_k
+    for(size_t k = 0; k <= n; k++)
+    {
+        Complex z = buffer[k % n];
+        Complex zMirrored = std::conj(buffer[(n - k) % n]);
+        Complex even = (z + zMirrored) * 0.5;
+        Complex difference = z - zMirrored;
+        Complex odd(0.5 * difference.imag(), -0.5 * difference.real());
+        Complex value = even + kernel.RealTwiddleFactors[k] * odd;
+        real[k] = value.real();
+        imaginary[k] = value.imag();
+    }
+}
+
+void PartitionedConvolution::TransformRealInverse(const Kernel& kernel, const double* real, const double* imaginary, std::vector<Complex>& buffer, double* secondHalf)
+{
+    // The inverse of TransformReal(): Z_k = E_k + i O_k, whose inverse transform is x_2j + i x_2j+1
+    size_t n = kernel.BlockSize;
+    for(size_t k = 0; k < n; k++)
+    {
+        Complex x(real[k], imaginary[k]);
+        Complex xMirrored(real[n - k], -imaginary[n - k]);
+        Complex even = (x + xMirrored) * 0.5;
+        Complex odd = (x - xMirrored) * 0.5 * std::conj(kernel.RealTwiddleFactors[k]);
+        buffer[k] = Complex(even.real() - odd.imag(), even.imag() + odd.real());
+    }
+    FastFourierTransform<double>::Transform(buffer, kernel.InverseTwiddleFactors);
+
+    // Only the second half of the circular convolution is the linear one
+    for(size_t m = n; m < 2 * n; m++)
+    {
+        secondHalf[m - n] = (m % 2 == 0) ? buffer[m / 2].real() : buffer[m / 2].imag();
+    }
+}
+
+} // namespace Vath
@@ -1,5 +1,11 @@
 #include "../headers/monomial.hpp"
 #include "../headers/polynomial.hpp"
+#include "../headers/interval.hpp"
+#include "../headers/realrootisolator.hpp"
+#include "../headers/polynomialfitter.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include <functional>
+#include <numbers>
 #include <stdio.h>
 #include <cmath>
 #include <exception>
@@ -87,6 +93,11 @@ int Polynomial::GetRestOrder() const
     return this->RestOrder;
 }
 
+CoefficientList Polynomial::GetCoefficients() const
+{
+    return Polynomial::Terms2CoefficientList(this->Monomials);
+}
+
 /* Public Methods ************************************************************/
 
 int Polynomial::Count() const
@@ -181,6 +192,51 @@ CoefficientList Polynomial::Terms2CoefficientList(const Terms terms)
     return coefficients;
 }
 
+void Polynomial::DivideCoefficients(const CoefficientList& numerator, const CoefficientList& denominator, CoefficientList& quotient, CoefficientList& remainder)
+{
+    if(denominator.size() <= 0 || denominator[0] == 0)
+    {
+        throw std::runtime_error("The leading coefficient of the denominator must not be 0.");
+    }
+
+    CoefficientList working(numerator);
+    quotient = CoefficientList();
+    if(numerator.size() < denominator.size())
+    {
+        quotient.push_back(0);
+        remainder = Polynomial::TrimCoefficients(working, 0);
+        return;
+    }
+
+    size_t quotientSize = numerator.size() - denominator.size() + 1;
+    for(size_t i = 0; i < quotientSize; i++)
+    {
+        highprecision factor = working[i] / denominator[0];
+        quotient.push_back(factor);
+        working[i] = 0;
+        for(size_t j = 1; j < denominator.size(); j++)
+        {
+            working[i + j] -= factor * denominator[j];
+        }
+    }
+
+    remainder = Polynomial::TrimCoefficients(CoefficientList(working.begin() + quotientSize, working.end()), 0);
+}
+
+CoefficientList Polynomial::TrimCoefficients(const CoefficientList& coefficients, highprecision tolerance)
+{
+    CoefficientList trimmed(coefficients);
+    while(trimmed.size() > 1 && std::abs(trimmed[0]) <= tolerance)
+    {
+        trimmed.pop_front();
+    }
+    if(trimmed.size() <= 0)
+    {
+        trimmed.push_back(0);
+    }
+    return trimmed;
+}
+
 Terms Polynomial::InterpolateTerms(const Terms& terms)
 {
     if(terms.size() == 1)
@@ -369,6 +425,26 @@ std::vector<highprecision> Polynomial::FindZeros(Polynomial function)
     // TODO: Make it more numerically robust
     // TODO: Make it find zeros better and faster
 
+    // Multiple zeros do not change the sign and slow down the approximation, so split them off first and 
+    // solve every square-free factor on its own. Close zeros merged by the factorization are searched directly.
+    std::vector<SquareFreeFactor> factors = Polynomial::SquareFreeFactorization(function);
+    if((factors.size() > 1 || (factors.size() == 1 && factors[0].multiplicity > 1)) &&
+       Polynomial::VerifySquareFreeFactorization(function, factors))
+    {
+        std::vector<highprecision> zeros;
+        for(const SquareFreeFactor& f : factors)
+        {
+            for(highprecision zero : Polynomial::FindZeros(f.factor))
+            {
+                for(int i = 0; i < f.multiplicity; i++)
+                {
+                    zeros.push_back(zero);
+                }
+            }
+        }
+        return zeros;
+    }
+
     Polynomial wfunc(function);
     std::vector<highprecision> zeros;
 
@@ -453,7 +529,7 @@ std::vector<highprecision> Polynomial::FindZeros(Polynomial function)
             below = term.Coefficient + middle;
             middle = below * supposedZero;
         }
-        if(below == 0 || below < Polynomial::GUESS_ZERO_ERROR_MARGIN)
+        if(std::abs(below) < Polynomial::GUESS_ZERO_ERROR_MARGIN)
         {
             zeros.push_back(supposedZero);
         }
@@ -475,6 +551,946 @@ std::vector<highprecision> Polynomial::FindZeros(Polynomial function)
     return zeros;
 }
 
+Interval Polynomial::EvaluateAt(const Interval& x) const
+{
+    return Polynomial::EvaluateAt(*this, x);
+}
+
+std::vector<highprecision> Polynomial::ComposeCoefficients(const std::vector<highprecision>& outer, const std::vector<highprecision>& inner)
+{
+    // powers[k] = q^(2^k), lowest order first
+    std::vector<std::vector<highprecision>> powers{inner};
+    while(((size_t)1 << powers.size()) < outer.size())
+    {
+        powers.push_back(FastFourierTransform<highprecision>::Convolve(powers.back(), powers.back()));
+    }
+
+    // p(q) = p_low(q) + q^(2^k) p_high(q), where p_low has the 2^k lowest coefficients
+    std::function<std::vector<highprecision>(size_t, size_t, size_t)> compose = [&](size_t begin, size_t end, size_t level)
+    {
+        if(end - begin <= (size_t)Polynomial::COMPOSITION_DIRECT_MAX_ORDER + 1)
+        {
+            std::vector<highprecision> result{outer[end - 1]};
+            for(size_t i = end - 1; i-- > begin;)
+            {
+                result = FastFourierTransform<highprecision>::Convolve(result, inner);
+                result[0] += outer[i];
+            }
+            return result;
+        }
+        while(((size_t)1 << level) >= end - begin)
+        {
+            level--;
+        }
+        size_t middle = begin + ((size_t)1 << level);
+        std::vector<highprecision> low = compose(begin, middle, level);
+        std::vector<highprecision> high = FastFourierTransform<highprecision>::Convolve(compose(middle, end, level), powers[level]);
+        high.resize(std::max(high.size(), low.size()), 0);
+        for(size_t i = 0; i < low.size(); i++)
+        {
+            high[i] += low[i];
+        }
+        return high;
+    };
+    return compose(0, outer.size(), powers.size());
+}
+
+bool Polynomial::IterateBairstow(const std::vector<highprecision>& coefficients, highprecision& u, highprecision& v, int maxIterations)
+{
+    // b_i = a_(i+2) - u b_(i+1) - v b_(i+2) and c_i = b_(i+2) - u c_(i+1) - v c_(i+2), both 0 from index n - 1 on
+    const std::vector<highprecision>& a = coefficients;
+    size_t n = a.size() - 1;
+    const highprecision epsilon = std::numeric_limits<highprecision>::epsilon();
+    highprecision norm = 0;
+    for(highprecision c : a)
+    {
+        norm += std::abs(c);
+    }
+    std::vector<highprecision> b(n + 1, 0), c(n + 1, 0);
+    for(int iteration = 0; iteration < maxIterations; iteration++)
+    {
+        for(size_t i = n - 1; i-- > 0;)
+        {
+            b[i] = a[i + 2] - u * b[i + 1] - v * b[i + 2];
+            c[i] = b[i + 2] - u * c[i + 1] - v * c[i + 2];
+        }
+
+        // The remainder is r x + s, r = a_1 - u b_0 - v b_1, s = a_0 - v b_0, and g, h are its partial derivatives
+        highprecision r = a[1] - u * b[0] - v * b[1];
+        highprecision s = a[0] - v * b[0];
+        if(std::abs(r) + std::abs(s) <= 4 * epsilon * norm)
+        {
+            return true;
+        }
+        highprecision g = b[1] - u * c[0] - v * c[1];
+        highprecision h = b[0] - v * c[0];
+        highprecision determinant = v * g * g + h * (h - u * g);
+        if(determinant == 0 || !std::isfinite(determinant))
+        {
+            return false;
+        }
+        highprecision du = (-h * r + g * s) / determinant;
+        highprecision dv = (-g * v * r + (g * u - h) * s) / determinant;
+        u -= du;
+        v -= dv;
+        if(!std::isfinite(u) || !std::isfinite(v))
+        {
+            return false;
+        }
+        if(std::abs(du) + std::abs(dv) <= 4 * epsilon * (std::abs(u) + std::abs(v)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+Interval Polynomial::EvaluateCoefficientsAt(const CoefficientList& coefficients, const Interval& x)
+{
+    Interval accumulator(0);
+    for(highprecision coefficient : coefficients)
+    {
+        accumulator = accumulator * x + Interval(coefficient);
+    }
+    return accumulator;
+}
+
+Interval Polynomial::EvaluateAt(Polynomial function, const Interval& x)
+{
+    CoefficientList coefficients = function.GetCoefficients();
+    Interval naive = Polynomial::EvaluateCoefficientsAt(coefficients, x);
+    if(function.GetOrder() <= 0 || x.GetWidth() == 0)
+    {
+        return naive;
+    }
+
+    // Centered form: f(X) is contained in f(c) + f'(X) * (X - c)
+    highprecision c = x.GetMidpoint();
+    CoefficientList derivative = Polynomial::Differentiate(function).GetCoefficients();
+    Interval centered = 
+        Polynomial::EvaluateCoefficientsAt(coefficients, Interval(c)) + 
+        Polynomial::EvaluateCoefficientsAt(derivative, x) * (x - Interval(c));
+
+    // Both are enclosures, so the intersection is one as well
+    return Interval::Intersect(naive, centered);
+}
+
+highprecision Polynomial::GetRootBound(const Polynomial& function)
+{
+    CoefficientList coefficients = function.GetCoefficients();
+    highprecision leadingCoefficient = std::abs(coefficients[0]);
+    if(leadingCoefficient == 0)
+    {
+        throw std::runtime_error("The zero polynomial has no root bound.");
+    }
+
+    highprecision maxRatio = 0;
+    for(size_t i = 1; i < coefficients.size(); i++)
+    {
+        maxRatio = std::max(maxRatio, std::abs(coefficients[i]) / leadingCoefficient);
+    }
+    // Rounded up a little so that the bound also holds in the presence of rounding errors
+    return (1 + maxRatio) * (1 + 1E-12);
+}
+
+Polynomial Polynomial::Interpolate(const std::vector<highprecision>& x, const std::vector<highprecision>& y)
+{
+    if(x.empty() || x.size() != y.size())
+    {
+        throw std::runtime_error("Interpolation needs at least one point and as many y values as x values.");
+    }
+    size_t n = x.size();
+
+    // Divided differences in place: afterwards d[i] = f[x_0, ..., x_i]
+    std::vector<highprecision> d(y);
+    for(size_t level = 1; level < n; level++)
+    {
+        for(size_t i = n - 1; i >= level; i--)
+        {
+            highprecision dx = x[i] - x[i - level];
+            if(dx == 0)
+            {
+                throw std::runtime_error("The x values of the points have to be distinct.");
+            }
+            d[i] = (d[i] - d[i - 1]) / dx;
+        }
+    }
+
+    // Horner-like expansion of the newton form, p = d_(n-1); p = p * (x - x_i) + d_i, highest order first
+    CoefficientList coefficients{d[n - 1]};
+    for(size_t i = n - 1; i-- > 0;)
+    {
+        coefficients.push_back(0);
+        for(size_t j = coefficients.size() - 1; j > 0; j--)
+        {
+            coefficients[j] -= x[i] * coefficients[j - 1];
+        }
+        coefficients.back() += d[i];
+    }
+    return Polynomial(coefficients);
+}
+
+Polynomial Polynomial::Fit(const std::vector<highprecision>& x, const std::vector<highprecision>& y, int degree)
+{
+    return PolynomialFitter(x, degree).Fit(y);
+}
+
+Polynomial Polynomial::TaylorShift(const Polynomial& function, highprecision shift)
+{
+    return Polynomial(Polynomial::TaylorShiftCoefficients(function.GetCoefficients(), shift));
+}
+
+CoefficientList Polynomial::TaylorShiftCoefficients(const CoefficientList& coefficients, highprecision shift)
+{
+    int order = coefficients.size() - 1;
+    if(shift == 0 || order < 1)
+    {
+        return coefficients;
+    }
+
+    if(order >= Polynomial::TAYLOR_SHIFT_FAST_MIN_ORDER)
+    {
+        std::vector<highprecision> p(coefficients.rbegin(), coefficients.rend());
+        std::vector<highprecision> shifted = Polynomial::ComposeCoefficients(p, std::vector<highprecision>{shift, 1});
+        return CoefficientList(shifted.rbegin(), shifted.rend());
+    }
+
+    // Horner scheme: order passes of synthetic division by (x - shift)
+    CoefficientList shifted(coefficients);
+    for(int i = 0; i < order; i++)
+    {
+        for(int j = 1; j <= order - i; j++)
+        {
+            shifted[j] += shift * shifted[j - 1];
+        }
+    }
+    return shifted;
+}
+
+Polynomial Polynomial::Scale(const Polynomial& function, highprecision factor)
+{
+    CoefficientList coefficients = function.GetCoefficients();
+    highprecision power = 1;
+    for(size_t i = coefficients.size(); i-- > 0;)
+    {
+        coefficients[i] *= power;
+        power *= factor;
+    }
+    return Polynomial(coefficients);
+}
+
+Polynomial Polynomial::Compose(const Polynomial& outer, const Polynomial& inner)
+{
+    CoefficientList innerCoefficients = Polynomial::TrimCoefficients(inner.GetCoefficients(), 0);
+    if(innerCoefficients.size() <= 2)
+    {
+        // outer(a x + b) = s(a x) with s(y) = outer(y + b)
+        highprecision a = (innerCoefficients.size() == 2) ? innerCoefficients[0] : 0;
+        highprecision b = innerCoefficients.back();
+        Polynomial shifted = Polynomial::TaylorShift(outer, b);
+        if(a == 0)
+        {
+            return Polynomial(CoefficientList{shifted.EvaluateAt(0)});
+        }
+        return Polynomial::Scale(shifted, a);
+    }
+
+    CoefficientList outerCoefficients = outer.GetCoefficients();
+    std::vector<highprecision> p(outerCoefficients.rbegin(), outerCoefficients.rend());
+    std::vector<highprecision> q(innerCoefficients.rbegin(), innerCoefficients.rend());
+    std::vector<highprecision> result = Polynomial::ComposeCoefficients(p, q);
+    return Polynomial(CoefficientList(result.rbegin(), result.rend()));
+}
+
+std::vector<Interval> Polynomial::FindZeroEnclosures(Polynomial function)
+{
+    if(function.GetOrder() <= 0)
+    {
+        return Polynomial::FindZeroEnclosures(function, -1, 1);
+    }
+    highprecision bound = Polynomial::GetRootBound(function);
+    return Polynomial::FindZeroEnclosures(function, -bound, bound);
+}
+
+std::vector<Interval> Polynomial::FindZeroEnclosures(Polynomial function, highprecision lowerLimit, highprecision upperLimit)
+{
+    std::vector<Interval> enclosures;
+
+    if(function.GetOrder() <= 0)
+    {
+        if(function[0].Coefficient == 0)
+        {
+            throw std::runtime_error("The zero polynomial has infinitely many zeros. Cant enclose them.");
+        }
+        return enclosures;
+    }
+
+    CoefficientList coefficients = function.GetCoefficients();
+    CoefficientList derivative = Polynomial::Differentiate(function).GetCoefficients();
+
+    // 1. Discard every interval on which the polynomial can not vanish
+    // 2. If the derivative does not vanish on the interval, try the interval newton operator
+    //    N(X) = c - f(c) / f'(X). If N(X) lies in the interior of X, X contains exactly one zero.
+    // 3. Otherwise bisect and continue with both halves
+    std::vector<Interval> pending{ Interval(lowerLimit, upperLimit) };
+    while(!pending.empty())
+    {
+        Interval current = pending.back();
+        pending.pop_back();
+
+        if(!Polynomial::EvaluateAt(function, current).Contains(0))
+        {
+            continue;
+        }
+
+        Interval derivativeRange = Polynomial::EvaluateCoefficientsAt(derivative, current);
+        if(!derivativeRange.Contains(0))
+        {
+            highprecision c = current.GetMidpoint();
+            Interval newton = Interval(c) - Polynomial::EvaluateCoefficientsAt(coefficients, Interval(c)) / derivativeRange;
+
+            if(current.ContainsInInterior(newton))
+            {
+                // Certified. Tighten the enclosure by further newton steps, every step keeps the zero enclosed.
+                Interval enclosure = newton;
+                for(int i = 0; i < Polynomial::CERTIFIED_ZERO_MAX_CONTRACTIONS; i++)
+                {
+                    highprecision m = enclosure.GetMidpoint();
+                    Interval next = Interval(m) - 
+                                    Polynomial::EvaluateCoefficientsAt(coefficients, Interval(m)) / 
+                                    Polynomial::EvaluateCoefficientsAt(derivative, enclosure);
+                    if(!next.Intersects(enclosure))
+                    {
+                        break;
+                    }
+                    next = Interval::Intersect(next, enclosure);
+                    if(next.GetWidth() >= enclosure.GetWidth())
+                    {
+                        break;
+                    }
+                    enclosure = next;
+                }
+                enclosures.push_back(enclosure);
+                continue;
+            }
+            if(!current.Intersects(newton))
+            {
+                // The newton operator contains every zero of X, so there is none
+                continue;
+            }
+        }
+
+        highprecision scale = std::max(std::abs(current.GetMidpoint()), (highprecision)1);
+        if(current.GetWidth() <= scale * Polynomial::CERTIFIED_ZERO_MIN_INTERVAL_WIDTH)
+        {
+            std::stringstream errorMsg;
+            errorMsg    << "Cant certify a single zero in "
+                        << current
+                        << ". The polynomial probably has a multiple zero or a cluster of zeros there.";
+            throw std::runtime_error(errorMsg.str());
+        }
+
+        // Bisect slightly off-center, so that "nice" zeros (like integers) do not end up exactly on a boundary
+        highprecision split = current.Lower + current.GetWidth() * 0.4990234375L;
+        pending.push_back(Interval(split, current.Upper));
+        pending.push_back(Interval(current.Lower, split));
+    }
+
+    auto compareFn = [](const Interval& a, const Interval& b){return a.Lower < b.Lower;};
+    std::sort(enclosures.begin(), enclosures.end(), compareFn);
+    return enclosures;
+}
+
+std::vector<MultipleZero> Polynomial::FindZerosWithMultiplicity(Polynomial function)
+{
+    std::vector<MultipleZero> zeros;
+    RealRootIsolator isolator(0);
+    std::vector<SquareFreeFactor> factors = Polynomial::SquareFreeFactorization(function);
+    if(!Polynomial::VerifySquareFreeFactorization(function, factors))
+    {
+        // Distinct zeros were merged, so every zero counts as simple one
+        factors = std::vector<SquareFreeFactor>{ SquareFreeFactor{ .factor = function, .multiplicity = 1 } };
+    }
+    for(const SquareFreeFactor& f : factors)
+    {
+        for(highprecision zero : isolator.FindZeros(f.factor))
+        {
+            zeros.push_back(MultipleZero{ .value = zero, .multiplicity = f.multiplicity });
+        }
+    }
+
+    auto compareFn = [](const MultipleZero& a, const MultipleZero& b){return a.value < b.value;};
+    std::sort(zeros.begin(), zeros.end(), compareFn);
+    return zeros;
+}
+
+Polynomial Polynomial::GreatestCommonDivisor(const Polynomial& left, const Polynomial& right)
+{
+    auto maxMagnitude = [](const CoefficientList& coefficients)
+    {
+        highprecision maxCoefficient = 0;
+        for(highprecision c : coefficients)
+        {
+            maxCoefficient = std::max(maxCoefficient, std::abs(c));
+        }
+        return maxCoefficient;
+    };
+    auto normalize = [&maxMagnitude](CoefficientList& coefficients)
+    {
+        highprecision maxCoefficient = maxMagnitude(coefficients);
+        for(highprecision& c : coefficients)
+        {
+            c /= maxCoefficient;
+        }
+    };
+    auto monic = [](CoefficientList coefficients)
+    {
+        highprecision leading = coefficients[0];
+        for(highprecision& c : coefficients)
+        {
+            c /= leading;
+        }
+        return Polynomial(coefficients);
+    };
+
+    CoefficientList a = Polynomial::TrimCoefficients(left.GetCoefficients(), 0);
+    CoefficientList b = Polynomial::TrimCoefficients(right.GetCoefficients(), 0);
+    highprecision magnitudeA = maxMagnitude(a), magnitudeB = maxMagnitude(b);
+    if(magnitudeA == 0 && magnitudeB == 0)
+    {
+        throw std::runtime_error("The greatest common divisor of two zero polynomials is not defined.");
+    }
+
+    // A polynomial which is negligible compared to the other one counts as 0, and gcd(p, 0) = p
+    if(magnitudeB <= Polynomial::GCD_TOLERANCE * magnitudeA)
+    {
+        return monic(a);
+    }
+    if(magnitudeA <= Polynomial::GCD_TOLERANCE * magnitudeB)
+    {
+        return monic(b);
+    }
+
+    normalize(a);
+    normalize(b);
+    if(a.size() < b.size())
+    {
+        std::swap(a, b);
+    }
+    while(b.size() > 1)
+    {
+        CoefficientList quotient, remainder;
+        Polynomial::DivideCoefficients(a, b, quotient, remainder);
+        remainder = Polynomial::TrimCoefficients(remainder, Polynomial::GCD_TOLERANCE);
+        if(remainder.size() == 1 && std::abs(remainder[0]) <= Polynomial::GCD_TOLERANCE)
+        {
+            return monic(b);
+        }
+        normalize(remainder);
+        a = b;
+        b = remainder;
+    }
+
+    // The last remainder is a non-zero constant, so both are coprime
+    return Polynomial(CoefficientList{1});
+}
+
+std::vector<SquareFreeFactor> Polynomial::SquareFreeFactorization(const Polynomial& function)
+{
+    std::vector<SquareFreeFactor> factors;
+    CoefficientList coefficients = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    if(coefficients.size() <= 1)
+    {
+        return factors;
+    }
+
+    auto exactQuotient = [](const Polynomial& numerator, const Polynomial& denominator)
+    {
+        CoefficientList quotient, remainder;
+        Polynomial::DivideCoefficients(numerator.GetCoefficients(), denominator.GetCoefficients(), quotient, remainder);
+        return Polynomial(quotient);
+    };
+
+    // Yun's algorithm:
+    // a0 = gcd(f, f'), b1 = f / a0, c1 = f' / a0, d1 = c1 - b1'
+    // ai = gcd(bi, di), b(i+1) = bi / ai, c(i+1) = di / ai, d(i+1) = c(i+1) - b(i+1)'
+    Polynomial f(coefficients);
+    Polynomial fPrime = Polynomial::Differentiate(f);
+    Polynomial a = Polynomial::GreatestCommonDivisor(f, fPrime);
+    Polynomial b = exactQuotient(f, a);
+    Polynomial c = exactQuotient(fPrime, a);
+    Polynomial d = c - Polynomial::Differentiate(b);
+
+    for(int multiplicity = 1; b.GetOrder() > 0; multiplicity++)
+    {
+        a = Polynomial::GreatestCommonDivisor(b, d);
+        if(a.GetOrder() > 0)
+        {
+            factors.push_back(SquareFreeFactor{ .factor = a, .multiplicity = multiplicity });
+        }
+        b = exactQuotient(b, a);
+        c = exactQuotient(d, a);
+        d = c - Polynomial::Differentiate(b);
+    }
+
+    return factors;
+}
+
+bool Polynomial::VerifySquareFreeFactorization(const Polynomial& function, const std::vector<SquareFreeFactor>& factors)
+{
+    typedef std::complex<highprecision> Complex;
+    CoefficientList coefficients = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    size_t order = 0;
+    for(const SquareFreeFactor& f : factors)
+    {
+        order += f.multiplicity * f.factor.GetOrder();
+    }
+    if(order + 1 != coefficients.size())
+    {
+        return false;
+    }
+
+    // Derivatives of the coefficient list, highest order first
+    auto differentiate = [](const CoefficientList& list)
+    {
+        CoefficientList derivative;
+        for(size_t i = 0; i + 1 < list.size(); i++)
+        {
+            derivative.push_back(list[i] * (list.size() - 1 - i));
+        }
+        return derivative;
+    };
+    const highprecision epsilon = std::numeric_limits<highprecision>::epsilon();
+    for(const SquareFreeFactor& f : factors)
+    {
+        if(f.multiplicity < 2)
+        {
+            continue;
+        }
+        std::vector<CoefficientList> derivatives{coefficients};
+        for(int k = 0; k < f.multiplicity; k++)
+        {
+            derivatives.push_back(differentiate(derivatives.back()));
+        }
+        for(Complex zero : Polynomial::FindComplexZeros(f.factor))
+        {
+            for(int iteration = 0; iteration < 8; iteration++)
+            {
+                Complex value = 0, slope = 0;
+                for(highprecision c : derivatives[f.multiplicity - 1])
+                {
+                    value = value * zero + c;
+                }
+                for(highprecision c : derivatives[f.multiplicity])
+                {
+                    slope = slope * zero + c;
+                }
+                if(slope == Complex(0))
+                {
+                    break;
+                }
+                zero -= value / slope;
+            }
+
+            // |p^(k)(r)| <= n epsilon sum |a_i| |r|^i for k < m
+            for(int k = 0; k < f.multiplicity; k++)
+            {
+                Complex value = 0;
+                highprecision bound = 0;
+                for(highprecision c : derivatives[k])
+                {
+                    value = value * zero + c;
+                    bound = bound * std::abs(zero) + std::abs(c);
+                }
+                if(std::abs(value) > coefficients.size() * epsilon * bound)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<std::complex<highprecision>> Polynomial::FindComplexZeros(const Polynomial& function)
+{
+    typedef std::complex<highprecision> Complex;
+    CoefficientList coefficients = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    if(coefficients.size() == 1 && coefficients[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has infinitely many zeros.");
+    }
+
+    std::vector<Complex> zeros;
+    while(coefficients.size() > 1 && coefficients.back() == 0)
+    {
+        zeros.push_back(0);
+        coefficients.pop_back();
+    }
+    int order = coefficients.size() - 1;
+    if(order == 0)
+    {
+        return zeros;
+    }
+
+    // Monic, lowest order first
+    std::vector<highprecision> a(coefficients.rbegin(), coefficients.rend());
+    for(highprecision& c : a)
+    {
+        c /= coefficients[0];
+    }
+
+    // Start on a circle whose radius is the geometric mean of the zeros' magnitudes, rotated off the real axis
+    highprecision radius = std::pow(std::abs(a[0]), 1.0L / order);
+    std::vector<Complex> z(order);
+    for(int k = 0; k < order; k++)
+    {
+        z[k] = std::polar(radius, 2 * std::numbers::pi_v<highprecision> * k / order + 0.4L);
+    }
+
+    const highprecision epsilon = std::numeric_limits<highprecision>::epsilon();
+    std::vector<bool> converged(order, false);
+    for(int iteration = 0; iteration < Polynomial::COMPLEX_ZERO_MAX_ITERATIONS; iteration++)
+    {
+        bool done = true;
+        for(int k = 0; k < order; k++)
+        {
+            if(converged[k])
+            {
+                continue;
+            }
+            Complex value = a[order];
+            Complex derivative = 0;
+            for(int i = order - 1; i >= 0; i--)
+            {
+                derivative = derivative * z[k] + value;
+                value = value * z[k] + a[i];
+            }
+            if(value == Complex(0))
+            {
+                converged[k] = true;
+                continue;
+            }
+
+            // w = (p / p') / (1 - (p / p') * sum 1 / (z_k - z_j))
+            Complex ratio = value / derivative;
+            Complex repulsion = 0;
+            for(int j = 0; j < order; j++)
+            {
+                if(j != k)
+                {
+                    repulsion += Complex(1) / (z[k] - z[j]);
+                }
+            }
+            Complex correction = ratio / (Complex(1) - ratio * repulsion);
+            if(!std::isfinite(correction.real()) || !std::isfinite(correction.imag()))
+            {
+                continue;
+            }
+            z[k] -= correction;
+            converged[k] = std::abs(correction) <= 4 * epsilon * std::abs(z[k]);
+            done = done && converged[k];
+        }
+        if(done)
+        {
+            break;
+        }
+    }
+
+    // Snap numerically real zeros onto the real axis and make conjugate pairs exact
+    highprecision tolerance = std::sqrt(epsilon);
+    for(Complex& zero : z)
+    {
+        if(std::abs(zero.imag()) <= tolerance * std::abs(zero))
+        {
+            zero = Complex(zero.real(), 0);
+        }
+    }
+    std::vector<bool> paired(order, false);
+    for(int k = 0; k < order; k++)
+    {
+        if(z[k].imag() <= 0)
+        {
+            continue;
+        }
+        int partner = -1;
+        for(int j = 0; j < order; j++)
+        {
+            if(z[j].imag() < 0 && !paired[j] && (partner < 0 || std::abs(z[j] - std::conj(z[k])) < std::abs(z[partner] - std::conj(z[k]))))
+            {
+                partner = j;
+            }
+        }
+        highprecision scale = std::max<highprecision>(1, std::abs(z[k]));
+        if(partner >= 0 && std::abs(z[partner] - std::conj(z[k])) <= Polynomial::CONJUGATE_TOLERANCE * scale)
+        {
+            Complex mean = (z[k] + std::conj(z[partner])) / 2.0L;
+            z[k] = mean;
+            z[partner] = std::conj(mean);
+            paired[partner] = true;
+        }
+    }
+
+    zeros.insert(zeros.end(), z.begin(), z.end());
+    std::sort(zeros.begin(), zeros.end(), [](const Complex& left, const Complex& right)
+    {
+        return (left.real() < right.real()) || (left.real() == right.real() && left.imag() < right.imag());
+    });
+    return zeros;
+}
+
+Polynomial Polynomial::FromZeros(const std::vector<std::complex<highprecision>>& zeros, highprecision gain)
+{
+    // product *= (x - zero), lowest order first
+    std::vector<std::complex<highprecision>> product{1};
+    for(const std::complex<highprecision>& zero : zeros)
+    {
+        product.push_back(0);
+        for(size_t j = product.size() - 1; j > 0; j--)
+        {
+            product[j] = product[j - 1] - zero * product[j];
+        }
+        product[0] *= -zero;
+    }
+
+    CoefficientList coefficients;
+    for(size_t j = product.size(); j-- > 0;)
+    {
+        coefficients.push_back(gain * product[j].real());
+    }
+    return Polynomial(coefficients);
+}
+
+std::vector<std::complex<highprecision>> Polynomial::FindComplexZeros(const Polynomial& function, ZeroFindingMethod method)
+{
+    typedef std::complex<highprecision> Complex;
+    switch(method)
+    {
+        case ZeroFindingMethod::Aberth:
+            return Polynomial::FindComplexZeros(function);
+
+        case ZeroFindingMethod::Bairstow:
+        {
+            // The factors are only turned into complex zeros at the very end
+            RealFactorization factorization = Polynomial::FindQuadraticFactors(function);
+            std::vector<Complex> zeros(factorization.realZeros.begin(), factorization.realZeros.end());
+            highprecision tolerance = std::sqrt(std::numeric_limits<highprecision>::epsilon());
+            for(const QuadraticFactor& factor : factorization.quadraticFactors)
+            {
+                highprecision p = factor.linearCoefficient;
+                highprecision q = factor.constantCoefficient;
+                highprecision discriminant = p * p / 4 - q;
+                if(discriminant >= 0)
+                {
+                    // s = -p / 2 - sign(p) sqrt(D) avoids cancellation, the other zero is q / s
+                    highprecision s = -p / 2 - std::copysign(std::sqrt(discriminant), p);
+                    zeros.push_back(s);
+                    zeros.push_back((s != 0) ? q / s : 0);
+                }
+                else if(std::sqrt(-discriminant) <= tolerance * std::sqrt(q))
+                {
+                    zeros.push_back(-p / 2);
+                    zeros.push_back(-p / 2);
+                }
+                else
+                {
+                    zeros.push_back(Complex(-p / 2, std::sqrt(-discriminant)));
+                    zeros.push_back(Complex(-p / 2, -std::sqrt(-discriminant)));
+                }
+            }
+            std::sort(zeros.begin(), zeros.end(), [](const Complex& left, const Complex& right)
+            {
+                return (left.real() < right.real()) || (left.real() == right.real() && left.imag() < right.imag());
+            });
+            return zeros;
+        }
+    }
+    throw std::runtime_error("Unknown zero finding method.");
+}
+
+RealFactorization Polynomial::FindQuadraticFactors(const Polynomial& function)
+{
+    CoefficientList coefficients = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    if(coefficients.size() == 1 && coefficients[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has infinitely many zeros.");
+    }
+
+    RealFactorization factorization{ .gain = coefficients[0], .quadraticFactors = {}, .realZeros = {} };
+    while(coefficients.size() > 1 && coefficients.back() == 0)
+    {
+        factorization.realZeros.push_back(0);
+        coefficients.pop_back();
+    }
+    if(coefficients.size() == 1)
+    {
+        return factorization;
+    }
+
+    // Monic, lowest order first
+    std::vector<highprecision> original(coefficients.rbegin(), coefficients.rend());
+    for(highprecision& c : original)
+    {
+        c /= coefficients[0];
+    }
+    std::vector<highprecision> magnitudes = Polynomial::EstimateZeroMagnitudes(Polynomial(coefficients));
+
+    // Smallest zeros first, dividing by x^2 + u x + v from the highest order down
+    std::vector<highprecision> a = original;
+    size_t nextMagnitude = 0;
+    while(a.size() > 3)
+    {
+        highprecision radius = std::sqrt(magnitudes[nextMagnitude] * magnitudes[nextMagnitude + 1]);
+        highprecision u = 0, v = 0;
+        bool converged = false;
+        for(int seed = 0; seed < Polynomial::BAIRSTOW_MAX_SEEDS && !converged; seed++)
+        {
+            highprecision angle = std::numbers::pi_v<highprecision> * (2 * seed + 1) / (2 * Polynomial::BAIRSTOW_MAX_SEEDS);
+            u = -2 * radius * std::cos(angle);
+            v = radius * radius;
+            converged = Polynomial::IterateBairstow(a, u, v, Polynomial::BAIRSTOW_MAX_ITERATIONS);
+        }
+        if(!converged)
+        {
+            // The remaining factors are taken from the Aberth zeros
+            std::vector<std::complex<highprecision>> zeros = Polynomial::FindComplexZeros(Polynomial(CoefficientList(a.rbegin(), a.rend())));
+            for(const std::complex<highprecision>& zero : zeros)
+            {
+                if(zero.imag() == 0)
+                {
+                    factorization.realZeros.push_back(zero.real());
+                }
+                else if(zero.imag() > 0)
+                {
+                    factorization.quadraticFactors.push_back(QuadraticFactor{ .linearCoefficient = -2 * zero.real(), .constantCoefficient = std::norm(zero) });
+                }
+            }
+            a = std::vector<highprecision>{1};
+            break;
+        }
+
+        size_t n = a.size() - 1;
+        std::vector<highprecision> quotient(n - 1, 0);
+        for(size_t i = n - 1; i-- > 0;)
+        {
+            quotient[i] = a[i + 2] - u * ((i + 1 < n - 1) ? quotient[i + 1] : 0) - v * ((i + 2 < n - 1) ? quotient[i + 2] : 0);
+        }
+        factorization.quadraticFactors.push_back(QuadraticFactor{ .linearCoefficient = u, .constantCoefficient = v });
+        a = quotient;
+        nextMagnitude += 2;
+    }
+    if(a.size() == 3)
+    {
+        factorization.quadraticFactors.push_back(QuadraticFactor{ .linearCoefficient = a[1], .constantCoefficient = a[0] });
+    }
+    else if(a.size() == 2)
+    {
+        factorization.realZeros.push_back(-a[0]);
+    }
+
+    // The deflated factors carry the rounding errors of the previous divisions, polishing on the original polynomial
+    // removes them. A step away from the factor means it converged to another one, which is rejected.
+    highprecision tolerance = std::sqrt(std::numeric_limits<highprecision>::epsilon());
+    for(QuadraticFactor& factor : factorization.quadraticFactors)
+    {
+        highprecision u = factor.linearCoefficient;
+        highprecision v = factor.constantCoefficient;
+        if(Polynomial::IterateBairstow(original, u, v, Polynomial::BAIRSTOW_MAX_ITERATIONS) &&
+           std::abs(u - factor.linearCoefficient) + std::abs(v - factor.constantCoefficient) <= tolerance * (1 + std::abs(u) + std::abs(v)))
+        {
+            factor.linearCoefficient = u;
+            factor.constantCoefficient = v;
+        }
+    }
+    return factorization;
+}
+
+std::vector<highprecision> Polynomial::EstimateZeroMagnitudes(const Polynomial& function, int squarings)
+{
+    CoefficientList coefficients = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    if(coefficients.size() == 1 && coefficients[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has infinitely many zeros.");
+    }
+    std::vector<highprecision> magnitudes;
+    while(coefficients.size() > 1 && coefficients.back() == 0)
+    {
+        magnitudes.push_back(0);
+        coefficients.pop_back();
+    }
+    size_t order = coefficients.size() - 1;
+    if(order == 0)
+    {
+        return magnitudes;
+    }
+
+    // Substituting x = R y with R the geometric mean of the magnitudes keeps the squared coefficients in range,
+    // b_i = a_i / (a_0 R^i) is monic in y (highest order first)
+    highprecision radius = std::pow(std::abs(coefficients[order] / coefficients[0]), 1.0L / order);
+    std::vector<highprecision> b(order + 1);
+    highprecision power = 1;
+    for(size_t i = 0; i <= order; i++)
+    {
+        b[i] = coefficients[i] / (coefficients[0] * power);
+        power *= radius;
+    }
+
+    // b'_i = (-1)^i (b_i^2 + 2 sum_j (-1)^j b_(i-j) b_(i+j)) has the zeros y^2
+    int performed = 0;
+    for(; performed < squarings; performed++)
+    {
+        std::vector<highprecision> squared(order + 1);
+        bool finite = true;
+        for(size_t i = 0; i <= order; i++)
+        {
+            highprecision sum = b[i] * b[i];
+            for(size_t j = 1; j <= i && i + j <= order; j++)
+            {
+                sum += ((j % 2 == 0) ? 2 : -2) * b[i - j] * b[i + j];
+            }
+            squared[i] = (i % 2 == 0) ? sum : -sum;
+            finite = finite && std::isfinite(squared[i]);
+        }
+        if(!finite)
+        {
+            break;
+        }
+        b = squared;
+    }
+
+    // Upper convex hull of (i, log |b_i|), an edge from i to j belongs to j - i zeros of magnitude
+    // (|b_j| / |b_i|)^(1 / ((j - i) 2^k))
+    std::vector<size_t> hull;
+    for(size_t i = 0; i <= order; i++)
+    {
+        if(b[i] == 0)
+        {
+            continue;
+        }
+        while(hull.size() >= 2)
+        {
+            size_t first = hull[hull.size() - 2], second = hull.back();
+            highprecision cross = (std::log(std::abs(b[second])) - std::log(std::abs(b[first]))) * (i - first) -
+                                  (std::log(std::abs(b[i])) - std::log(std::abs(b[first]))) * (second - first);
+            if(cross > 0)
+            {
+                break;
+            }
+            hull.pop_back();
+        }
+        hull.push_back(i);
+    }
+    highprecision exponent = std::ldexp(1.0L, performed);
+    for(size_t e = 1; e < hull.size(); e++)
+    {
+        size_t count = hull[e] - hull[e - 1];
+        highprecision slope = (std::log(std::abs(b[hull[e]])) - std::log(std::abs(b[hull[e - 1]]))) / count;
+        magnitudes.insert(magnitudes.end(), count, radius * std::exp(slope / exponent));
+    }
+    std::sort(magnitudes.begin(), magnitudes.end());
+    return magnitudes;
+}
+
 std::vector<highprecision> Polynomial::FindZerosOfQuadraticTerms(Polynomial polynomialOfOrder2)
 {
     Polynomial workingPolynomial(polynomialOfOrder2);
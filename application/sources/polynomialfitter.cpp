@@ -0,0 +1,201 @@
+#include "../headers/polynomialfitter.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+PolynomialFitter::PolynomialFitter(const std::vector<highprecision>& x, int degree) :
+    NumberOfSamples(x.size()),
+    Degree(degree)
+{
+    if(degree < 0)
+    {
+        throw std::runtime_error("The degree must not be negative.");
+    }
+    size_t m = x.size();
+    size_t n = degree + 1;
+    if(m < n)
+    {
+        throw std::runtime_error("At least degree + 1 samples are needed.");
+    }
+
+    // Map the grid affinely onto [-1, 1]: t = (x - center) / halfWidth
+    auto [minX, maxX] = std::minmax_element(x.begin(), x.end());
+    highprecision center = (*maxX + *minX) / 2;
+    highprecision halfWidth = (*maxX - *minX) / 2;
+    if(halfWidth == 0)
+    {
+        halfWidth = 1;
+    }
+
+    // Columns of the chebyshev-vandermonde matrix, A[k][i] = T_k(t_i)
+    std::vector<std::vector<highprecision>> columns(n, std::vector<highprecision>(m, 1));
+    for(size_t i = 0; i < m; i++)
+    {
+        highprecision t = (x[i] - center) / halfWidth;
+        if(n > 1)
+        {
+            columns[1][i] = t;
+        }
+        for(size_t k = 2; k < n; k++)
+        {
+            columns[k][i] = 2 * t * columns[k - 1][i] - columns[k - 2][i];
+        }
+    }
+
+    // Householder QR. |T_k(t)| <= 1, so every column norm is at most sqrt(m).
+    highprecision rankThreshold = PolynomialFitter::RANK_TOLERANCE * std::sqrt((highprecision)m);
+    this->R.assign(n, std::vector<highprecision>(n, 0));
+    for(size_t k = 0; k < n; k++)
+    {
+        std::vector<highprecision> v(columns[k].begin() + k, columns[k].end());
+        highprecision norm = 0;
+        for(highprecision c : v)
+        {
+            norm += c * c;
+        }
+        norm = std::sqrt(norm);
+        if(norm <= rankThreshold)
+        {
+            throw std::runtime_error("The x values do not determine a polynomial of this degree (too few distinct values).");
+        }
+
+        highprecision alpha = (v[0] > 0) ? -norm : norm;
+        v[0] -= alpha;
+        highprecision vNorm = 0;
+        for(highprecision c : v)
+        {
+            vNorm += c * c;
+        }
+
+        this->R[k][k] = alpha;
+        for(size_t j = k + 1; j < n; j++)
+        {
+            highprecision dot = 0;
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                dot += v[i] * columns[j][k + i];
+            }
+            highprecision factor = 2 * dot / vNorm;
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                columns[j][k + i] -= factor * v[i];
+            }
+            this->R[k][j] = columns[j][k];
+        }
+        this->Reflectors.push_back(v);
+        this->ReflectorNorms.push_back(vNorm);
+    }
+
+    // T_k(t(x)) in the monomial basis of x, by T_(k+1) = 2t T_k - T_(k-1) with t = x / halfWidth - center / halfWidth
+    highprecision t0 = -center / halfWidth;
+    highprecision t1 = 1 / halfWidth;
+    this->BasisToMonomial.assign(n, std::vector<highprecision>(n, 0));
+    this->BasisToMonomial[0][0] = 1;
+    if(n > 1)
+    {
+        this->BasisToMonomial[1][0] = t0;
+        this->BasisToMonomial[1][1] = t1;
+    }
+    for(size_t k = 2; k < n; k++)
+    {
+        for(size_t i = 0; i < k; i++)
+        {
+            this->BasisToMonomial[k][i] += 2 * t0 * this->BasisToMonomial[k - 1][i];
+            this->BasisToMonomial[k][i + 1] += 2 * t1 * this->BasisToMonomial[k - 1][i];
+        }
+        for(size_t i = 0; i + 1 < k; i++)
+        {
+            this->BasisToMonomial[k][i] -= this->BasisToMonomial[k - 2][i];
+        }
+    }
+}
+
+/* Accessors/Mutators ********************************************************/
+
+int PolynomialFitter::GetDegree() const
+{
+    return this->Degree;
+}
+
+size_t PolynomialFitter::GetNumberOfSamples() const
+{
+    return this->NumberOfSamples;
+}
+
+/* Public Methods ************************************************************/
+
+Polynomial PolynomialFitter::Fit(const std::vector<highprecision>& y) const
+{
+    if(y.size() != this->NumberOfSamples)
+    {
+        throw std::runtime_error("The number of y values has to match the number of x values.");
+    }
+    size_t n = this->Degree + 1;
+
+    // Q^T y, then back substitution R c = (Q^T y)[0..n-1]
+    std::vector<highprecision> values(y);
+    this->ApplyReflectors(values);
+    std::vector<highprecision> chebyshev(n, 0);
+    for(size_t k = n; k-- > 0;)
+    {
+        highprecision sum = values[k];
+        for(size_t j = k + 1; j < n; j++)
+        {
+            sum -= this->R[k][j] * chebyshev[j];
+        }
+        chebyshev[k] = sum / this->R[k][k];
+    }
+
+    CoefficientList coefficients(n, 0);
+    for(size_t k = 0; k < n; k++)
+    {
+        for(size_t i = 0; i <= k; i++)
+        {
+            coefficients[n - 1 - i] += chebyshev[k] * this->BasisToMonomial[k][i];
+        }
+    }
+    return Polynomial(coefficients);
+}
+
+std::vector<Polynomial> PolynomialFitter::Fit(const std::vector<std::vector<highprecision>>& datasets, TaskPool& pool) const
+{
+    std::vector<Polynomial> fits(datasets.size());
+    pool.ParallelFor(datasets.size(), [&](size_t i)
+    {
+        fits[i] = this->Fit(datasets[i]);
+    });
+    return fits;
+}
+
+std::vector<Polynomial> PolynomialFitter::Fit(const std::vector<std::vector<highprecision>>& datasets) const
+{
+    TaskPool pool;
+    return this->Fit(datasets, pool);
+}
+
+/* Private Methods ***********************************************************/
+
+void PolynomialFitter::ApplyReflectors(std::vector<highprecision>& values) const
+{
+    for(size_t k = 0; k < this->Reflectors.size(); k++)
+    {
+        const std::vector<highprecision>& v = this->Reflectors[k];
+        highprecision dot = 0;
+        for(size_t i = 0; i < v.size(); i++)
+        {
+            dot += v[i] * values[k + i];
+        }
+        highprecision factor = 2 * dot / this->ReflectorNorms[k];
+        for(size_t i = 0; i < v.size(); i++)
+        {
+            values[k + i] -= factor * v[i];
+        }
+    }
+}
+
+} // namespace Vath
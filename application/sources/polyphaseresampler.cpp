@@ -0,0 +1,117 @@
+#include "../headers/polyphaseresampler.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+PolyphaseResampler::PolyphaseResampler(const Polynomial& prototype, size_t interpolation, size_t decimation)
+{
+    CoefficientList coefficients = prototype.GetCoefficients();
+    this->Initialize(std::vector<highprecision>(coefficients.rbegin(), coefficients.rend()), interpolation, decimation);
+}
+
+PolyphaseResampler::PolyphaseResampler(const std::vector<highprecision>& taps, size_t interpolation, size_t decimation)
+{
+    this->Initialize(taps, interpolation, decimation);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+size_t PolyphaseResampler::GetInterpolation() const
+{
+    return this->Interpolation;
+}
+
+size_t PolyphaseResampler::GetDecimation() const
+{
+    return this->Decimation;
+}
+
+size_t PolyphaseResampler::GetTapsPerPhase() const
+{
+    return this->TapsPerPhase;
+}
+
+/* Public Methods ************************************************************/
+
+std::vector<highprecision> PolyphaseResampler::Process(const std::vector<highprecision>& input)
+{
+    // window[i] is x[n - (K - 1) + i] relative to the first new input n, so the K inputs ending at n0 start at n0
+    size_t count = this->TapsPerPhase;
+    std::vector<double> window(this->History);
+    for(highprecision x : input)
+    {
+        window.push_back((double)x);
+    }
+
+    std::vector<highprecision> output;
+    output.reserve(input.size() * this->Interpolation / this->Decimation + 1);
+    for(; this->Time / this->Interpolation < input.size(); this->Time += this->Decimation)
+    {
+        size_t newest = this->Time / this->Interpolation;
+        size_t phase = this->Time % this->Interpolation;
+        output.push_back(PolyphaseResampler::DotProduct(&this->Phases[phase * count], &window[newest], count));
+    }
+    this->Time -= input.size() * this->Interpolation;
+    std::copy(window.end() - (count - 1), window.end(), this->History.begin());
+    return output;
+}
+
+void PolyphaseResampler::Reset()
+{
+    std::fill(this->History.begin(), this->History.end(), 0);
+    this->Time = 0;
+}
+
+/* Private Methods ***********************************************************/
+
+void PolyphaseResampler::Initialize(const std::vector<highprecision>& taps, size_t interpolation, size_t decimation)
+{
+    if(interpolation == 0 || decimation == 0)
+    {
+        throw std::runtime_error("The resampling factors have to be positive.");
+    }
+    if(taps.empty())
+    {
+        throw std::runtime_error("A filter needs at least one tap.");
+    }
+
+    this->Interpolation = interpolation;
+    this->Decimation = decimation;
+    this->TapsPerPhase = (taps.size() + interpolation - 1) / interpolation;
+    this->Phases = std::vector<double>(interpolation * this->TapsPerPhase, 0);
+    for(size_t p = 0; p < interpolation; p++)
+    {
+        for(size_t j = 0; j < this->TapsPerPhase && p + j * interpolation < taps.size(); j++)
+        {
+            this->Phases[p * this->TapsPerPhase + (this->TapsPerPhase - 1 - j)] = (double)(interpolation * taps[p + j * interpolation]);
+        }
+    }
+    this->History = std::vector<double>(this->TapsPerPhase - 1, 0);
+    this->Time = 0;
+}
+
+double PolyphaseResampler::DotProduct(const double* left, const double* right, size_t length)
+{
+    // Four independent sums, so the additions do not wait for each other
+    double sums[4] = {0, 0, 0, 0};
+    size_t i = 0;
+    for(; i + 4 <= length; i += 4)
+    {
+        sums[0] += left[i] * right[i];
+        sums[1] += left[i + 1] * right[i + 1];
+        sums[2] += left[i + 2] * right[i + 2];
+        sums[3] += left[i + 3] * right[i + 3];
+    }
+    for(; i < length; i++)
+    {
+        sums[0] += left[i] * right[i];
+    }
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+} // namespace Vath
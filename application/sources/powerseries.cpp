@@ -0,0 +1,333 @@
+#include "../headers/powerseries.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+PowerSeries::PowerSeries(const std::vector<highprecision>& coefficients, size_t precision) :
+    Coefficients(coefficients)
+{
+    if(precision == 0)
+    {
+        throw std::runtime_error("A power series needs at least one coefficient.");
+    }
+    this->Coefficients.resize(precision, 0);
+}
+
+PowerSeries::PowerSeries(const Polynomial& polynomial, size_t precision)
+{
+    CoefficientList coefficients = polynomial.GetCoefficients();
+    *this = PowerSeries(std::vector<highprecision>(coefficients.rbegin(), coefficients.rend()), precision);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+size_t PowerSeries::GetPrecision() const
+{
+    return this->Coefficients.size();
+}
+
+std::vector<highprecision> PowerSeries::GetCoefficients() const
+{
+    return this->Coefficients;
+}
+
+highprecision PowerSeries::GetCoefficient(size_t k) const
+{
+    return (k < this->Coefficients.size()) ? this->Coefficients[k] : 0;
+}
+
+/* Public Methods ************************************************************/
+
+Polynomial PowerSeries::ToPolynomial() const
+{
+    CoefficientList coefficients = Polynomial::TrimCoefficients(CoefficientList(this->Coefficients.rbegin(), this->Coefficients.rend()), 0);
+    if(coefficients.empty())
+    {
+        coefficients.push_back(0);
+    }
+    return Polynomial(coefficients);
+}
+
+PowerSeries PowerSeries::Inverse() const
+{
+    return PowerSeries(PowerSeries::Invert(this->Coefficients, this->GetPrecision()), this->GetPrecision());
+}
+
+PowerSeries PowerSeries::Log() const
+{
+    // log f = log c_0 + log(f / c_0)
+    highprecision constant = this->Coefficients[0];
+    if(!(constant > 0))
+    {
+        throw std::runtime_error("The logarithm needs a positive constant coefficient.");
+    }
+    std::vector<highprecision> normalized(this->Coefficients);
+    for(highprecision& c : normalized)
+    {
+        c /= constant;
+    }
+    std::vector<highprecision> logarithm = PowerSeries::Logarithm(normalized, this->GetPrecision());
+    logarithm[0] = std::log(constant);
+    return PowerSeries(logarithm, this->GetPrecision());
+}
+
+PowerSeries PowerSeries::Exp() const
+{
+    // exp f = e^c_0 exp(f - c_0), the latter by g <- g (1 - log g + f)
+    size_t n = this->GetPrecision();
+    std::vector<highprecision> shifted(this->Coefficients);
+    shifted[0] = 0;
+    std::vector<highprecision> exponential{1};
+    size_t known = 1;
+    while(known < n)
+    {
+        known = std::min(2 * known, n);
+        exponential.resize(known, 0);
+        std::vector<highprecision> correction = PowerSeries::Logarithm(exponential, known);
+        for(size_t k = 0; k < known; k++)
+        {
+            correction[k] = shifted[k] - correction[k];
+        }
+        correction[0] += 1;
+        exponential = PowerSeries::Multiply(exponential, correction, known);
+    }
+
+    highprecision factor = std::exp(this->Coefficients[0]);
+    for(highprecision& c : exponential)
+    {
+        c *= factor;
+    }
+    return PowerSeries(exponential, n);
+}
+
+PowerSeries PowerSeries::Sqrt() const
+{
+    return *this * this->InverseSqrt();
+}
+
+PowerSeries PowerSeries::InverseSqrt() const
+{
+    if(!(this->Coefficients[0] > 0))
+    {
+        throw std::runtime_error("The square root needs a positive constant coefficient.");
+    }
+
+    // h <- h + h (1 - f h^2) / 2
+    size_t n = this->GetPrecision();
+    std::vector<highprecision> inverse{1 / std::sqrt(this->Coefficients[0])};
+    size_t known = 1;
+    while(known < n)
+    {
+        known = std::min(2 * known, n);
+        std::vector<highprecision> truncated(this->Coefficients.begin(), this->Coefficients.begin() + known);
+        std::vector<highprecision> residual = PowerSeries::Multiply(truncated, PowerSeries::Multiply(inverse, inverse, known), known);
+        for(highprecision& c : residual)
+        {
+            c = -c / 2;
+        }
+        residual[0] += 1.5L;
+        inverse = PowerSeries::Multiply(inverse, residual, known);
+    }
+    return PowerSeries(inverse, n);
+}
+
+PowerSeries PowerSeries::Derivative() const
+{
+    size_t n = this->GetPrecision();
+    if(n == 1)
+    {
+        return PowerSeries(std::vector<highprecision>{0}, 1);
+    }
+    std::vector<highprecision> derivative(n - 1);
+    for(size_t k = 1; k < n; k++)
+    {
+        derivative[k - 1] = k * this->Coefficients[k];
+    }
+    return PowerSeries(derivative, n - 1);
+}
+
+PowerSeries PowerSeries::Integral() const
+{
+    size_t n = this->GetPrecision();
+    std::vector<highprecision> integral(n + 1, 0);
+    for(size_t k = 0; k < n; k++)
+    {
+        integral[k + 1] = this->Coefficients[k] / (k + 1);
+    }
+    return PowerSeries(integral, n + 1);
+}
+
+std::vector<highprecision> PowerSeries::GetImpulseResponse(const PolynomialFraction& filter, size_t length)
+{
+    if(length == 0)
+    {
+        return std::vector<highprecision>();
+    }
+    CoefficientList denominator = Polynomial::TrimCoefficients(filter.denominator.GetCoefficients(), 0);
+    CoefficientList numerator = Polynomial::TrimCoefficients(filter.numerator.GetCoefficients(), 0);
+    if(denominator.empty() || denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator must not be 0.");
+    }
+    if(numerator.size() > denominator.size())
+    {
+        throw std::runtime_error("The filter is not causal, the numerator must not have a higher order than the denominator.");
+    }
+
+    // Divided by z^p, highest order first in z is lowest order first in z^-1
+    std::vector<highprecision> a(denominator.begin(), denominator.end());
+    std::vector<highprecision> b(denominator.size() - numerator.size(), 0);
+    b.insert(b.end(), numerator.begin(), numerator.end());
+    return PowerSeries::Multiply(b, PowerSeries::Invert(a, length), length);
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<highprecision> PowerSeries::Multiply(const std::vector<highprecision>& left, const std::vector<highprecision>& right, size_t length)
+{
+    // Both factors share one complex transform, whose rounding error grows with the larger one, so they are brought
+    // to the same magnitude first
+    std::vector<highprecision> l(left.begin(), left.begin() + std::min(length, left.size()));
+    std::vector<highprecision> r(right.begin(), right.begin() + std::min(length, right.size()));
+    highprecision leftMaximum = 0, rightMaximum = 0;
+    for(highprecision c : l)
+    {
+        leftMaximum = std::max(leftMaximum, std::abs(c));
+    }
+    for(highprecision c : r)
+    {
+        rightMaximum = std::max(rightMaximum, std::abs(c));
+    }
+    highprecision scale = (leftMaximum > 0 && rightMaximum > 0) ? std::sqrt(rightMaximum / leftMaximum) : 1;
+    for(highprecision& c : l)
+    {
+        c *= scale;
+    }
+    for(highprecision& c : r)
+    {
+        c /= scale;
+    }
+
+    std::vector<highprecision> product = FastFourierTransform<highprecision>::Convolve(l, r);
+    product.resize(length, 0);
+    return product;
+}
+
+std::vector<highprecision> PowerSeries::Invert(const std::vector<highprecision>& series, size_t length)
+{
+    if(series.empty() || series[0] == 0)
+    {
+        throw std::runtime_error("A power series with constant coefficient 0 has no inverse.");
+    }
+
+    // A short series is divided term by term, g_j = -(f_1 g_(j-1) + ... + f_p g_(j-p)) / f_0
+    size_t order = series.size() - 1;
+    while(order > 0 && series[order] == 0)
+    {
+        order--;
+    }
+    if(order <= PowerSeries::DIRECT_INVERSION_MAX_ORDER)
+    {
+        std::vector<highprecision> inverse(length, 0);
+        inverse[0] = 1 / series[0];
+        for(size_t j = 1; j < length; j++)
+        {
+            highprecision sum = 0;
+            for(size_t k = 1; k <= order && k <= j; k++)
+            {
+                sum += series[k] * inverse[j - k];
+            }
+            inverse[j] = -sum / series[0];
+        }
+        return inverse;
+    }
+
+    // Newton iteration g <- g - g (f g - 1), doubling the number of correct coefficients each step. The low half of
+    // f g - 1 vanishes, only its high half is computed into the new coefficients so the known ones stay exact.
+    std::vector<highprecision> inverse{1 / series[0]};
+    size_t known = 1;
+    while(known < length)
+    {
+        size_t next = std::min(2 * known, length);
+        std::vector<highprecision> residual = PowerSeries::Multiply(series, inverse, next);
+        residual.erase(residual.begin(), residual.begin() + known);
+        std::vector<highprecision> correction = PowerSeries::Multiply(inverse, residual, next - known);
+        inverse.resize(next);
+        for(size_t k = known; k < next; k++)
+        {
+            inverse[k] = -correction[k - known];
+        }
+        known = next;
+    }
+    inverse.resize(length, 0);
+    return inverse;
+}
+
+std::vector<highprecision> PowerSeries::Logarithm(const std::vector<highprecision>& series, size_t length)
+{
+    // log f = integral f' / f for c_0 = 1
+    std::vector<highprecision> logarithm(length, 0);
+    if(length == 1)
+    {
+        return logarithm;
+    }
+    std::vector<highprecision> derivative(length - 1, 0);
+    for(size_t k = 1; k < length && k < series.size(); k++)
+    {
+        derivative[k - 1] = k * series[k];
+    }
+    std::vector<highprecision> quotient = PowerSeries::Multiply(derivative, PowerSeries::Invert(series, length - 1), length - 1);
+    for(size_t k = 1; k < length; k++)
+    {
+        logarithm[k] = quotient[k - 1] / k;
+    }
+    return logarithm;
+}
+
+/* Operators *****************************************************************/
+
+PowerSeries operator +(const PowerSeries& left, const PowerSeries& right)
+{
+    size_t n = std::min(left.GetPrecision(), right.GetPrecision());
+    std::vector<highprecision> sum(n);
+    for(size_t k = 0; k < n; k++)
+    {
+        sum[k] = left.GetCoefficient(k) + right.GetCoefficient(k);
+    }
+    return PowerSeries(sum, n);
+}
+
+PowerSeries operator -(const PowerSeries& left, const PowerSeries& right)
+{
+    return left + right * -1.0L;
+}
+
+PowerSeries operator *(const PowerSeries& left, const PowerSeries& right)
+{
+    size_t n = std::min(left.GetPrecision(), right.GetPrecision());
+    return PowerSeries(PowerSeries::Multiply(left.Coefficients, right.Coefficients, n), n);
+}
+
+PowerSeries operator *(const PowerSeries& left, const highprecision right)
+{
+    std::vector<highprecision> scaled = left.GetCoefficients();
+    for(highprecision& c : scaled)
+    {
+        c *= right;
+    }
+    return PowerSeries(scaled, left.GetPrecision());
+}
+
+PowerSeries operator /(const PowerSeries& left, const PowerSeries& right)
+{
+    size_t n = std::min(left.GetPrecision(), right.GetPrecision());
+    return PowerSeries(left.GetCoefficients(), n) * PowerSeries(right.GetCoefficients(), n).Inverse();
+}
+
+} // namespace Vath
@@ -0,0 +1,399 @@
+#include "../headers/realrootisolator.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <limits>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+RealRootIsolator::RealRootIsolator() :
+    Pool()
+{
+}
+
+RealRootIsolator::RealRootIsolator(unsigned int numberOfThreads) :
+    Pool(numberOfThreads)
+{
+}
+
+/* Public Methods ************************************************************/
+
+std::vector<Interval> RealRootIsolator::Isolate(const Polynomial& function)
+{
+    CoefficientList coefficientList = function.GetCoefficients();
+    std::vector<highprecision> coefficients(coefficientList.begin(), coefficientList.end());
+    std::vector<Interval> isolated;
+
+    if(function.GetOrder() <= 0)
+    {
+        if(coefficients[0] == 0)
+        {
+            throw std::runtime_error("The zero polynomial has infinitely many zeros. Cant isolate them.");
+        }
+        return isolated;
+    }
+
+    // A zero at the origin is exact, take it out
+    bool zeroAtOrigin = false;
+    while(coefficients.size() > 1 && coefficients.back() == 0)
+    {
+        coefficients.pop_back();
+        zeroAtOrigin = true;
+    }
+
+    // The negative zeros of p(x) are the positive zeros of p(-x)
+    std::vector<highprecision> mirrored(coefficients);
+    int order = mirrored.size() - 1;
+    for(int i = 0; i <= order; i++)
+    {
+        if((order - i) % 2 != 0)
+        {
+            mirrored[i] = -mirrored[i];
+        }
+    }
+
+    std::vector<Interval> positive, negative;
+    std::mutex positiveMutex, negativeMutex;
+    MoebiusTransformation identity{ 1, 0, 0, 1 };
+    Polynomial positiveFunction(CoefficientList(coefficients.begin(), coefficients.end()));
+    Polynomial negativeFunction(CoefficientList(mirrored.begin(), mirrored.end()));
+    highprecision positiveBound = RealRootIsolator::GetPositiveRootUpperBound(coefficients);
+    highprecision negativeBound = RealRootIsolator::GetPositiveRootUpperBound(mirrored);
+
+    this->Pool.Submit([&, this]()
+    {
+        this->IsolatePositive(coefficients, positiveFunction, identity, 0, positiveBound, zeroAtOrigin, false, positive, positiveMutex);
+    });
+    this->Pool.Submit([&, this]()
+    {
+        this->IsolatePositive(mirrored, negativeFunction, identity, 0, negativeBound, zeroAtOrigin, false, negative, negativeMutex);
+    });
+    this->Pool.WaitForAll();
+
+    for(const Interval& i : negative)
+    {
+        isolated.push_back(-i);
+    }
+    if(zeroAtOrigin)
+    {
+        isolated.push_back(Interval(0));
+    }
+    for(const Interval& i : positive)
+    {
+        isolated.push_back(i);
+    }
+
+    auto compareFn = [](const Interval& a, const Interval& b){return (a.Lower < b.Lower) || (a.Lower == b.Lower && a.Upper < b.Upper);};
+    std::sort(isolated.begin(), isolated.end(), compareFn);
+    return isolated;
+}
+
+std::vector<highprecision> RealRootIsolator::FindZeros(const Polynomial& function)
+{
+    std::vector<Interval> isolated = this->Isolate(function);
+    CoefficientList coefficientList = function.GetCoefficients();
+    std::vector<highprecision> coefficients(coefficientList.begin(), coefficientList.end());
+
+    // The isolating intervals are open, so refine with the zero at the origin divided out. Otherwise
+    // intervals like (0, 1) would report the origin again.
+    while(coefficients.size() > 1 && coefficients.back() == 0)
+    {
+        coefficients.pop_back();
+    }
+    std::vector<highprecision> zeros(isolated.size());
+
+    this->Pool.ParallelFor(isolated.size(), [&](size_t i)
+    {
+        zeros[i] = RealRootIsolator::Refine(coefficients, isolated[i]);
+    });
+
+    std::sort(zeros.begin(), zeros.end());
+    return zeros;
+}
+
+int RealRootIsolator::CountSignVariations(const std::vector<highprecision>& coefficients)
+{
+    int variations = 0;
+    int previousSign = 0;
+    for(highprecision c : coefficients)
+    {
+        int sign = (c > 0) - (c < 0);
+        if(sign == 0)
+        {
+            continue;
+        }
+        if(previousSign != 0 && sign != previousSign)
+        {
+            variations++;
+        }
+        previousSign = sign;
+    }
+    return variations;
+}
+
+/* Private Methods ***********************************************************/
+
+void RealRootIsolator::IsolatePositive(
+    std::vector<highprecision> coefficients,
+    const Polynomial& function,
+    MoebiusTransformation transformation,
+    int depth,
+    highprecision positiveBound,
+    bool originIsZero,
+    bool infinityIsZero,
+    std::vector<Interval>& isolated,
+    std::mutex& isolatedMutex
+    )
+{
+    MoebiusTransformation& m = transformation;
+    auto addInterval = [&](highprecision a, highprecision b)
+    {
+        std::lock_guard<std::mutex> lock(isolatedMutex);
+        isolated.push_back(Interval(std::min(a, b), std::max(a, b)));
+    };
+    auto atZero = [&](){ return m.B / m.D; };
+    auto atInfinity = [&](){ return (m.C == 0) ? std::max(positiveBound, atZero()) : (m.A / m.C); };
+
+    if(depth > RealRootIsolator::MAX_RECURSION_DEPTH)
+    {
+        throw std::runtime_error("Cant isolate the real zeros. The polynomial probably has multiple zeros.");
+    }
+
+    // Scaling does not change the sign variations, but keeps the coefficients from overflowing.
+    // Only scale by powers of two, which is exact.
+    highprecision maxCoefficient = 0;
+    for(highprecision c : coefficients)
+    {
+        maxCoefficient = std::max(maxCoefficient, std::abs(c));
+    }
+    int exponent = 0;
+    std::frexp(maxCoefficient, &exponent);
+    for(highprecision& c : coefficients)
+    {
+        c = std::ldexp(c, -exponent);
+    }
+
+    // A boundary which is an exact zero (already reported as [x, x]) has to be split off, so the intervals stay
+    // disjoint. Its zero is divided out, so the part next to it ends up without sign variations.
+    int variations = RealRootIsolator::CountSignVariations(coefficients);
+    if(variations == 0)
+    {
+        return;
+    }
+    if(variations == 1 && !originIsZero && !infinityIsZero)
+    {
+        addInterval(atZero(), atInfinity());
+        return;
+    }
+
+    // Move the origin to the lower bound of the positive zeros, which skips lots of unit steps.
+    // Integer shifts keep the transformation integral, so the interval boundaries stay exact.
+    highprecision lowerBound = std::floor(RealRootIsolator::GetPositiveRootLowerBound(coefficients));
+    if(lowerBound >= 1)
+    {
+        RealRootIsolator::TaylorShift(coefficients, lowerBound);
+        m.B += m.A * lowerBound;
+        m.D += m.C * lowerBound;
+        originIsZero = false;
+        if(RealRootIsolator::IsZeroAtOrigin(coefficients, function, m))
+        {
+            addInterval(atZero(), atZero());
+            coefficients.pop_back();
+            originIsZero = true;
+        }
+        variations = RealRootIsolator::CountSignVariations(coefficients);
+        if(variations == 0)
+        {
+            return;
+        }
+        if(variations == 1 && !originIsZero && !infinityIsZero)
+        {
+            addInterval(atZero(), atInfinity());
+            return;
+        }
+    }
+
+    // Zeros in (1, inf): p(x + 1)
+    std::vector<highprecision> right(coefficients);
+    RealRootIsolator::TaylorShift(right, 1);
+    MoebiusTransformation rightTransformation{ m.A, m.A + m.B, m.C, m.C + m.D };
+    int zeroAtOne = 0;
+    if(RealRootIsolator::IsZeroAtOrigin(right, function, rightTransformation))
+    {
+        addInterval(rightTransformation.B / rightTransformation.D, rightTransformation.B / rightTransformation.D);
+        right.pop_back();
+        zeroAtOne = 1;
+    }
+    int rightVariations = RealRootIsolator::CountSignVariations(right);
+
+    // Zeros in (0, 1): (x + 1)^n * p(1 / (x + 1)), only needed if Budan's theorem leaves some zeros for it
+    int leftVariations = variations - rightVariations - zeroAtOne;
+    std::vector<highprecision> left;
+    MoebiusTransformation leftTransformation{ m.B, m.A + m.B, m.D, m.C + m.D };
+    if(leftVariations > 0)
+    {
+        left = std::vector<highprecision>(coefficients.rbegin(), coefficients.rend());
+        RealRootIsolator::TaylorShift(left, 1);
+        if(zeroAtOne)
+        {
+            left.pop_back();
+        }
+    }
+
+    bool parallel = this->Pool.GetNumberOfThreads() > 0 &&
+                    (int)coefficients.size() > RealRootIsolator::PARALLEL_MIN_ORDER &&
+                    rightVariations > 0 && leftVariations > 0;
+    if(parallel)
+    {
+        this->Pool.Submit([this, right, &function, rightTransformation, depth, positiveBound, zeroAtOne, infinityIsZero, &isolated, &isolatedMutex]()
+        {
+            this->IsolatePositive(right, function, rightTransformation, depth + 1, positiveBound, zeroAtOne, infinityIsZero, isolated, isolatedMutex);
+        });
+    }
+    else if(rightVariations > 0)
+    {
+        this->IsolatePositive(right, function, rightTransformation, depth + 1, positiveBound, zeroAtOne, infinityIsZero, isolated, isolatedMutex);
+    }
+    if(leftVariations > 0)
+    {
+        // The left part is mirrored, its infinity is the origin of this one
+        this->IsolatePositive(left, function, leftTransformation, depth + 1, positiveBound, zeroAtOne, originIsZero, isolated, isolatedMutex);
+    }
+}
+
+void RealRootIsolator::TaylorShift(std::vector<highprecision>& coefficients, highprecision shift)
+{
+    int order = coefficients.size() - 1;
+    for(int i = 0; i < order; i++)
+    {
+        for(int j = 1; j <= order - i; j++)
+        {
+            coefficients[j] += shift * coefficients[j - 1];
+        }
+    }
+}
+
+bool RealRootIsolator::IsZeroAtOrigin(std::vector<highprecision>& coefficients, const Polynomial& function, const MoebiusTransformation& transformation)
+{
+    // The constant term is D^n * p(B / D), but it went through all taylor shifts so far. The rounding errors of
+    // high orders can flip its sign or fake a zero, so p itself is evaluated with an error bound at the split point.
+    Interval value = function.EvaluateAt(Interval(transformation.B) / Interval(transformation.D));
+    highprecision magnitude = 0;
+    for(highprecision c : coefficients)
+    {
+        magnitude += std::abs(c);
+    }
+    highprecision tolerance = 2 * coefficients.size() * std::numeric_limits<highprecision>::epsilon() * magnitude;
+
+    if(!value.Contains(0))
+    {
+        // Not a zero, but the sign has to be right. Otherwise a zero next to the split point slips through both halves.
+        if(coefficients.back() == 0 || std::signbit(coefficients.back()) != std::signbit(value.Lower))
+        {
+            coefficients.back() = std::copysign(tolerance, value.Lower);
+        }
+        return false;
+    }
+    return std::abs(coefficients.back()) <= tolerance;
+}
+
+highprecision RealRootIsolator::GetPositiveRootUpperBound(const std::vector<highprecision>& coefficients)
+{
+    // Bound by Kioustelidis: 2 * max((|a_i| / a_n)^(1/(n-i))) over all negative a_i, with a_n > 0
+    highprecision leading = coefficients[0];
+    highprecision bound = 0;
+    for(size_t i = 1; i < coefficients.size(); i++)
+    {
+        highprecision normalized = coefficients[i] / leading;
+        if(normalized < 0)
+        {
+            bound = std::max(bound, std::pow(-normalized, (highprecision)1 / i));
+        }
+    }
+    return 2 * bound;
+}
+
+highprecision RealRootIsolator::GetPositiveRootLowerBound(const std::vector<highprecision>& coefficients)
+{
+    // The positive zeros of x^n * p(1/x) are the reciprocals of the ones of p(x)
+    std::vector<highprecision> reversed(coefficients.rbegin(), coefficients.rend());
+    highprecision reversedBound = RealRootIsolator::GetPositiveRootUpperBound(reversed);
+    return (reversedBound > 0) ? (1 / reversedBound) : 0;
+}
+
+highprecision RealRootIsolator::Refine(const std::vector<highprecision>& coefficients, const Interval& isolatingInterval)
+{
+    auto evaluate = [&coefficients](highprecision x, highprecision& derivative)
+    {
+        highprecision value = 0;
+        derivative = 0;
+        for(highprecision c : coefficients)
+        {
+            derivative = derivative * x + value;
+            value = value * x + c;
+        }
+        return value;
+    };
+
+    highprecision lower = isolatingInterval.Lower, upper = isolatingInterval.Upper;
+    highprecision derivative = 0;
+    if(lower == upper)
+    {
+        return lower;
+    }
+    highprecision lowerValue = evaluate(lower, derivative);
+    highprecision upperValue = evaluate(upper, derivative);
+
+    // The interval is open, a zero on a boundary is a neighbouring one. Next to it, the sign is the opposite
+    // of the one at the other boundary, since exactly one zero lies in between.
+    if(lowerValue == 0 && upperValue != 0)
+    {
+        lowerValue = -upperValue;
+    }
+    else if(upperValue == 0 && lowerValue != 0)
+    {
+        upperValue = -lowerValue;
+    }
+    if(lowerValue == 0 || std::signbit(lowerValue) == std::signbit(upperValue))
+    {
+        // Rounding errors ate the sign change, the interval is still good for a starting point
+        CoefficientList coefficientList(coefficients.begin(), coefficients.end());
+        return Polynomial::ApproximateZeroByHalleysMethod(Polynomial(coefficientList), isolatingInterval.GetMidpoint());
+    }
+
+    // Safeguarded newton: take the newton step if it stays within the bracket, otherwise bisect
+    highprecision x = isolatingInterval.GetMidpoint();
+    for(int iteration = 0; iteration < RealRootIsolator::REFINEMENT_MAX_ITERATIONS; iteration++)
+    {
+        highprecision value = evaluate(x, derivative);
+        if(value == 0)
+        {
+            return x;
+        }
+        if(std::signbit(value) == std::signbit(lowerValue))
+        {
+            lower = x;
+        }
+        else
+        {
+            upper = x;
+        }
+
+        highprecision next = (derivative != 0) ? (x - value / derivative) : lower;
+        if(!(next > lower && next < upper))
+        {
+            next = lower + (upper - lower) / 2;
+        }
+        if(next == x || upper - lower <= std::numeric_limits<highprecision>::epsilon() * std::abs(x))
+        {
+            return next;
+        }
+        x = next;
+    }
+    return x;
+}
+
+} // namespace Vath
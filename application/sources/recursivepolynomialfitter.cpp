@@ -0,0 +1,242 @@
+#include "../headers/recursivepolynomialfitter.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+RecursivePolynomialFitter::RecursivePolynomialFitter(int degree, highprecision forgettingFactor, size_t windowSize) :
+    Degree(degree),
+    ForgettingFactor(forgettingFactor),
+    WindowSize(windowSize)
+{
+    if(degree < 0)
+    {
+        throw std::runtime_error("The degree must not be negative.");
+    }
+    if(!(forgettingFactor > 0 && forgettingFactor <= 1))
+    {
+        throw std::runtime_error("The forgetting factor has to be in (0, 1].");
+    }
+    if(windowSize != 0 && windowSize < (size_t)degree + 1)
+    {
+        throw std::runtime_error("The window has to hold at least degree + 1 samples.");
+    }
+    this->Reset();
+}
+
+/* Accessors/Mutators ********************************************************/
+
+int RecursivePolynomialFitter::GetDegree() const
+{
+    return this->Degree;
+}
+
+highprecision RecursivePolynomialFitter::GetForgettingFactor() const
+{
+    return this->ForgettingFactor;
+}
+
+size_t RecursivePolynomialFitter::GetWindowSize() const
+{
+    return this->WindowSize;
+}
+
+size_t RecursivePolynomialFitter::Count() const
+{
+    return this->NumberOfSamples;
+}
+
+highprecision RecursivePolynomialFitter::GetResidualSumOfSquares() const
+{
+    return this->ResidualSquares;
+}
+
+/* Public Methods ************************************************************/
+
+void RecursivePolynomialFitter::Add(highprecision x, highprecision y)
+{
+    // Fade out every previous sample by lambda (R and z carry the square root of the weights)
+    if(this->ForgettingFactor != 1)
+    {
+        highprecision scale = std::sqrt(this->ForgettingFactor);
+        for(size_t i = 0; i < this->R.size(); i++)
+        {
+            for(size_t j = i; j < this->R.size(); j++)
+            {
+                this->R[i][j] *= scale;
+            }
+            this->Z[i] *= scale;
+        }
+        this->ResidualSquares *= this->ForgettingFactor;
+    }
+
+    this->Update(this->GetBasis(x), y);
+    this->NumberOfSamples++;
+
+    if(this->WindowSize > 0)
+    {
+        this->Window.push_back(std::make_pair(x, y));
+        if(this->Window.size() > this->WindowSize)
+        {
+            // The oldest sample has been faded out WindowSize times since it was added
+            std::pair<highprecision, highprecision> oldest = this->Window.front();
+            this->Window.pop_front();
+            highprecision weight = std::sqrt(std::pow(this->ForgettingFactor, (highprecision)this->WindowSize));
+            std::vector<highprecision> row = this->GetBasis(oldest.first);
+            for(highprecision& value : row)
+            {
+                value *= weight;
+            }
+            this->Downdate(row, oldest.second * weight);
+            this->NumberOfSamples--;
+        }
+    }
+}
+
+bool RecursivePolynomialFitter::IsDetermined() const
+{
+    highprecision maxDiagonal = 0;
+    for(size_t i = 0; i < this->R.size(); i++)
+    {
+        maxDiagonal = std::max(maxDiagonal, std::abs(this->R[i][i]));
+    }
+    for(size_t i = 0; i < this->R.size(); i++)
+    {
+        if(!(std::abs(this->R[i][i]) > RecursivePolynomialFitter::RANK_TOLERANCE * maxDiagonal))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Polynomial RecursivePolynomialFitter::GetPolynomial() const
+{
+    if(!this->IsDetermined())
+    {
+        throw std::runtime_error("The samples do not determine a polynomial of this degree yet.");
+    }
+
+    // Back substitution R c = z, the basis is 1, x, x^2, ..., so c is lowest order first
+    size_t n = this->R.size();
+    std::vector<highprecision> c(n, 0);
+    for(size_t k = n; k-- > 0;)
+    {
+        highprecision sum = this->Z[k];
+        for(size_t j = k + 1; j < n; j++)
+        {
+            sum -= this->R[k][j] * c[j];
+        }
+        c[k] = sum / this->R[k][k];
+    }
+    return Polynomial(CoefficientList(c.rbegin(), c.rend()));
+}
+
+void RecursivePolynomialFitter::Reset()
+{
+    size_t n = this->Degree + 1;
+    this->R.assign(n, std::vector<highprecision>(n, 0));
+    this->Z.assign(n, 0);
+    this->ResidualSquares = 0;
+    this->NumberOfSamples = 0;
+    this->Window.clear();
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<highprecision> RecursivePolynomialFitter::GetBasis(highprecision x) const
+{
+    std::vector<highprecision> row(this->Degree + 1, 1);
+    for(size_t i = 1; i < row.size(); i++)
+    {
+        row[i] = row[i - 1] * x;
+    }
+    return row;
+}
+
+void RecursivePolynomialFitter::Update(std::vector<highprecision> row, highprecision y)
+{
+    // Rotate [row | y] into [R | z] with givens rotations, one per column
+    size_t n = this->R.size();
+    for(size_t k = 0; k < n; k++)
+    {
+        if(row[k] == 0)
+        {
+            continue;
+        }
+        highprecision r = this->R[k][k];
+        highprecision h = std::hypot(r, row[k]);
+        highprecision c = r / h;
+        highprecision s = row[k] / h;
+        this->R[k][k] = h;
+        for(size_t j = k + 1; j < n; j++)
+        {
+            highprecision rkj = this->R[k][j];
+            this->R[k][j] = c * rkj + s * row[j];
+            row[j] = c * row[j] - s * rkj;
+        }
+        highprecision zk = this->Z[k];
+        this->Z[k] = c * zk + s * y;
+        y = c * y - s * zk;
+    }
+    // What is left of y is orthogonal to the basis, i.e. the residual of the new sample
+    this->ResidualSquares += y * y;
+}
+
+void RecursivePolynomialFitter::Downdate(std::vector<highprecision> row, highprecision y)
+{
+    // Rotate [row | y] out of [R | z] with hyperbolic rotations, the inverse of Update()
+    size_t n = this->R.size();
+    for(size_t k = 0; k < n; k++)
+    {
+        if(row[k] == 0)
+        {
+            continue;
+        }
+        highprecision r = this->R[k][k];
+        if(!(std::abs(row[k]) < std::abs(r)))
+        {
+            // Only happens if the remaining samples do not determine the column any more, start over from the window
+            this->RebuildFromWindow();
+            return;
+        }
+        highprecision rho = std::sqrt((r - row[k]) * (r + row[k]));
+        highprecision c = rho / r;
+        highprecision s = row[k] / r;
+        this->R[k][k] = rho;
+        for(size_t j = k + 1; j < n; j++)
+        {
+            this->R[k][j] = (this->R[k][j] - s * row[j]) / c;
+            row[j] = c * row[j] - s * this->R[k][j];
+        }
+        this->Z[k] = (this->Z[k] - s * y) / c;
+        y = c * y - s * this->Z[k];
+    }
+    this->ResidualSquares = std::max((highprecision)0, this->ResidualSquares - y * y);
+}
+
+void RecursivePolynomialFitter::RebuildFromWindow()
+{
+    size_t n = this->Degree + 1;
+    this->R.assign(n, std::vector<highprecision>(n, 0));
+    this->Z.assign(n, 0);
+    this->ResidualSquares = 0;
+
+    // The i-th oldest sample within the window has been faded out (size - 1 - i) times
+    for(size_t i = 0; i < this->Window.size(); i++)
+    {
+        highprecision weight = std::sqrt(std::pow(this->ForgettingFactor, (highprecision)(this->Window.size() - 1 - i)));
+        std::vector<highprecision> row = this->GetBasis(this->Window[i].first);
+        for(highprecision& value : row)
+        {
+            value *= weight;
+        }
+        this->Update(row, this->Window[i].second * weight);
+    }
+}
+
+} // namespace Vath
@@ -0,0 +1,325 @@
+#include "../headers/secondordersections.hpp"
+#include <algorithm>
+#include <numbers>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+SecondOrderSections::SecondOrderSections(const ZeroPoleGain& filter, SectionScaling scaling)
+{
+    this->Build(filter.GetZeros(), filter.GetPoles(), filter.GetGain(), scaling);
+}
+
+SecondOrderSections::SecondOrderSections(const PolynomialFraction& filter, SectionScaling scaling)
+{
+    ZeroPoleGain factored = ZeroPoleGain::FromTransferFunction(filter);
+    this->Build(factored.GetZeros(), factored.GetPoles(), factored.GetGain(), scaling);
+}
+
+/* Accessors/Mutators ********************************************************/
+
+size_t SecondOrderSections::Count() const
+{
+    return this->Coefficients.size() / SecondOrderSections::COEFFICIENTS_PER_SECTION;
+}
+
+std::vector<highprecision> SecondOrderSections::GetCoefficients() const
+{
+    return this->Coefficients;
+}
+
+/* Public Methods ************************************************************/
+
+std::complex<highprecision> SecondOrderSections::EvaluateAt(std::complex<highprecision> z) const
+{
+    Complex value = 1;
+    for(size_t k = 0; k < this->Count(); k++)
+    {
+        value *= SecondOrderSections::EvaluateSection(&this->Coefficients[k * SecondOrderSections::COEFFICIENTS_PER_SECTION], z);
+    }
+    return value;
+}
+
+PolynomialFraction SecondOrderSections::ToTransferFunction() const
+{
+    // Products in powers of z^-1, multiplied by z^(2n) they are the coefficients in powers of z, highest order first
+    std::vector<highprecision> numerator{1}, denominator{1};
+    for(size_t k = 0; k < this->Count(); k++)
+    {
+        const highprecision* c = &this->Coefficients[k * SecondOrderSections::COEFFICIENTS_PER_SECTION];
+        std::vector<highprecision> b{c[0], c[1], c[2]}, a{1, c[3], c[4]};
+        std::vector<highprecision> nextNumerator(numerator.size() + 2, 0), nextDenominator(denominator.size() + 2, 0);
+        for(size_t i = 0; i < numerator.size(); i++)
+        {
+            for(size_t j = 0; j < 3; j++)
+            {
+                nextNumerator[i + j] += numerator[i] * b[j];
+                nextDenominator[i + j] += denominator[i] * a[j];
+            }
+        }
+        numerator = nextNumerator;
+        denominator = nextDenominator;
+    }
+
+    // Poles at the origin, which only pad first order sections, cancel against the powers of z
+    while(denominator.size() > 1 && denominator.back() == 0 && numerator.back() == 0)
+    {
+        numerator.pop_back();
+        denominator.pop_back();
+    }
+    return PolynomialFraction{
+        .numerator = Polynomial(Polynomial::TrimCoefficients(CoefficientList(numerator.begin(), numerator.end()), 0)),
+        .denominator = Polynomial(CoefficientList(denominator.begin(), denominator.end()))
+    };
+}
+
+std::vector<highprecision> SecondOrderSections::Filter(const std::vector<highprecision>& signal) const
+{
+    // Section by section over the whole signal, so the coefficients and the state stay in registers
+    std::vector<highprecision> output(signal);
+    for(size_t k = 0; k < this->Count(); k++)
+    {
+        const highprecision* c = &this->Coefficients[k * SecondOrderSections::COEFFICIENTS_PER_SECTION];
+        highprecision b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        highprecision s1 = 0, s2 = 0;
+        for(highprecision& x : output)
+        {
+            highprecision y = b0 * x + s1;
+            s1 = b1 * x - a1 * y + s2;
+            s2 = b2 * x - a2 * y;
+            x = y;
+        }
+    }
+    return output;
+}
+
+/* Private Methods ***********************************************************/
+
+void SecondOrderSections::Build(const std::vector<Complex>& zeros, const std::vector<Complex>& poles, highprecision gain, SectionScaling scaling)
+{
+    if(zeros.size() > poles.size())
+    {
+        throw std::runtime_error("A filter with more zeros than poles is not causal and can not be split into second order sections.");
+    }
+    if(poles.empty())
+    {
+        this->Coefficients = std::vector<highprecision>{gain, 0, 0, 0, 0};
+        return;
+    }
+
+    // Every missing zero is a zero at infinity, i.e. a factor z^-1
+    std::vector<Complex> paddedZeros(zeros);
+    paddedZeros.resize(poles.size(), Complex(std::numeric_limits<highprecision>::infinity(), 0));
+    std::vector<Section> sections = SecondOrderSections::GroupPoles(poles);
+    SecondOrderSections::AssignZeros(sections, paddedZeros);
+
+    auto getRadius = [](const Section& section)
+    {
+        highprecision radius = 0;
+        for(const Complex& pole : section.Poles)
+        {
+            radius = std::max(radius, std::abs(pole));
+        }
+        return radius;
+    };
+    std::stable_sort(sections.begin(), sections.end(), [&](const Section& a, const Section& b){ return getRadius(a) < getRadius(b); });
+
+    this->Coefficients.clear();
+    for(const Section& section : sections)
+    {
+        std::vector<highprecision> b = SecondOrderSections::ExpandSection(section.Zeros);
+        std::vector<highprecision> a = SecondOrderSections::ExpandSection(section.Poles);
+        this->Coefficients.insert(this->Coefficients.end(), {b[0], b[1], b[2], a[1], a[2]});
+    }
+
+    if(scaling == SectionScaling::None)
+    {
+        for(size_t j = 0; j < 3; j++)
+        {
+            this->Coefficients[j] *= gain;
+        }
+        return;
+    }
+
+    // Every section but the last is scaled such that the response up to its output has unit norm, the last one
+    // takes the rest of the gain
+    std::vector<Complex> response(SecondOrderSections::SCALING_GRID_SIZE, Complex(1));
+    highprecision remainingGain = gain;
+    for(size_t k = 0; k < sections.size(); k++)
+    {
+        highprecision* c = &this->Coefficients[k * SecondOrderSections::COEFFICIENTS_PER_SECTION];
+        highprecision factor = remainingGain;
+        if(k + 1 < sections.size())
+        {
+            for(size_t i = 0; i < response.size(); i++)
+            {
+                highprecision w = std::numbers::pi_v<highprecision> * i / (response.size() - 1);
+                response[i] *= SecondOrderSections::EvaluateSection(c, std::polar<highprecision>(1, w));
+            }
+            factor = 1 / SecondOrderSections::GetNorm(response, scaling);
+            for(Complex& value : response)
+            {
+                value *= factor;
+            }
+            remainingGain /= factor;
+        }
+        for(size_t j = 0; j < 3; j++)
+        {
+            c[j] *= factor;
+        }
+    }
+}
+
+void SecondOrderSections::SplitRoots(const std::vector<Complex>& roots, std::vector<Complex>& real, std::vector<Complex>& upper)
+{
+    size_t lowerCount = 0;
+    for(const Complex& root : roots)
+    {
+        if(root.imag() == 0)
+        {
+            real.push_back(root);
+        }
+        else if(root.imag() > 0)
+        {
+            upper.push_back(root);
+        }
+        else
+        {
+            lowerCount++;
+        }
+    }
+    if(lowerCount != upper.size())
+    {
+        throw std::runtime_error("The non-real zeros and poles of a real filter have to come in conjugate pairs.");
+    }
+}
+
+std::vector<SecondOrderSections::Section> SecondOrderSections::GroupPoles(const std::vector<Complex>& poles)
+{
+    std::vector<Complex> real, upper;
+    SecondOrderSections::SplitRoots(poles, real, upper);
+
+    std::vector<Section> sections;
+    for(const Complex& pole : upper)
+    {
+        sections.push_back(Section{ .Poles = {pole, std::conj(pole)}, .Zeros = {} });
+    }
+    std::sort(real.begin(), real.end(), [](const Complex& a, const Complex& b){ return std::abs(a) > std::abs(b); });
+    for(size_t i = 0; i + 1 < real.size(); i += 2)
+    {
+        sections.push_back(Section{ .Poles = {real[i], real[i + 1]}, .Zeros = {} });
+    }
+
+    // The pole closest to the unit circle picks its zeros first, a first order section last (it takes the last
+    // real zero, which is left over because all others are taken in pairs)
+    auto getRadius = [](const Section& section){ return std::abs(section.Poles[0]); };
+    std::stable_sort(sections.begin(), sections.end(), [&](const Section& a, const Section& b){ return getRadius(a) > getRadius(b); });
+    if(real.size() % 2 == 1)
+    {
+        sections.push_back(Section{ .Poles = {real.back()}, .Zeros = {} });
+    }
+    return sections;
+}
+
+void SecondOrderSections::AssignZeros(std::vector<Section>& sections, const std::vector<Complex>& zeros)
+{
+    std::vector<Complex> real, upper;
+    SecondOrderSections::SplitRoots(zeros, real, upper);
+
+    // Removes and returns the real zero nearest to the pole
+    auto takeNearestReal = [&real](const Complex& pole)
+    {
+        if(real.empty())
+        {
+            throw std::runtime_error("The zeros could not be paired with the poles.");
+        }
+        auto nearest = std::min_element(real.begin(), real.end(), [&pole](const Complex& a, const Complex& b){ return std::abs(a - pole) < std::abs(b - pole); });
+        Complex zero = *nearest;
+        real.erase(nearest);
+        return zero;
+    };
+
+    for(Section& section : sections)
+    {
+        const Complex& pole = section.Poles[0];
+        if(section.Poles.size() == 1)
+        {
+            section.Zeros.push_back(takeNearestReal(pole));
+            continue;
+        }
+
+        highprecision realDistance = std::numeric_limits<highprecision>::infinity();
+        for(const Complex& zero : real)
+        {
+            realDistance = std::min(realDistance, std::abs(zero - pole));
+        }
+        auto nearestPair = std::min_element(upper.begin(), upper.end(), [&pole](const Complex& a, const Complex& b)
+        {
+            return std::min(std::abs(a - pole), std::abs(std::conj(a) - pole)) < std::min(std::abs(b - pole), std::abs(std::conj(b) - pole));
+        });
+
+        // A pair of real zeros has to be available, otherwise a conjugate pair must be
+        if(nearestPair != upper.end() && (real.size() < 2 || std::min(std::abs(*nearestPair - pole), std::abs(std::conj(*nearestPair) - pole)) <= realDistance))
+        {
+            section.Zeros = {*nearestPair, std::conj(*nearestPair)};
+            upper.erase(nearestPair);
+        }
+        else
+        {
+            section.Zeros.push_back(takeNearestReal(section.Poles[0]));
+            section.Zeros.push_back(takeNearestReal(section.Poles[1]));
+        }
+    }
+}
+
+std::vector<highprecision> SecondOrderSections::ExpandSection(const std::vector<Complex>& roots)
+{
+    // prod (1 - r z^-1) in powers of z^-1, a root at infinity contributes z^-1
+    std::vector<Complex> product{1, 0, 0};
+    size_t length = 1;
+    for(const Complex& root : roots)
+    {
+        for(size_t j = length; j > 0; j--)
+        {
+            product[j] = std::isinf(root.real()) ? product[j - 1] : product[j] - root * product[j - 1];
+        }
+        product[0] = std::isinf(root.real()) ? 0 : product[0];
+        length++;
+    }
+    return std::vector<highprecision>{product[0].real(), product[1].real(), product[2].real()};
+}
+
+SecondOrderSections::Complex SecondOrderSections::EvaluateSection(const highprecision* coefficients, Complex z)
+{
+    Complex w = 1.0L / z;
+    return (coefficients[0] + w * (coefficients[1] + w * coefficients[2])) / (1.0L + w * (coefficients[3] + w * coefficients[4]));
+}
+
+highprecision SecondOrderSections::GetNorm(const std::vector<Complex>& response, SectionScaling scaling)
+{
+    if(scaling == SectionScaling::LInfinity)
+    {
+        highprecision maximum = 0;
+        for(const Complex& value : response)
+        {
+            maximum = std::max(maximum, std::abs(value));
+        }
+        return maximum;
+    }
+
+    // sum h[n]^2 = 1 / pi * integral_0^pi |H|^2 dw by Parseval, integrated by the trapezoidal rule
+    highprecision energy = 0;
+    for(size_t i = 0; i < response.size(); i++)
+    {
+        highprecision weight = (i == 0 || i + 1 == response.size()) ? 0.5L : 1;
+        energy += weight * std::norm(response[i]);
+    }
+    return std::sqrt(energy / (response.size() - 1));
+}
+
+} // namespace Vath
@@ -0,0 +1,148 @@
+#include "../headers/stabilityanalysis.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Public Methods ************************************************************/
+
+bool StabilityAnalysis::IsSchurStable(const CoefficientList& coefficients)
+{
+    CoefficientList trimmed = Polynomial::TrimCoefficients(coefficients, 0);
+    if(trimmed.size() == 1 && trimmed[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has no defined stability.");
+    }
+
+    // Schur-Cohn recursion: with k = a_n / a_0, the polynomial a_0 z^n + ... + a_n has all zeros inside the unit
+    // circle iff |k| < 1 and the reduced polynomial b_i = a_i - k * a_(n-i), i = 0..n-1, has so as well.
+    // The usual division by (1 - k^2) is skipped, a positive factor does not change anything.
+    std::vector<highprecision> a(trimmed.begin(), trimmed.end());
+    for(int order = a.size() - 1; order > 0; order--)
+    {
+        highprecision k = a[order] / a[0];
+        if(!(std::abs(k) < 1))
+        {
+            return false;
+        }
+        for(int i = 0; i <= order / 2; i++)
+        {
+            highprecision front = a[i];
+            highprecision back = a[order - i];
+            a[i] = front - k * back;
+            a[order - i] = back - k * front;
+        }
+    }
+    return true;
+}
+
+bool StabilityAnalysis::IsSchurStable(const Polynomial& denominator)
+{
+    return StabilityAnalysis::IsSchurStable(denominator.GetCoefficients());
+}
+
+bool StabilityAnalysis::IsSchurStable(const PolynomialFraction& transferFunction)
+{
+    return StabilityAnalysis::IsSchurStable(transferFunction.denominator);
+}
+
+std::vector<bool> StabilityAnalysis::IsSchurStable(const std::vector<Polynomial>& denominators, TaskPool& pool)
+{
+    // std::vector<bool> packs bits, so concurrent writes have to go to a byte array first
+    std::vector<char> results(denominators.size(), 0);
+    pool.ParallelFor(denominators.size(), [&](size_t i)
+    {
+        results[i] = StabilityAnalysis::IsSchurStable(denominators[i]);
+    });
+    return std::vector<bool>(results.begin(), results.end());
+}
+
+std::vector<bool> StabilityAnalysis::IsSchurStable(const std::vector<Polynomial>& denominators)
+{
+    TaskPool pool;
+    return StabilityAnalysis::IsSchurStable(denominators, pool);
+}
+
+bool StabilityAnalysis::IsHurwitzStable(const CoefficientList& coefficients)
+{
+    CoefficientList trimmed = Polynomial::TrimCoefficients(coefficients, 0);
+    if(trimmed.size() == 1 && trimmed[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has no defined stability.");
+    }
+
+    int order = trimmed.size() - 1;
+    highprecision sign = (trimmed[0] > 0) ? 1 : -1;
+
+    // Necessary condition: all coefficients are non-zero and share the sign of the leading one
+    for(highprecision c : trimmed)
+    {
+        if(!(c * sign > 0))
+        {
+            return false;
+        }
+    }
+
+    // Routh array, only the two previous rows are kept. Row 0 holds a_0, a_2, ..., row 1 holds a_1, a_3, ...
+    size_t width = order / 2 + 2;
+    std::vector<highprecision> upper(width, 0), lower(width, 0), next(width, 0);
+    for(int i = 0; i <= order; i++)
+    {
+        if(i % 2 == 0)
+        {
+            upper[i / 2] = trimmed[i] * sign;
+        }
+        else
+        {
+            lower[i / 2] = trimmed[i] * sign;
+        }
+    }
+
+    // Stable iff the first column (row 0 to row n) has no sign change and no zero
+    for(int row = 2; row <= order; row++)
+    {
+        if(!(lower[0] > 0))
+        {
+            return false;
+        }
+        highprecision factor = upper[0] / lower[0];
+        for(size_t j = 0; j + 1 < width; j++)
+        {
+            next[j] = upper[j + 1] - factor * lower[j + 1];
+        }
+        next[width - 1] = 0;
+        std::swap(upper, lower);
+        std::swap(lower, next);
+    }
+    return lower[0] > 0 || order == 0;
+}
+
+bool StabilityAnalysis::IsHurwitzStable(const Polynomial& denominator)
+{
+    return StabilityAnalysis::IsHurwitzStable(denominator.GetCoefficients());
+}
+
+bool StabilityAnalysis::IsHurwitzStable(const PolynomialFraction& transferFunction)
+{
+    return StabilityAnalysis::IsHurwitzStable(transferFunction.denominator);
+}
+
+std::vector<bool> StabilityAnalysis::IsHurwitzStable(const std::vector<Polynomial>& denominators, TaskPool& pool)
+{
+    std::vector<char> results(denominators.size(), 0);
+    pool.ParallelFor(denominators.size(), [&](size_t i)
+    {
+        results[i] = StabilityAnalysis::IsHurwitzStable(denominators[i]);
+    });
+    return std::vector<bool>(results.begin(), results.end());
+}
+
+std::vector<bool> StabilityAnalysis::IsHurwitzStable(const std::vector<Polynomial>& denominators)
+{
+    TaskPool pool;
+    return StabilityAnalysis::IsHurwitzStable(denominators, pool);
+}
+
+} // namespace Vath
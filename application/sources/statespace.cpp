@@ -0,0 +1,370 @@
+#include "../headers/statespace.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+StateSpace::StateSpace(const StateSpaceMatrices& matrices) :
+    Matrices(matrices),
+    Order(matrices.a.size()),
+    InputCount(matrices.d.empty() ? 0 : matrices.d[0].size()),
+    OutputCount(matrices.d.size())
+{
+    if(this->InputCount == 0 || this->OutputCount == 0)
+    {
+        throw std::runtime_error("A system needs at least one input and one output, d has to be given.");
+    }
+    this->A = StateSpace::Flatten(matrices.a, this->Order, this->Order);
+    this->B = StateSpace::Flatten(matrices.b, this->Order, this->InputCount);
+    this->C = StateSpace::Flatten(matrices.c, this->OutputCount, this->Order);
+    this->D = StateSpace::Flatten(matrices.d, this->OutputCount, this->InputCount);
+    this->State = std::vector<double>(this->Order, 0);
+}
+
+StateSpace::StateSpace(const PolynomialFraction& transferFunction, CanonicalForm form) :
+    StateSpace(StateSpace::FromTransferFunction(transferFunction, form))
+{
+}
+
+/* Accessors/Mutators ********************************************************/
+
+StateSpaceMatrices StateSpace::GetMatrices() const
+{
+    return this->Matrices;
+}
+
+size_t StateSpace::GetOrder() const
+{
+    return this->Order;
+}
+
+size_t StateSpace::GetInputCount() const
+{
+    return this->InputCount;
+}
+
+size_t StateSpace::GetOutputCount() const
+{
+    return this->OutputCount;
+}
+
+std::vector<highprecision> StateSpace::GetState() const
+{
+    return std::vector<highprecision>(this->State.begin(), this->State.end());
+}
+
+void StateSpace::SetState(const std::vector<highprecision>& state)
+{
+    if(state.size() != this->Order)
+    {
+        throw std::runtime_error("The state has to have one value per state variable.");
+    }
+    std::copy(state.begin(), state.end(), this->State.begin());
+}
+
+/* Public Methods ************************************************************/
+
+StateSpaceMatrices StateSpace::FromTransferFunction(const PolynomialFraction& transferFunction, CanonicalForm form)
+{
+    CoefficientList denominator = Polynomial::TrimCoefficients(transferFunction.denominator.GetCoefficients(), 0);
+    CoefficientList numerator = Polynomial::TrimCoefficients(transferFunction.numerator.GetCoefficients(), 0);
+    if(denominator.empty() || denominator[0] == 0)
+    {
+        throw std::runtime_error("The denominator must not be 0.");
+    }
+    if(numerator.size() > denominator.size())
+    {
+        throw std::runtime_error("Only proper transfer functions can be realized, the numerator must not have a higher order than the denominator.");
+    }
+
+    // Monic denominator 1, a_1, ..., a_n and numerator b_0, ..., b_n
+    size_t n = denominator.size() - 1;
+    std::vector<highprecision> a(n + 1), b(n + 1, 0);
+    for(size_t i = 0; i <= n; i++)
+    {
+        a[i] = denominator[i] / denominator[0];
+    }
+    for(size_t i = 0; i < numerator.size(); i++)
+    {
+        b[n + 1 - numerator.size() + i] = numerator[i] / denominator[0];
+    }
+
+    // The direct feedthrough is split off: H = b_0 + sum (b_i - b_0 a_i) z^(n-i) / A(z)
+    StateSpaceMatrices matrices{
+        .a = std::vector<std::vector<highprecision>>(n, std::vector<highprecision>(n, 0)),
+        .b = std::vector<std::vector<highprecision>>(n, std::vector<highprecision>(1, 0)),
+        .c = std::vector<std::vector<highprecision>>(1, std::vector<highprecision>(n, 0)),
+        .d = std::vector<std::vector<highprecision>>(1, std::vector<highprecision>(1, b[0]))
+    };
+    for(size_t i = 0; i < n; i++)
+    {
+        highprecision residual = b[i + 1] - b[0] * a[i + 1];
+        if(form == CanonicalForm::Controllable)
+        {
+            matrices.a[0][i] = -a[i + 1];
+            matrices.c[0][i] = residual;
+        }
+        else
+        {
+            matrices.a[i][0] = -a[i + 1];
+            matrices.b[i][0] = residual;
+        }
+    }
+    for(size_t i = 1; i < n; i++)
+    {
+        if(form == CanonicalForm::Controllable)
+        {
+            matrices.a[i][i - 1] = 1;
+        }
+        else
+        {
+            matrices.a[i - 1][i] = 1;
+        }
+    }
+    if(n > 0)
+    {
+        (form == CanonicalForm::Controllable ? matrices.b[0][0] : matrices.c[0][0]) = 1;
+    }
+    return matrices;
+}
+
+PolynomialFraction StateSpace::ToTransferFunction(const StateSpaceMatrices& matrices, size_t output, size_t input)
+{
+    StateSpace system(matrices);
+    if(output >= system.OutputCount || input >= system.InputCount)
+    {
+        throw std::runtime_error("The system has no such input or output.");
+    }
+
+    size_t n = system.Order;
+    highprecision feedthrough = matrices.d[output][input];
+    CoefficientList denominator = StateSpace::GetCharacteristicPolynomial(matrices.a);
+
+    // det(zI - A + b c) = det(zI - A) (1 + c (zI - A)^-1 b)
+    std::vector<std::vector<highprecision>> coupled(matrices.a);
+    for(size_t i = 0; i < n; i++)
+    {
+        for(size_t j = 0; j < n; j++)
+        {
+            coupled[i][j] -= matrices.b[i][input] * matrices.c[output][j];
+        }
+    }
+    CoefficientList numerator = StateSpace::GetCharacteristicPolynomial(coupled);
+    for(size_t i = 0; i <= n; i++)
+    {
+        numerator[i] += (feedthrough - 1) * denominator[i];
+    }
+
+    numerator = Polynomial::TrimCoefficients(numerator, 0);
+    if(numerator.empty())
+    {
+        numerator.push_back(0);
+    }
+    return PolynomialFraction{ .numerator = Polynomial(numerator), .denominator = Polynomial(denominator) };
+}
+
+std::vector<std::vector<highprecision>> StateSpace::Process(const std::vector<std::vector<highprecision>>& inputs)
+{
+    if(inputs.size() != this->InputCount)
+    {
+        throw std::runtime_error("One sequence per input is needed.");
+    }
+    size_t length = inputs[0].size();
+    for(const std::vector<highprecision>& input : inputs)
+    {
+        if(input.size() != length)
+        {
+            throw std::runtime_error("All input sequences have to have the same length.");
+        }
+    }
+
+    size_t n = this->Order, p = this->InputCount, q = this->OutputCount;
+    std::vector<std::vector<highprecision>> outputs(q, std::vector<highprecision>(length));
+    std::vector<double> u(p * StateSpace::BLOCK_SIZE), w(n * StateSpace::BLOCK_SIZE), x(n * StateSpace::BLOCK_SIZE);
+    std::vector<double> y(q * StateSpace::BLOCK_SIZE), next(n);
+    for(size_t start = 0; start < length; start += StateSpace::BLOCK_SIZE)
+    {
+        // Every matrix of the block has one column per sample
+        size_t count = std::min(StateSpace::BLOCK_SIZE, length - start);
+        for(size_t i = 0; i < p; i++)
+        {
+            std::copy(inputs[i].begin() + start, inputs[i].begin() + start + count, u.begin() + i * count);
+        }
+        std::fill(w.begin(), w.begin() + n * count, 0);
+        StateSpace::Multiply(this->B.data(), u.data(), w.data(), n, p, count);
+
+        for(size_t k = 0; k < count; k++)
+        {
+            for(size_t i = 0; i < n; i++)
+            {
+                x[i * count + k] = this->State[i];
+            }
+            for(size_t i = 0; i < n; i++)
+            {
+                const double* row = &this->A[i * n];
+                double sum = w[i * count + k];
+                for(size_t j = 0; j < n; j++)
+                {
+                    sum += row[j] * this->State[j];
+                }
+                next[i] = sum;
+            }
+            std::swap(this->State, next);
+        }
+
+        std::fill(y.begin(), y.begin() + q * count, 0);
+        StateSpace::Multiply(this->C.data(), x.data(), y.data(), q, n, count);
+        StateSpace::Multiply(this->D.data(), u.data(), y.data(), q, p, count);
+        for(size_t i = 0; i < q; i++)
+        {
+            std::copy(y.begin() + i * count, y.begin() + (i + 1) * count, outputs[i].begin() + start);
+        }
+    }
+    return outputs;
+}
+
+std::vector<highprecision> StateSpace::Process(const std::vector<highprecision>& input)
+{
+    if(this->InputCount != 1 || this->OutputCount != 1)
+    {
+        throw std::runtime_error("The system has more than one input or output.");
+    }
+    return this->Process(std::vector<std::vector<highprecision>>{input})[0];
+}
+
+void StateSpace::Reset()
+{
+    std::fill(this->State.begin(), this->State.end(), 0);
+}
+
+/* Private Methods ***********************************************************/
+
+void StateSpace::Multiply(const double* left, const double* right, double* result, size_t rows, size_t inner, size_t columns)
+{
+    // result += left * right, tile by tile, the innermost loop runs along rows of right and result
+    for(size_t i0 = 0; i0 < rows; i0 += StateSpace::TILE_SIZE)
+    {
+        size_t i1 = std::min(rows, i0 + StateSpace::TILE_SIZE);
+        for(size_t k0 = 0; k0 < inner; k0 += StateSpace::TILE_SIZE)
+        {
+            size_t k1 = std::min(inner, k0 + StateSpace::TILE_SIZE);
+            for(size_t j0 = 0; j0 < columns; j0 += StateSpace::TILE_SIZE)
+            {
+                size_t j1 = std::min(columns, j0 + StateSpace::TILE_SIZE);
+                for(size_t i = i0; i < i1; i++)
+                {
+                    double* resultRow = &result[i * columns];
+                    for(size_t k = k0; k < k1; k++)
+                    {
+                        double factor = left[i * inner + k];
+                        const double* rightRow = &right[k * columns];
+                        for(size_t j = j0; j < j1; j++)
+                        {
+                            resultRow[j] += factor * rightRow[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+CoefficientList StateSpace::GetCharacteristicPolynomial(std::vector<std::vector<highprecision>> h)
+{
+    size_t n = h.size();
+
+    // Householder reduction to upper hessenberg form, a similarity transform which keeps the eigenvalues
+    for(size_t k = 0; k + 2 < n; k++)
+    {
+        highprecision alpha = 0;
+        for(size_t i = k + 1; i < n; i++)
+        {
+            alpha += h[i][k] * h[i][k];
+        }
+        alpha = (h[k + 1][k] > 0) ? -std::sqrt(alpha) : std::sqrt(alpha);
+        std::vector<highprecision> v(n, 0);
+        highprecision norm = 0;
+        for(size_t i = k + 1; i < n; i++)
+        {
+            v[i] = h[i][k] - ((i == k + 1) ? alpha : 0);
+            norm += v[i] * v[i];
+        }
+        if(norm == 0)
+        {
+            continue;
+        }
+        for(size_t j = 0; j < n; j++)
+        {
+            highprecision sum = 0;
+            for(size_t i = k + 1; i < n; i++)
+            {
+                sum += v[i] * h[i][j];
+            }
+            for(size_t i = k + 1; i < n; i++)
+            {
+                h[i][j] -= 2 * sum / norm * v[i];
+            }
+        }
+        for(size_t i = 0; i < n; i++)
+        {
+            highprecision sum = 0;
+            for(size_t j = k + 1; j < n; j++)
+            {
+                sum += h[i][j] * v[j];
+            }
+            for(size_t j = k + 1; j < n; j++)
+            {
+                h[i][j] -= 2 * sum / norm * v[j];
+            }
+        }
+    }
+
+    // p_k = (z - h_kk) p_(k-1) - sum_(i<k) h_ik (h_(i+1)i ... h_k(k-1)) p_(i-1) for the leading k x k blocks,
+    // coefficients lowest order first
+    std::vector<std::vector<highprecision>> p{ {1} };
+    for(size_t k = 1; k <= n; k++)
+    {
+        std::vector<highprecision> current(k + 1, 0);
+        for(size_t m = 0; m < k; m++)
+        {
+            current[m + 1] += p[k - 1][m];
+            current[m] -= h[k - 1][k - 1] * p[k - 1][m];
+        }
+        highprecision product = 1;
+        for(size_t i = k - 1; i >= 1; i--)
+        {
+            product *= h[i][i - 1];
+            highprecision factor = h[i - 1][k - 1] * product;
+            for(size_t m = 0; m < i; m++)
+            {
+                current[m] -= factor * p[i - 1][m];
+            }
+        }
+        p.push_back(current);
+    }
+    return CoefficientList(p[n].rbegin(), p[n].rend());
+}
+
+std::vector<double> StateSpace::Flatten(const std::vector<std::vector<highprecision>>& matrix, size_t rows, size_t columns)
+{
+    if(matrix.size() != rows)
+    {
+        throw std::runtime_error("The dimensions of the matrices do not fit together.");
+    }
+    std::vector<double> flat;
+    for(const std::vector<highprecision>& row : matrix)
+    {
+        if(row.size() != columns)
+        {
+            throw std::runtime_error("The dimensions of the matrices do not fit together.");
+        }
+        flat.insert(flat.end(), row.begin(), row.end());
+    }
+    return flat;
+}
+
+} // namespace Vath
@@ -0,0 +1,167 @@
+#include "../headers/sturmsequence.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+SturmSequence::SturmSequence(const Polynomial& function)
+{
+    CoefficientList current = Polynomial::TrimCoefficients(function.GetCoefficients(), 0);
+    if(current.size() == 1 && current[0] == 0)
+    {
+        throw std::runtime_error("The zero polynomial has no sturm chain.");
+    }
+
+    // Every member is scaled to a maximum coefficient magnitude of 1. A positive factor does not change any sign.
+    auto normalize = [](CoefficientList& coefficients)
+    {
+        highprecision maxCoefficient = 0;
+        for(highprecision c : coefficients)
+        {
+            maxCoefficient = std::max(maxCoefficient, std::abs(c));
+        }
+        for(highprecision& c : coefficients)
+        {
+            c /= maxCoefficient;
+        }
+    };
+
+    normalize(current);
+    this->Chain.push_back(std::vector<highprecision>(current.begin(), current.end()));
+    if(current.size() == 1)
+    {
+        return;
+    }
+
+    CoefficientList next = Polynomial::Differentiate(Polynomial(current)).GetCoefficients();
+    normalize(next);
+    while(true)
+    {
+        this->Chain.push_back(std::vector<highprecision>(next.begin(), next.end()));
+        if(next.size() == 1)
+        {
+            break;
+        }
+
+        CoefficientList quotient, remainder;
+        Polynomial::DivideCoefficients(current, next, quotient, remainder);
+        remainder = Polynomial::TrimCoefficients(remainder, SturmSequence::REMAINDER_TOLERANCE);
+        if(remainder.size() == 1 && std::abs(remainder[0]) <= SturmSequence::REMAINDER_TOLERANCE)
+        {
+            // The last non-zero member is the gcd of p and p', the chain is complete
+            break;
+        }
+
+        for(highprecision& c : remainder)
+        {
+            c = -c;
+        }
+        normalize(remainder);
+        current = next;
+        next = remainder;
+    }
+}
+
+/* Accessors/Mutators ********************************************************/
+
+std::vector<Polynomial> SturmSequence::GetChain() const
+{
+    std::vector<Polynomial> chain;
+    for(const std::vector<highprecision>& coefficients : this->Chain)
+    {
+        chain.push_back(Polynomial(CoefficientList(coefficients.begin(), coefficients.end())));
+    }
+    return chain;
+}
+
+int SturmSequence::Count() const
+{
+    return this->Chain.size();
+}
+
+/* Public Methods ************************************************************/
+
+int SturmSequence::CountSignChangesAt(highprecision x) const
+{
+    int changes = 0;
+    int previousSign = 0;
+    for(const std::vector<highprecision>& coefficients : this->Chain)
+    {
+        highprecision value = 0;
+        for(highprecision c : coefficients)
+        {
+            value = value * x + c;
+        }
+        int sign = (value > 0) - (value < 0);
+        if(sign == 0)
+        {
+            continue;
+        }
+        if(previousSign != 0 && sign != previousSign)
+        {
+            changes++;
+        }
+        previousSign = sign;
+    }
+    return changes;
+}
+
+int SturmSequence::CountZeros(highprecision lowerLimit, highprecision upperLimit) const
+{
+    if(lowerLimit > upperLimit)
+    {
+        throw std::runtime_error("The lower limit must not be greater than the upper limit.");
+    }
+    return this->CountSignChangesAt(lowerLimit) - this->CountSignChangesAt(upperLimit);
+}
+
+int SturmSequence::CountZeros(const Interval& interval) const
+{
+    return this->CountZeros(interval.Lower, interval.Upper);
+}
+
+int SturmSequence::CountZeros() const
+{
+    return this->CountSignChangesAtInfinity(false) - this->CountSignChangesAtInfinity(true);
+}
+
+std::vector<int> SturmSequence::CountZeros(const std::vector<Interval>& intervals) const
+{
+    std::vector<int> counts;
+    counts.reserve(intervals.size());
+    for(const Interval& interval : intervals)
+    {
+        counts.push_back(this->CountZeros(interval));
+    }
+    return counts;
+}
+
+/* Private Methods ***********************************************************/
+
+int SturmSequence::CountSignChangesAtInfinity(bool positive) const
+{
+    // At +-inf the sign of each member is the one of its leading term
+    int changes = 0;
+    int previousSign = 0;
+    for(const std::vector<highprecision>& coefficients : this->Chain)
+    {
+        int order = coefficients.size() - 1;
+        int sign = (coefficients[0] > 0) - (coefficients[0] < 0);
+        if(!positive && (order % 2 != 0))
+        {
+            sign = -sign;
+        }
+        if(previousSign != 0 && sign != previousSign)
+        {
+            changes++;
+        }
+        previousSign = sign;
+    }
+    return changes;
+}
+
+} // namespace Vath
@@ -0,0 +1,310 @@
+#include "../headers/subproducttree.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include "../headers/powerseries.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+SubproductTree::SubproductTree(const std::vector<highprecision>& points)
+{
+    if(points.empty())
+    {
+        throw std::runtime_error("A subproduct tree needs at least one point.");
+    }
+
+    // The points are sorted and then dealt out alternately to the children (like the even/odd split of an FFT).
+    // Thus every node's points spread over the whole range instead of clustering at one end of it, which keeps the
+    // coefficients of the products and remainders small.
+    std::vector<size_t> sorted(points.size());
+    for(size_t i = 0; i < sorted.size(); i++)
+    {
+        sorted[i] = i;
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [&points](size_t left, size_t right){ return points[left] < points[right]; });
+    this->Order = SubproductTree::Interleave(sorted);
+    for(size_t index : this->Order)
+    {
+        this->Points.push_back(points[index]);
+    }
+
+    this->Build(0, points.size(), -1);
+
+    // Barycentric weights 1 / M'(x_j) in tree order, evaluated with the tree itself
+    std::vector<highprecision> rootProduct = this->Nodes[0].Product;
+    CoefficientList derivative;
+    for(size_t i = rootProduct.size() - 1; i > 0; i--)
+    {
+        derivative.push_back(i * rootProduct[i]);
+    }
+    std::vector<highprecision> derivativeValues = this->EvaluateAt(Polynomial(derivative));
+    for(size_t j = 0; j < this->Points.size(); j++)
+    {
+        highprecision value = derivativeValues[this->Order[j]];
+        if(value == 0 || !std::isfinite(value))
+        {
+            this->Weights.clear();
+            return;
+        }
+        this->Weights.push_back(1 / value);
+    }
+}
+
+/* Accessors/Mutators ********************************************************/
+
+std::vector<highprecision> SubproductTree::GetPoints() const
+{
+    std::vector<highprecision> points(this->Points.size());
+    for(size_t j = 0; j < this->Points.size(); j++)
+    {
+        points[this->Order[j]] = this->Points[j];
+    }
+    return points;
+}
+
+size_t SubproductTree::Count() const
+{
+    return this->Points.size();
+}
+
+Polynomial SubproductTree::GetRootPolynomial() const
+{
+    const std::vector<highprecision>& product = this->Nodes[0].Product;
+    return Polynomial(CoefficientList(product.rbegin(), product.rend()));
+}
+
+/* Public Methods ************************************************************/
+
+std::vector<highprecision> SubproductTree::EvaluateAt(const Polynomial& function) const
+{
+    CoefficientList coefficients = function.GetCoefficients();
+    std::vector<highprecision> ascending(coefficients.rbegin(), coefficients.rend());
+    std::vector<highprecision> remainder = SubproductTree::Remainder(ascending, this->Nodes[0].Product, std::vector<highprecision>());
+
+    std::vector<highprecision> treeValues(this->Points.size());
+    this->EvaluateAt(0, remainder, treeValues);
+    std::vector<highprecision> values(this->Points.size());
+    for(size_t j = 0; j < this->Points.size(); j++)
+    {
+        values[this->Order[j]] = treeValues[j];
+    }
+    return values;
+}
+
+Polynomial SubproductTree::Interpolate(const std::vector<highprecision>& values) const
+{
+    if(values.size() != this->Points.size())
+    {
+        throw std::runtime_error("The number of values has to match the number of points.");
+    }
+    if(this->Weights.empty())
+    {
+        throw std::runtime_error("The points have to be distinct for interpolation.");
+    }
+
+    // Lagrange: p = sum_i y_i / M'(x_i) * M(x) / (x - x_i), summed up the tree
+    std::vector<highprecision> weightedValues(values.size());
+    for(size_t j = 0; j < values.size(); j++)
+    {
+        weightedValues[j] = values[this->Order[j]] * this->Weights[j];
+    }
+    std::vector<highprecision> result = this->Combine(0, weightedValues);
+    return Polynomial(CoefficientList(result.rbegin(), result.rend()));
+}
+
+Polynomial SubproductTree::FromRoots(const std::vector<highprecision>& roots)
+{
+    return SubproductTree(roots).GetRootPolynomial();
+}
+
+/* Private Methods ***********************************************************/
+
+int SubproductTree::Build(size_t begin, size_t end, int parentOrder)
+{
+    int index = this->Nodes.size();
+    this->Nodes.push_back(Node{ .Begin = begin, .End = end, .Left = -1, .Right = -1, .Product = {}, .ReversedInverse = {} });
+
+    std::vector<highprecision> product;
+    if(end - begin <= SubproductTree::LEAF_SIZE)
+    {
+        product.push_back(1);
+        for(size_t i = begin; i < end; i++)
+        {
+            // product *= (x - x_i)
+            product.push_back(0);
+            for(size_t j = product.size() - 1; j > 0; j--)
+            {
+                product[j] = product[j - 1] - this->Points[i] * product[j];
+            }
+            product[0] *= -this->Points[i];
+        }
+    }
+    else
+    {
+        size_t middle = begin + (end - begin + 1) / 2;
+        int order = end - begin;
+        int left = this->Build(begin, middle, order);
+        int right = this->Build(middle, end, order);
+        this->Nodes[index].Left = left;
+        this->Nodes[index].Right = right;
+        product = SubproductTree::Multiply(this->Nodes[left].Product, this->Nodes[right].Product);
+    }
+
+    // Remainders passed down from the parent have degree < parentOrder, so their quotients by this node's
+    // product have at most parentOrder - order coefficients
+    if(parentOrder >= 0)
+    {
+        size_t quotientLength = parentOrder - (end - begin);
+        std::vector<highprecision> reversed(product.rbegin(), product.rend());
+        this->Nodes[index].ReversedInverse = SubproductTree::InvertSeries(reversed, quotientLength);
+    }
+    this->Nodes[index].Product = product;
+    return index;
+}
+
+void SubproductTree::EvaluateAt(int index, const std::vector<highprecision>& remainder, std::vector<highprecision>& values) const
+{
+    const Node& node = this->Nodes[index];
+    if(node.Left < 0)
+    {
+        for(size_t i = node.Begin; i < node.End; i++)
+        {
+            highprecision value = 0;
+            for(size_t j = remainder.size(); j-- > 0;)
+            {
+                value = value * this->Points[i] + remainder[j];
+            }
+            values[i] = value;
+        }
+        return;
+    }
+
+    for(int child : { node.Left, node.Right })
+    {
+        std::vector<highprecision> childRemainder = SubproductTree::Remainder(remainder, this->Nodes[child].Product, this->Nodes[child].ReversedInverse);
+        this->EvaluateAt(child, childRemainder, values);
+    }
+}
+
+std::vector<highprecision> SubproductTree::Combine(int index, const std::vector<highprecision>& weightedValues) const
+{
+    const Node& node = this->Nodes[index];
+    size_t order = node.End - node.Begin;
+    if(node.Left < 0)
+    {
+        // sum_i c_i * Product / (x - x_i), each quotient by synthetic division
+        std::vector<highprecision> result(order, 0);
+        std::vector<highprecision> quotient(order, 0);
+        for(size_t i = node.Begin; i < node.End; i++)
+        {
+            quotient[order - 1] = node.Product[order];
+            for(size_t j = order - 1; j > 0; j--)
+            {
+                quotient[j - 1] = node.Product[j] + this->Points[i] * quotient[j];
+            }
+            for(size_t j = 0; j < order; j++)
+            {
+                result[j] += weightedValues[i] * quotient[j];
+            }
+        }
+        return result;
+    }
+
+    std::vector<highprecision> left = SubproductTree::Multiply(this->Combine(node.Left, weightedValues), this->Nodes[node.Right].Product);
+    std::vector<highprecision> right = SubproductTree::Multiply(this->Combine(node.Right, weightedValues), this->Nodes[node.Left].Product);
+    std::vector<highprecision> result(order, 0);
+    for(size_t j = 0; j < order; j++)
+    {
+        result[j] = ((j < left.size()) ? left[j] : 0) + ((j < right.size()) ? right[j] : 0);
+    }
+    return result;
+}
+
+std::vector<size_t> SubproductTree::Interleave(const std::vector<size_t>& indices)
+{
+    if(indices.size() <= SubproductTree::LEAF_SIZE)
+    {
+        return indices;
+    }
+
+    // Even positions go to the left child, odd ones to the right child (see Build())
+    std::vector<size_t> even, odd;
+    for(size_t i = 0; i < indices.size(); i++)
+    {
+        ((i % 2 == 0) ? even : odd).push_back(indices[i]);
+    }
+    std::vector<size_t> arranged = SubproductTree::Interleave(even);
+    std::vector<size_t> arrangedOdd = SubproductTree::Interleave(odd);
+    arranged.insert(arranged.end(), arrangedOdd.begin(), arrangedOdd.end());
+    return arranged;
+}
+
+std::vector<highprecision> SubproductTree::Multiply(const std::vector<highprecision>& left, const std::vector<highprecision>& right)
+{
+    return FastFourierTransform<highprecision>::Convolve(left, right);
+}
+
+std::vector<highprecision> SubproductTree::InvertSeries(const std::vector<highprecision>& series, size_t length)
+{
+    if(length == 0)
+    {
+        return std::vector<highprecision>();
+    }
+    return PowerSeries(series, length).Inverse().GetCoefficients();
+}
+
+std::vector<highprecision> SubproductTree::Remainder(const std::vector<highprecision>& numerator, const std::vector<highprecision>& denominator, const std::vector<highprecision>& reversedInverse)
+{
+    size_t n = denominator.size() - 1;
+    if(numerator.size() <= n)
+    {
+        return numerator;
+    }
+    size_t quotientLength = numerator.size() - n;
+
+    std::vector<highprecision> quotient;
+    if(std::min(quotientLength, n) <= SubproductTree::LEAF_SIZE)
+    {
+        // Long division, the divisor is monic
+        std::vector<highprecision> rest(numerator);
+        quotient.assign(quotientLength, 0);
+        for(size_t k = quotientLength; k-- > 0;)
+        {
+            quotient[k] = rest[k + n];
+            for(size_t j = 0; j <= n; j++)
+            {
+                rest[k + j] -= quotient[k] * denominator[j];
+            }
+        }
+        rest.resize(n);
+        return rest;
+    }
+
+    // rev(q) = rev(a) / rev(b) mod x^(m-n+1)
+    std::vector<highprecision> inverse = reversedInverse;
+    if(inverse.size() < quotientLength)
+    {
+        std::vector<highprecision> reversed(denominator.rbegin(), denominator.rend());
+        inverse = SubproductTree::InvertSeries(reversed, quotientLength);
+    }
+    inverse.resize(quotientLength);
+    std::vector<highprecision> reversedNumerator(numerator.rbegin(), numerator.rbegin() + quotientLength);
+    quotient = SubproductTree::Multiply(reversedNumerator, inverse);
+    quotient.resize(quotientLength);
+    std::reverse(quotient.begin(), quotient.end());
+
+    // r = a - q b, only the n lowest coefficients are non-zero
+    std::vector<highprecision> product = SubproductTree::Multiply(quotient, denominator);
+    std::vector<highprecision> rest(n);
+    for(size_t j = 0; j < n; j++)
+    {
+        rest[j] = numerator[j] - product[j];
+    }
+    return rest;
+}
+
+} // namespace Vath
@@ -0,0 +1,150 @@
+#include "../headers/taskpool.hpp"
+#include <algorithm>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+TaskPool::TaskPool() :
+    TaskPool(std::max(std::thread::hardware_concurrency(), 1u))
+{
+}
+
+TaskPool::TaskPool(unsigned int numberOfThreads) :
+    UnfinishedTasks(0),
+    ShuttingDown(false),
+    FirstException(nullptr)
+{
+    for(unsigned int i = 0; i < numberOfThreads; i++)
+    {
+        this->Workers.emplace_back([this](){ this->Work(); });
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(this->Mutex);
+        this->AllTasksDone.wait(lock, [this](){ return this->UnfinishedTasks == 0; });
+        this->ShuttingDown = true;
+    }
+    this->TaskAvailable.notify_all();
+    for(std::thread& worker : this->Workers)
+    {
+        worker.join();
+    }
+}
+
+/* Accessors/Mutators ********************************************************/
+
+unsigned int TaskPool::GetNumberOfThreads() const
+{
+    return this->Workers.size();
+}
+
+/* Public Methods ************************************************************/
+
+void TaskPool::Submit(std::function<void()> task)
+{
+    if(this->Workers.empty())
+    {
+        // No workers, so just execute it right away
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(this->Mutex);
+            if(!this->FirstException)
+            {
+                this->FirstException = std::current_exception();
+            }
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->Tasks.push_back(std::move(task));
+        this->UnfinishedTasks++;
+    }
+    this->TaskAvailable.notify_one();
+}
+
+void TaskPool::WaitForAll()
+{
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->AllTasksDone.wait(lock, [this](){ return this->UnfinishedTasks == 0; });
+    if(this->FirstException)
+    {
+        std::exception_ptr exception = this->FirstException;
+        this->FirstException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void TaskPool::ParallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    size_t numberOfChunks = std::max((size_t)1, std::min(count, (size_t)this->Workers.size()));
+    size_t chunkSize = (count + numberOfChunks - 1) / std::max(numberOfChunks, (size_t)1);
+    for(size_t begin = 0; begin < count; begin += chunkSize)
+    {
+        size_t end = std::min(begin + chunkSize, count);
+        this->Submit([&body, begin, end]()
+        {
+            for(size_t i = begin; i < end; i++)
+            {
+                body(i);
+            }
+        });
+    }
+    this->WaitForAll();
+}
+
+/* Private Methods ***********************************************************/
+
+void TaskPool::Work()
+{
+    while(true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(this->Mutex);
+            this->TaskAvailable.wait(lock, [this](){ return this->ShuttingDown || !this->Tasks.empty(); });
+            if(this->ShuttingDown && this->Tasks.empty())
+            {
+                return;
+            }
+            task = std::move(this->Tasks.front());
+            this->Tasks.pop_front();
+        }
+
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(this->Mutex);
+            if(!this->FirstException)
+            {
+                this->FirstException = std::current_exception();
+            }
+        }
+
+        bool allDone = false;
+        {
+            std::lock_guard<std::mutex> lock(this->Mutex);
+            this->UnfinishedTasks--;
+            allDone = (this->UnfinishedTasks == 0);
+        }
+        if(allDone)
+        {
+            this->AllTasksDone.notify_all();
+        }
+    }
+}
+
+} // namespace Vath
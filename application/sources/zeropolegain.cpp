@@ -0,0 +1,216 @@
+#include "../headers/zeropolegain.hpp"
+#include "../headers/fastfouriertransform.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace Vath
+{
+
+/* Constructors **************************************************************/
+
+ZeroPoleGain::ZeroPoleGain() :
+    Gain(1)
+{
+}
+
+ZeroPoleGain::ZeroPoleGain(const std::vector<std::complex<highprecision>>& zeros, const std::vector<std::complex<highprecision>>& poles, highprecision gain) :
+    Zeros(zeros),
+    Poles(poles),
+    Gain(gain)
+{
+}
+
+ZeroPoleGain::ZeroPoleGain(const PoleZeroSet& prototype) :
+    Zeros(prototype.zeros),
+    Poles(prototype.poles),
+    Gain(prototype.gain)
+{
+}
+
+/* Accessors/Mutators ********************************************************/
+
+std::vector<std::complex<highprecision>> ZeroPoleGain::GetZeros() const
+{
+    return this->Zeros;
+}
+
+std::vector<std::complex<highprecision>> ZeroPoleGain::GetPoles() const
+{
+    return this->Poles;
+}
+
+highprecision ZeroPoleGain::GetGain() const
+{
+    return this->Gain;
+}
+
+void ZeroPoleGain::SetGain(highprecision gain)
+{
+    this->Gain = gain;
+    this->TransferFunction.reset();
+}
+
+bool ZeroPoleGain::IsExpanded() const
+{
+    return this->TransferFunction.has_value();
+}
+
+/* Operators *****************************************************************/
+
+ZeroPoleGain& ZeroPoleGain::operator *=(const ZeroPoleGain& other)
+{
+    this->Zeros.insert(this->Zeros.end(), other.Zeros.begin(), other.Zeros.end());
+    this->Poles.insert(this->Poles.end(), other.Poles.begin(), other.Poles.end());
+    this->Gain *= other.Gain;
+    this->TransferFunction.reset();
+    return *this;
+}
+
+ZeroPoleGain operator *(const ZeroPoleGain& left, const ZeroPoleGain& right)
+{
+    ZeroPoleGain cascade(left);
+    cascade *= right;
+    return cascade;
+}
+
+/* Public Methods ************************************************************/
+
+ZeroPoleGain ZeroPoleGain::FromTransferFunction(const PolynomialFraction& transferFunction)
+{
+    CoefficientList numerator = Polynomial::TrimCoefficients(transferFunction.numerator.GetCoefficients(), 0);
+    CoefficientList denominator = Polynomial::TrimCoefficients(transferFunction.denominator.GetCoefficients(), 0);
+    if((numerator.size() == 1 && numerator[0] == 0) || (denominator.size() == 1 && denominator[0] == 0))
+    {
+        throw std::runtime_error("The numerator and the denominator of a zero-pole-gain representation must not be 0.");
+    }
+
+    return ZeroPoleGain(ZeroPoleGain::FindRoots(numerator), ZeroPoleGain::FindRoots(denominator), numerator[0] / denominator[0]);
+}
+
+PolynomialFraction ZeroPoleGain::ToTransferFunction() const
+{
+    if(!this->TransferFunction.has_value())
+    {
+        this->TransferFunction = PolynomialFraction{
+            .numerator = Polynomial(ZeroPoleGain::ExpandRoots(this->Zeros, this->Gain)),
+            .denominator = Polynomial(ZeroPoleGain::ExpandRoots(this->Poles, 1))
+        };
+    }
+    return this->TransferFunction.value();
+}
+
+std::complex<highprecision> ZeroPoleGain::EvaluateAt(std::complex<highprecision> x) const
+{
+    Complex value = this->Gain;
+    for(const Complex& zero : this->Zeros)
+    {
+        value *= x - zero;
+    }
+    for(const Complex& pole : this->Poles)
+    {
+        value /= x - pole;
+    }
+    return value;
+}
+
+/* Private Methods ***********************************************************/
+
+std::vector<ZeroPoleGain::Complex> ZeroPoleGain::FindRoots(const CoefficientList& coefficients)
+{
+    // Multiple roots (like the zeros at z = -1 of a bilinear transformed lowpass) are split off first, found
+    // directly they would only be accurate to a fraction of the significant digits
+    std::vector<Complex> roots;
+    if(coefficients.size() < 2)
+    {
+        return roots;
+    }
+    Polynomial function(coefficients);
+    std::vector<SquareFreeFactor> factors = Polynomial::SquareFreeFactorization(function);
+    if(!Polynomial::VerifySquareFreeFactorization(function, factors))
+    {
+        // Close roots were merged or the polynomial is badly scaled, find the roots directly
+        return Polynomial::FindComplexZeros(function);
+    }
+    for(const SquareFreeFactor& f : factors)
+    {
+        for(const Complex& root : Polynomial::FindComplexZeros(f.factor))
+        {
+            roots.insert(roots.end(), f.multiplicity, root);
+        }
+    }
+    return roots;
+}
+
+CoefficientList ZeroPoleGain::ExpandRoots(const std::vector<Complex>& roots, highprecision gain)
+{
+    std::vector<std::vector<highprecision>> factors = ZeroPoleGain::GetRealFactors(roots);
+    std::vector<highprecision> product = factors.empty() ? std::vector<highprecision>{1} : ZeroPoleGain::MultiplyFactors(factors, 0, factors.size());
+
+    CoefficientList coefficients;
+    for(size_t j = product.size(); j-- > 0;)
+    {
+        coefficients.push_back(gain * product[j]);
+    }
+    return coefficients;
+}
+
+std::vector<std::vector<highprecision>> ZeroPoleGain::GetRealFactors(const std::vector<Complex>& roots)
+{
+    // (x - r) for real roots, (x - z)(x - conj(z)) = x^2 - 2 Re(z) x + |z|^2 for conjugate pairs, lowest order first
+    std::vector<std::vector<highprecision>> factors;
+    std::vector<bool> paired(roots.size(), false);
+    for(size_t i = 0; i < roots.size(); i++)
+    {
+        if(roots[i].imag() == 0)
+        {
+            factors.push_back(std::vector<highprecision>{-roots[i].real(), 1});
+            paired[i] = true;
+        }
+    }
+    for(size_t i = 0; i < roots.size(); i++)
+    {
+        if(paired[i] || roots[i].imag() < 0)
+        {
+            continue;
+        }
+        size_t partner = roots.size();
+        for(size_t j = 0; j < roots.size(); j++)
+        {
+            if(!paired[j] && roots[j].imag() < 0 &&
+                (partner == roots.size() || std::abs(roots[j] - std::conj(roots[i])) < std::abs(roots[partner] - std::conj(roots[i]))))
+            {
+                partner = j;
+            }
+        }
+        highprecision scale = std::max<highprecision>(1, std::abs(roots[i]));
+        if(partner == roots.size() || std::abs(roots[partner] - std::conj(roots[i])) > ZeroPoleGain::CONJUGATE_TOLERANCE * scale)
+        {
+            throw std::runtime_error("The non-real zeros and poles of a real rational function have to come in conjugate pairs.");
+        }
+        Complex z = (roots[i] + std::conj(roots[partner])) / 2.0L;
+        factors.push_back(std::vector<highprecision>{std::norm(z), -2 * z.real(), 1});
+        paired[i] = true;
+        paired[partner] = true;
+    }
+    if(std::find(paired.begin(), paired.end(), false) != paired.end())
+    {
+        throw std::runtime_error("The non-real zeros and poles of a real rational function have to come in conjugate pairs.");
+    }
+    return factors;
+}
+
+std::vector<highprecision> ZeroPoleGain::MultiplyFactors(const std::vector<std::vector<highprecision>>& factors, size_t begin, size_t end)
+{
+    if(end - begin == 1)
+    {
+        return factors[begin];
+    }
+    size_t middle = begin + (end - begin) / 2;
+    return FastFourierTransform<highprecision>::Convolve(
+        ZeroPoleGain::MultiplyFactors(factors, begin, middle),
+        ZeroPoleGain::MultiplyFactors(factors, middle, end)
+    );
+}
+
+} // namespace Vath
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/stabilityanalysis.hpp"
+
+using namespace Vath;
+
+typedef std::complex<highprecision> Complex;
+
+static highprecision GetMagnitudeSquared(const PolynomialFraction& h, highprecision omega)
+{
+    Complex s(0, omega), numerator = 0, denominator = 0;
+    for(highprecision c : h.numerator.GetCoefficients())
+    {
+        numerator = numerator * s + c;
+    }
+    for(highprecision c : h.denominator.GetCoefficients())
+    {
+        denominator = denominator * s + c;
+    }
+    return std::norm(numerator / denominator);
+}
+
+TEST(AnalogPrototypeTests, Method_Butterworth_OrdersAreProvided_MagnitudesAreCorrect)
+{
+    for(int order = 1; order <= 12; order++)
+    {
+        PolynomialFraction h = AnalogPrototype::ToTransferFunction(AnalogPrototype::Butterworth(order));
+        EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(h));
+        for(highprecision omega : { 0.0L, 0.3L, 1.0L, 2.0L })
+        {
+            EXPECT_NEAR(GetMagnitudeSquared(h, omega), 1 / (1 + std::pow(omega, 2.0L * order)), 1E-15);
+        }
+    }
+}
+
+TEST(AnalogPrototypeTests, Method_Chebyshev_OrdersAreProvided_MagnitudesAreCorrect)
+{
+    highprecision ripple = 1;
+    highprecision epsilonSquared = std::pow(10.0L, ripple / 10) - 1;
+    for(int order = 1; order <= 10; order++)
+    {
+        // |H|^2 = 1 / (1 + e^2 T_n(w)^2)
+        PolynomialFraction h = AnalogPrototype::ToTransferFunction(AnalogPrototype::ChebyshevI(order, ripple));
+        EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(h));
+        for(highprecision omega : { 0.0L, 0.4L, 0.9L, 1.0L, 1.5L })
+        {
+            highprecision t = (omega <= 1) ? std::cos(order * std::acos(omega)) : std::cosh(order * std::acosh(omega));
+            EXPECT_NEAR(GetMagnitudeSquared(h, omega), 1 / (1 + epsilonSquared * t * t), 1E-15);
+        }
+
+        // Exactly the attenuation at the stopband edge, at least the attenuation beyond it
+        h = AnalogPrototype::ToTransferFunction(AnalogPrototype::ChebyshevII(order, 40));
+        EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(h));
+        EXPECT_NEAR(GetMagnitudeSquared(h, 0), 1, 1E-15);
+        EXPECT_NEAR(GetMagnitudeSquared(h, 1), 1E-4, 1E-17);
+        for(highprecision omega : { 1.2L, 2.0L, 10.0L })
+        {
+            EXPECT_LE(GetMagnitudeSquared(h, omega), 1E-4 * (1 + 1E-12));
+        }
+    }
+}
+
+TEST(AnalogPrototypeTests, Method_Elliptic_OrdersAreProvided_RipplesAreCorrect)
+{
+    highprecision ripple = 0.5;
+    highprecision attenuation = 60;
+    highprecision passbandEdge = 1 / (1 + (std::pow(10.0L, ripple / 10) - 1));
+    for(int order = 2; order <= 9; order++)
+    {
+        PoleZeroSet prototype = AnalogPrototype::Elliptic(order, ripple, attenuation);
+        ASSERT_EQ(prototype.poles.size(), order);
+        ASSERT_EQ(prototype.zeros.size(), 2 * (order / 2));
+        PolynomialFraction h = AnalogPrototype::ToTransferFunction(prototype);
+        EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(h));
+
+        // Within the ripple in the passband, exactly at its bottom at 1
+        EXPECT_NEAR(GetMagnitudeSquared(h, 1), passbandEdge, 1E-12);
+        for(int i = 0; i <= 100; i++)
+        {
+            highprecision value = GetMagnitudeSquared(h, i / 100.0L);
+            EXPECT_LE(value, 1 + 1E-12);
+            EXPECT_GE(value, passbandEdge - 1E-12);
+        }
+
+        // The stopband starts at the smallest zero and is at least attenuated by 60 dB from there on
+        highprecision stopbandEdge = std::numeric_limits<highprecision>::max();
+        for(const Complex& zero : prototype.zeros)
+        {
+            stopbandEdge = std::min(stopbandEdge, std::abs(zero.imag()));
+        }
+        highprecision searchStart = 1.0L + 1E-6;
+        highprecision lowestStopband = searchStart;
+        while(GetMagnitudeSquared(h, lowestStopband) > 1E-6 * (1 + 1E-9))
+        {
+            lowestStopband *= 1.0001L;
+        }
+        EXPECT_LT(lowestStopband, stopbandEdge);
+        for(int i = 0; i <= 200; i++)
+        {
+            EXPECT_LE(GetMagnitudeSquared(h, lowestStopband * (1 + i / 10.0L)), 1E-6 * (1 + 1E-6));
+        }
+    }
+}
+
+TEST(AnalogPrototypeTests, Method_Design_PrototypesAreRequestedRepeatedly_CacheServesThem)
+{
+    AnalogPrototype::ClearCache();
+    PolynomialFraction bessel = AnalogPrototype::DesignTransferFunction(PrototypeType::Bessel, 3);
+    CoefficientList coefficients = bessel.denominator.GetCoefficients();
+    CoefficientList correctCoefficients{ 1, 6, 15, 15 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_EQ(coefficients[i], correctCoefficients[i]);
+    }
+    EXPECT_EQ(bessel.numerator.GetCoefficients()[0], 15);
+    EXPECT_EQ(AnalogPrototype::GetCacheSize(), 1);
+
+    // Unused parameters do not matter, equal requests return equal prototypes
+    for(int i = 0; i < 1000; i++)
+    {
+        AnalogPrototype::Design(PrototypeType::Bessel, 3, i);
+        AnalogPrototype::Design(PrototypeType::Elliptic, 5, 1, 50);
+    }
+    EXPECT_EQ(AnalogPrototype::GetCacheSize(), 2);
+    PoleZeroSet first = AnalogPrototype::Design(PrototypeType::Elliptic, 5, 1, 50);
+    PoleZeroSet second = AnalogPrototype::Elliptic(5, 1, 50);
+    ASSERT_EQ(first.poles.size(), second.poles.size());
+    for(size_t i = 0; i < first.poles.size(); i++)
+    {
+        EXPECT_EQ(first.poles[i], second.poles[i]);
+    }
+    EXPECT_EQ(first.gain, second.gain);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        AnalogPrototype::Design(PrototypeType::ChebyshevI, 4, 0);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+    EXPECT_EQ(AnalogPrototype::GetCacheSize(), 2);
+    AnalogPrototype::ClearCache();
+    EXPECT_EQ(AnalogPrototype::GetCacheSize(), 0);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/chebyshevpolynomial.hpp"
+
+using namespace Vath;
+
+TEST(ChebyshevPolynomialTests, Method_FromPolynomial_PolynomialIsConverted_ValuesAndRoundTripAreCorrect)
+{
+    // 4x^3 - 3x is T_3 on [-1, 1]
+    ChebyshevPolynomial t3 = ChebyshevPolynomial::FromPolynomial(Polynomial(CoefficientList{4, 0, -3, 0}));
+    std::vector<highprecision> coefficients = t3.GetCoefficients();
+    std::vector<highprecision> correctCoefficients{ 0, 0, 0, 1 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-15);
+    }
+
+    // Round trip on another domain
+    Polynomial p(CoefficientList{0.5, -2, 1, 3, -7});
+    ChebyshevPolynomial c = ChebyshevPolynomial::FromPolynomial(p, Interval(1, 4));
+    for(highprecision x : { 1.0L, 1.3L, 2.5L, 3.9L, 4.0L })
+    {
+        EXPECT_NEAR(c.EvaluateAt(x), p.EvaluateAt(x), 1E-12);
+    }
+    CoefficientList roundTrip = c.ToPolynomial().GetCoefficients();
+    CoefficientList original = p.GetCoefficients();
+    ASSERT_EQ(roundTrip.size(), original.size());
+    for(size_t i = 0; i < roundTrip.size(); i++)
+    {
+        EXPECT_NEAR(roundTrip[i], original[i], 1E-12);
+    }
+
+    // Values at the chebyshev points
+    std::vector<highprecision> points = ChebyshevPolynomial::GetChebyshevPoints(c.GetOrder(), Interval(1, 4));
+    std::vector<highprecision> values = c.GetValues();
+    ASSERT_EQ(values.size(), points.size());
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        EXPECT_NEAR(values[j], p.EvaluateAt(points[j]), 1E-12);
+    }
+}
+
+TEST(ChebyshevPolynomialTests, Method_Interpolate_SmoothFunctionIsProvided_ApproximationIsAccurate)
+{
+    ChebyshevPolynomial approximation = ChebyshevPolynomial::Interpolate([](highprecision x){ return std::exp(x); }, 24, Interval(-2, 3));
+    std::vector<highprecision> x;
+    for(int i = 0; i <= 50; i++)
+    {
+        x.push_back(-2 + i * 0.1);
+    }
+    std::vector<highprecision> batch = approximation.EvaluateAt(x);
+    ASSERT_EQ(batch.size(), x.size());
+    for(size_t i = 0; i < x.size(); i++)
+    {
+        EXPECT_NEAR(approximation.EvaluateAt(x[i]), std::exp(x[i]), 1E-14 * std::exp(x[i]));
+        EXPECT_EQ(batch[i], approximation.EvaluateAt(x[i]));
+    }
+}
+
+TEST(ChebyshevPolynomialTests, Method_DifferentiateAndIntegrate_SmoothFunctionIsProvided_ResultsAreCorrect)
+{
+    ChebyshevPolynomial sine = ChebyshevPolynomial::Interpolate([](highprecision x){ return std::sin(x); }, 30, Interval(0, 4));
+    ChebyshevPolynomial cosine = ChebyshevPolynomial::Differentiate(sine);
+    EXPECT_EQ(cosine.GetOrder(), 29);
+    for(highprecision x : { 0.0L, 0.7L, 2.0L, 3.3L, 4.0L })
+    {
+        EXPECT_NEAR(cosine.EvaluateAt(x), std::cos(x), 1E-12);
+    }
+
+    ChebyshevPolynomial integral = ChebyshevPolynomial::Integrate(sine);
+    EXPECT_NEAR(integral.EvaluateAt(0), 0, 1E-15);
+    EXPECT_NEAR(integral.EvaluateAt(3), 1 - std::cos(3.0L), 1E-14);
+    EXPECT_NEAR(sine.GetArea(1, 2), std::cos(1.0L) - std::cos(2.0L), 1E-14);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        ChebyshevPolynomial invalid(std::vector<highprecision>{ 1 }, Interval(2, 2));
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
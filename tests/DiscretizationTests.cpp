@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/discretization.hpp"
+#include "../application/headers/stabilityanalysis.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+typedef std::complex<highprecision> Complex;
+
+static Complex EvaluateFraction(const PolynomialFraction& h, Complex x)
+{
+    Complex numerator = 0, denominator = 0;
+    for(highprecision c : h.numerator.GetCoefficients())
+    {
+        numerator = numerator * x + c;
+    }
+    for(highprecision c : h.denominator.GetCoefficients())
+    {
+        denominator = denominator * x + c;
+    }
+    return numerator / denominator;
+}
+
+TEST(DiscretizationTests, Method_Bilinear_TransferFunctionsAreProvided_FrequencyResponsesAreMapped)
+{
+    // 1 / (s + 1) at fs = 10: (z + 1) / (21 z - 19)
+    PolynomialFraction lowpass
+    {
+        .numerator = Polynomial(CoefficientList{1}),
+        .denominator = Polynomial(CoefficientList{1, 1})
+    };
+    PolynomialFraction h = Discretization::Bilinear(lowpass, 10);
+    CoefficientList b = h.numerator.GetCoefficients();
+    CoefficientList a = h.denominator.GetCoefficients();
+    ASSERT_EQ(b.size(), 2);
+    ASSERT_EQ(a.size(), 2);
+    EXPECT_NEAR(b[0], 1.0L / 21, 1E-18);
+    EXPECT_NEAR(b[1], 1.0L / 21, 1E-18);
+    EXPECT_NEAR(a[0], 1, 1E-18);
+    EXPECT_NEAR(a[1], -19.0L / 21, 1E-18);
+
+    // 3rd order butterworth with cutoff 100 rad/s: H(e^(j W)) = H(j K tan(W / 2))
+    PolynomialFraction butterworth
+    {
+        .numerator = Polynomial(CoefficientList{1E6}),
+        .denominator = Polynomial(CoefficientList{1, 200, 2E4, 1E6})
+    };
+    highprecision sampleRate = 1000;
+    h = Discretization::Bilinear(butterworth, sampleRate);
+    EXPECT_TRUE(StabilityAnalysis::IsSchurStable(h));
+    for(highprecision omega : { 0.0L, 0.1L, 0.5L, 1.0L, 2.5L })
+    {
+        Complex digital = EvaluateFraction(h, std::polar(1.0L, omega));
+        Complex analog = EvaluateFraction(butterworth, Complex(0, 2 * sampleRate * std::tan(omega / 2)));
+        EXPECT_NEAR(std::abs(digital - analog), 0, 1E-15);
+    }
+
+    // Prewarped at the cutoff: the magnitude there is exactly 1 / sqrt(2)
+    h = Discretization::Bilinear(butterworth, sampleRate, 100);
+    EXPECT_NEAR(std::abs(EvaluateFraction(h, std::polar(1.0L, 100 / sampleRate))), 1 / std::sqrt(2.0L), 1E-15);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        Discretization::Bilinear(butterworth, sampleRate, 4000);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(DiscretizationTests, Method_MatchedZ_TransferFunctionIsProvided_PolesZerosAndGainAreMapped)
+{
+    // (s + 2) / ((s + 1)(s + 3)), fs = 100
+    PolynomialFraction analog
+    {
+        .numerator = Polynomial(CoefficientList{1, 2}),
+        .denominator = Polynomial(CoefficientList{1, 4, 3})
+    };
+    highprecision period = 0.01;
+    PolynomialFraction h = Discretization::MatchedZ(analog, 100);
+
+    // Poles e^(-T), e^(-3T), zeros e^(-2T) and -1 (from the zero at infinity)
+    CoefficientList a = h.denominator.GetCoefficients();
+    ASSERT_EQ(a.size(), 3);
+    EXPECT_NEAR(a[1], -(std::exp(-period) + std::exp(-3 * period)), 1E-17);
+    EXPECT_NEAR(a[2], std::exp(-4 * period), 1E-17);
+    std::vector<Complex> zeros = Polynomial::FindComplexZeros(h.numerator);
+    ASSERT_EQ(zeros.size(), 2);
+    EXPECT_NEAR(zeros[0].real(), -1, 1E-15);
+    EXPECT_NEAR(zeros[1].real(), std::exp(-2 * period), 1E-15);
+
+    // Same DC gain
+    EXPECT_NEAR(EvaluateFraction(h, 1).real(), 2.0L / 3, 1E-15);
+
+    // A highpass s / (s + 1) is matched at fs / 4 instead
+    PolynomialFraction highpass
+    {
+        .numerator = Polynomial(CoefficientList{1, 0}),
+        .denominator = Polynomial(CoefficientList{1, 1})
+    };
+    h = Discretization::MatchedZ(highpass, 100);
+    highprecision analogMagnitude = std::abs(EvaluateFraction(highpass, Complex(0, 50 * std::numbers::pi_v<highprecision>)));
+    EXPECT_NEAR(std::abs(EvaluateFraction(h, Complex(0, 1))), analogMagnitude, 1E-15);
+}
+
+TEST(DiscretizationTests, Method_ImpulseInvariance_TransferFunctionsAreProvided_ImpulseResponsesAreSampled)
+{
+    highprecision sampleRate = 50;
+    highprecision period = 1 / sampleRate;
+
+    // 1 / ((s + 1)(s + 2)): h(t) = e^-t - e^-2t
+    PolynomialFraction real
+    {
+        .numerator = Polynomial(CoefficientList{1}),
+        .denominator = Polynomial(CoefficientList{1, 3, 2})
+    };
+    // 1 / (s^2 + 2s + 5): h(t) = e^-t sin(2t) / 2
+    PolynomialFraction complex
+    {
+        .numerator = Polynomial(CoefficientList{1}),
+        .denominator = Polynomial(CoefficientList{1, 2, 5})
+    };
+
+    std::vector<highprecision> response = GetImpulseResponse(Discretization::ImpulseInvariance(real, sampleRate), 200);
+    for(size_t n = 0; n < response.size(); n++)
+    {
+        highprecision t = n * period;
+        EXPECT_NEAR(response[n], period * (std::exp(-t) - std::exp(-2 * t)), 1E-16);
+    }
+    response = GetImpulseResponse(Discretization::ImpulseInvariance(complex, sampleRate), 200);
+    for(size_t n = 0; n < response.size(); n++)
+    {
+        highprecision t = n * period;
+        EXPECT_NEAR(response[n], period * std::exp(-t) * std::sin(2 * t) / 2, 1E-16);
+    }
+
+    // Not strictly proper
+    bool exceptionWasThrown = false;
+    try
+    {
+        PolynomialFraction proper{ .numerator = Polynomial(CoefficientList{1, 0}), .denominator = Polynomial(CoefficientList{1, 1}) };
+        Discretization::ImpulseInvariance(proper, sampleRate);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(DiscretizationTests, Method_DiscretizeBatch_SampleRatesAreProvided_ResultsMatchSingleCalls)
+{
+    PolynomialFraction analog
+    {
+        .numerator = Polynomial(CoefficientList{2, 1}),
+        .denominator = Polynomial(CoefficientList{1, 3, 4, 2})
+    };
+    std::vector<highprecision> sampleRates;
+    for(int i = 0; i < 40; i++)
+    {
+        sampleRates.push_back(20 + 10 * i);
+    }
+
+    TaskPool pool(4);
+    for(DiscretizationMethod method : { DiscretizationMethod::Bilinear, DiscretizationMethod::MatchedZ, DiscretizationMethod::ImpulseInvariance })
+    {
+        std::vector<PolynomialFraction> results = Discretization::Discretize(analog, sampleRates, method, pool, 5);
+        ASSERT_EQ(results.size(), sampleRates.size());
+        for(size_t i = 0; i < sampleRates.size(); i++)
+        {
+            PolynomialFraction single = Discretization::Discretize(analog, sampleRates[i], method, 5);
+            EXPECT_EQ(results[i].numerator, single.numerator);
+            EXPECT_EQ(results[i].denominator, single.denominator);
+            EXPECT_TRUE(StabilityAnalysis::IsSchurStable(results[i]));
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <numbers>
+
+#include "../application/headers/fastfouriertransform.hpp"
+
+using namespace Vath;
+
+TEST(FastFourierTransformTests, Method_Transform_DataOfVariousLengthsIsProvided_ResultMatchesDirectTransform)
+{
+    for(size_t n : { 1, 2, 8, 12, 17, 64 })
+    {
+        std::vector<std::complex<long double>> data(n);
+        for(size_t j = 0; j < n; j++)
+        {
+            data[j] = std::complex<long double>(std::cos(0.3L * j * j), std::sin(1.7L * j) - 0.5L);
+        }
+
+        std::vector<std::complex<long double>> transformed(data);
+        FastFourierTransform<long double>::Transform(transformed);
+        for(size_t k = 0; k < n; k++)
+        {
+            std::complex<long double> direct = 0;
+            for(size_t j = 0; j < n; j++)
+            {
+                long double angle = -2 * std::numbers::pi_v<long double> * (long double)((j * k) % n) / n;
+                direct += data[j] * std::complex<long double>(std::cos(angle), std::sin(angle));
+            }
+            EXPECT_NEAR(transformed[k].real(), direct.real(), 1E-14);
+            EXPECT_NEAR(transformed[k].imag(), direct.imag(), 1E-14);
+        }
+
+        FastFourierTransform<long double>::Transform(transformed, true);
+        for(size_t j = 0; j < n; j++)
+        {
+            EXPECT_NEAR(transformed[j].real(), data[j].real(), 1E-15);
+            EXPECT_NEAR(transformed[j].imag(), data[j].imag(), 1E-15);
+        }
+    }
+}
+
+TEST(FastFourierTransformTests, Method_DiscreteCosineTransform_ValuesAreProvided_ResultMatchesDefinition)
+{
+    std::vector<double> values{ 1, -2, 0.5, 3, 4, -1, 2 };
+    size_t n = values.size() - 1;
+    std::vector<double> transformed = FastFourierTransform<double>::DiscreteCosineTransform(values);
+    ASSERT_EQ(transformed.size(), values.size());
+    for(size_t k = 0; k <= n; k++)
+    {
+        double direct = values[0] + ((k % 2 == 0) ? values[n] : -values[n]);
+        for(size_t j = 1; j < n; j++)
+        {
+            direct += 2 * values[j] * std::cos(std::numbers::pi * j * k / n);
+        }
+        EXPECT_NEAR(transformed[k], direct, 1E-12);
+    }
+}
+
+TEST(FastFourierTransformTests, Method_Convolve_LongSequencesAreProvided_ResultMatchesDirectConvolution)
+{
+    std::vector<double> left, right;
+    for(int i = 0; i < 100; i++)
+    {
+        left.push_back(std::sin(0.1 * i));
+    }
+    for(int i = 0; i < 70; i++)
+    {
+        right.push_back(1.0 / (i + 1));
+    }
+    std::vector<double> result = FastFourierTransform<double>::Convolve(left, right);
+    ASSERT_EQ(result.size(), left.size() + right.size() - 1);
+    for(size_t k = 0; k < result.size(); k++)
+    {
+        double direct = 0;
+        for(size_t i = 0; i < left.size(); i++)
+        {
+            if(k >= i && k - i < right.size())
+            {
+                direct += left[i] * right[k - i];
+            }
+        }
+        EXPECT_NEAR(result[k], direct, 1E-12);
+    }
+}
+
+TEST(FastFourierTransformTests, Method_Transform_TwiddleFactorsAreReused_ResultMatchesTransform)
+{
+    std::vector<std::complex<double>> forward = FastFourierTransform<double>::GetTwiddleFactors(32);
+    std::vector<std::complex<double>> inverse = FastFourierTransform<double>::GetTwiddleFactors(32, true);
+    for(int run = 0; run < 3; run++)
+    {
+        std::vector<std::complex<double>> data(32);
+        for(size_t j = 0; j < data.size(); j++)
+        {
+            data[j] = std::complex<double>(std::cos(0.2 * j * (run + 1)), std::sin(0.9 * j) - run);
+        }
+        std::vector<std::complex<double>> expected(data);
+        FastFourierTransform<double>::Transform(expected);
+
+        std::vector<std::complex<double>> transformed(data);
+        FastFourierTransform<double>::Transform(transformed, forward);
+        for(size_t k = 0; k < data.size(); k++)
+        {
+            EXPECT_NEAR(std::abs(transformed[k] - expected[k]), 0, 1E-12);
+        }
+
+        // Not normalized, the round trip yields n times the data
+        FastFourierTransform<double>::Transform(transformed, inverse);
+        for(size_t j = 0; j < data.size(); j++)
+        {
+            EXPECT_NEAR(std::abs(transformed[j] / 32.0 - data[j]), 0, 1E-14);
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/firdesign.hpp"
+
+using namespace Vath;
+
+static highprecision GetAmplitude(const std::vector<highprecision>& h, highprecision frequency)
+{
+    // |H(e^(j w))| of a linear phase filter
+    highprecision center = (h.size() - 1) / 2.0L;
+    highprecision amplitude = 0;
+    for(size_t n = 0; n < h.size(); n++)
+    {
+        amplitude += h[n] * std::cos(2 * std::numbers::pi_v<highprecision> * frequency * (n - center));
+    }
+    return std::abs(amplitude);
+}
+
+TEST(FirDesignTests, Method_GetWindow_WindowsAreRequested_ValuesAreCorrect)
+{
+    std::vector<highprecision> hamming = FirDesign::GetWindow(WindowType::Hamming, 11);
+    EXPECT_NEAR(hamming[0], 0.08, 1E-18);
+    EXPECT_NEAR(hamming[5], 1, 1E-18);
+    for(size_t n = 0; n < hamming.size(); n++)
+    {
+        EXPECT_EQ(hamming[n], hamming[hamming.size() - 1 - n]);
+    }
+
+    std::vector<highprecision> kaiser = FirDesign::GetWindow(WindowType::Kaiser, 8, 0);
+    for(highprecision value : kaiser)
+    {
+        EXPECT_NEAR(value, 1, 1E-18);
+    }
+    kaiser = FirDesign::GetWindow(WindowType::Kaiser, 9, 5);
+    EXPECT_NEAR(kaiser[4], 1, 1E-18);
+    EXPECT_NEAR(kaiser[0], 1 / 27.239871823604442L, 1E-15);      // 1 / I0(5)
+    EXPECT_NEAR(FirDesign::GetKaiserBeta(60), 0.1102L * 51.3L, 1E-15);
+}
+
+TEST(FirDesignTests, Method_WindowedSinc_FiltersAreDesigned_ResponsesAreCorrect)
+{
+    // Lowpass with blackman window: unit gain at DC, more than 70 dB attenuation in the stopband
+    std::vector<highprecision> h = FirDesign::WindowedSinc(101, 0, 0.1, WindowType::Blackman);
+    ASSERT_EQ(h.size(), 101);
+    EXPECT_NEAR(GetAmplitude(h, 0), 1, 1E-15);
+    EXPECT_NEAR(GetAmplitude(h, 0.1), 0.5, 0.01);
+    for(highprecision f = 0.16; f <= 0.5; f += 0.005)
+    {
+        EXPECT_LT(GetAmplitude(h, f), std::pow(10.0L, -70 / 20.0L));
+    }
+
+    // Bandpass and highpass with kaiser window
+    h = FirDesign::WindowedSinc(151, 0.2, 0.3, WindowType::Kaiser, FirDesign::GetKaiserBeta(60));
+    EXPECT_NEAR(GetAmplitude(h, 0.25), 1, 1E-15);
+    EXPECT_LT(GetAmplitude(h, 0.1), 1E-3);
+    EXPECT_LT(GetAmplitude(h, 0.4), 1E-3);
+    h = FirDesign::WindowedSinc(51, 0.3, 0.5, WindowType::Hann);
+    EXPECT_NEAR(GetAmplitude(h, 0.5), 1, 1E-15);
+    EXPECT_LT(GetAmplitude(h, 0.1), 1E-3);
+
+    // The polynomial in z^-1 evaluates to the frequency response at z^-1 = 1
+    Polynomial p = FirDesign::ToPolynomial(h);
+    EXPECT_NEAR(std::abs(p.EvaluateAt(-1)), 1, 1E-15);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        FirDesign::WindowedSinc(50, 0.3, 0.5, WindowType::Hann);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(FirDesignTests, Method_Remez_FiltersAreDesigned_ResponsesAreEquiripple)
+{
+    TaskPool pool(4);
+    std::vector<FirBand> bands
+    {
+        FirBand{ .lowerFrequency = 0, .upperFrequency = 0.1, .gain = 1, .weight = 1 },
+        FirBand{ .lowerFrequency = 0.15, .upperFrequency = 0.5, .gain = 0, .weight = 10 }
+    };
+
+    for(size_t taps : { 41, 42, 73, 127, 128 })
+    {
+        std::vector<highprecision> h = FirDesign::Remez(taps, bands, pool);
+        ASSERT_EQ(h.size(), taps);
+        for(size_t n = 0; n < taps; n++)
+        {
+            EXPECT_NEAR(h[n], h[taps - 1 - n], 1E-15);
+        }
+
+        // The weighted ripples are equal: passband deviation = 10 * stopband deviation, up to the grid resolution
+        highprecision passbandRipple = 0, stopbandRipple = 0;
+        for(int i = 0; i <= 2000; i++)
+        {
+            highprecision f = i * 0.5L / 2000;
+            if(f <= 0.1)
+            {
+                passbandRipple = std::max(passbandRipple, std::abs(GetAmplitude(h, f) - 1));
+            }
+            else if(f >= 0.15)
+            {
+                stopbandRipple = std::max(stopbandRipple, GetAmplitude(h, f));
+            }
+        }
+        EXPECT_NEAR(passbandRipple / stopbandRipple, 10, 0.25);
+        EXPECT_LT(stopbandRipple, 1E-2);
+    }
+}
+
+TEST(FirDesignTests, Method_Remez_LongFilterIsDesigned_ResponseMeetsSpecification)
+{
+    // Narrow transition, which needs a long filter
+    std::vector<FirBand> bands
+    {
+        FirBand{ .lowerFrequency = 0, .upperFrequency = 0.2, .gain = 1, .weight = 1 },
+        FirBand{ .lowerFrequency = 0.205, .upperFrequency = 0.5, .gain = 0, .weight = 1 }
+    };
+    std::vector<highprecision> h = FirDesign::Remez(1501, bands);
+    ASSERT_EQ(h.size(), 1501);
+
+    highprecision ripple = 0;
+    for(int i = 0; i <= 5000; i++)
+    {
+        highprecision f = i * 0.5L / 5000;
+        if(f <= 0.2)
+        {
+            ripple = std::max(ripple, std::abs(GetAmplitude(h, f) - 1));
+        }
+        else if(f >= 0.205)
+        {
+            ripple = std::max(ripple, GetAmplitude(h, f));
+        }
+    }
+    // Kaiser's estimate for 1501 taps and a transition of 0.005 is about 90 dB
+    EXPECT_LT(ripple, std::pow(10.0L, -80 / 20.0L));
+}
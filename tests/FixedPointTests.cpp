@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/fixedpoint.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/discretization.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+TEST(FixedPointTests, Method_Quantize_RoundingModes_ValuesAreRoundedAndShifted)
+{
+    // 1.9 needs one integer bit, the last two are exact halfway cases after the shift
+    std::vector<highprecision> coefficients{0.5, -0.25, 1.9, 2.5L / 16384, -2.5L / 16384};
+    std::vector<std::pair<RoundingMode, std::vector<int32_t>>> cases
+    {
+        { RoundingMode::Nearest,    {8192, -4096, 31130, 3, -3} },
+        { RoundingMode::Convergent, {8192, -4096, 31130, 2, -2} },
+        { RoundingMode::Floor,      {8192, -4096, 31129, 2, -3} },
+        { RoundingMode::TowardZero, {8192, -4096, 31129, 2, -2} }
+    };
+    for(const auto& [rounding, expected] : cases)
+    {
+        QuantizedCoefficients quantized = FixedPoint::Quantize(coefficients, FixedPointFormat::Q15, rounding);
+        EXPECT_EQ(quantized.integerBits, 1);
+        EXPECT_EQ(quantized.values, expected);
+    }
+
+    QuantizedCoefficients q31 = FixedPoint::Quantize(Polynomial({1, -1.5, 0.75}), FixedPointFormat::Q31);
+    EXPECT_EQ(q31.integerBits, 1);
+    std::vector<highprecision> restored = FixedPoint::Dequantize(q31);
+    ASSERT_EQ(restored.size(), 3);
+    EXPECT_NEAR(restored[0], 1, 1E-9);
+    EXPECT_EQ(restored[1], -1.5);
+    EXPECT_EQ(restored[2], 0.75);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        FixedPoint::Quantize(std::vector<highprecision>{300}, FixedPointFormat::Q15);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(FixedPointTests, Method_ToQ15AndToQ31_NonFiniteSamples_ExceptionsAreThrown)
+{
+    // Out of range samples saturate, but NaN and infinity have no fixed point value
+    std::vector<int16_t> saturated = FixedPoint::ToQ15(std::vector<highprecision>{-1E30L, 1E30L});
+    EXPECT_EQ(saturated[0], -32768);
+    EXPECT_EQ(saturated[1], 32767);
+
+    for(highprecision sample : {std::numeric_limits<highprecision>::quiet_NaN(), std::numeric_limits<highprecision>::infinity()})
+    {
+        std::vector<highprecision> signal{0.5, sample};
+        std::vector<std::function<void()>> calls
+        {
+            [&signal](){ FixedPoint::ToQ15(signal); },
+            [&signal](){ FixedPoint::ToQ31(signal); }
+        };
+        for(const std::function<void()>& call : calls)
+        {
+            bool exceptionWasThrown = false;
+            try
+            {
+                call();
+            }
+            catch(...)
+            {
+                exceptionWasThrown = true;
+            }
+            EXPECT_TRUE(exceptionWasThrown);
+        }
+    }
+}
+
+TEST(FixedPointTests, Method_FilterFir_Q15AndQ31_OutputsMatchFloatingPointConvolution)
+{
+    // 37 taps, so the vectorized dot product has a scalar tail
+    std::vector<highprecision> taps;
+    for(int k = 0; k < 37; k++)
+    {
+        taps.push_back(0.2L * std::cos(0.4L * k) * std::exp(-0.05L * k));
+    }
+    std::vector<highprecision> signal = GetTestSignal(300);
+
+    auto convolve = [](const std::vector<highprecision>& h, const std::vector<highprecision>& x)
+    {
+        std::vector<highprecision> y(x.size(), 0);
+        for(size_t n = 0; n < x.size(); n++)
+        {
+            for(size_t k = 0; k < h.size() && k <= n; k++)
+            {
+                y[n] += h[k] * x[n - k];
+            }
+        }
+        return y;
+    };
+
+    QuantizedCoefficients q15Taps = FixedPoint::Quantize(taps, FixedPointFormat::Q15);
+    std::vector<int16_t> q15Signal = FixedPoint::ToQ15(signal);
+    std::vector<highprecision> expected = convolve(FixedPoint::Dequantize(q15Taps), FixedPoint::FromFixedPoint(q15Signal));
+    std::vector<highprecision> q15Output = FixedPoint::FromFixedPoint(FixedPoint::FilterFir(q15Taps, q15Signal));
+    ASSERT_EQ(q15Output.size(), signal.size());
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        EXPECT_NEAR(q15Output[n], expected[n], 0.5L / 32768 + 1E-12);
+    }
+
+    QuantizedCoefficients q31Taps = FixedPoint::Quantize(taps, FixedPointFormat::Q31);
+    std::vector<int32_t> q31Signal = FixedPoint::ToQ31(signal);
+    expected = convolve(FixedPoint::Dequantize(q31Taps), FixedPoint::FromFixedPoint(q31Signal));
+    std::vector<highprecision> q31Output = FixedPoint::FromFixedPoint(FixedPoint::FilterFir(q31Taps, q31Signal));
+    ASSERT_EQ(q31Output.size(), signal.size());
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        EXPECT_NEAR(q31Output[n], expected[n], 2E-9);
+    }
+}
+
+TEST(FixedPointTests, Method_FilterBiquads_ScaledCascade_OutputsFollowFloatingPointFilter)
+{
+    SecondOrderSections sos(Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 6), 8), SectionScaling::LInfinity);
+    std::vector<highprecision> signal = GetTestSignal(400);
+
+    // Direct form I in floating point with the quantized coefficients
+    auto filter = [](const std::vector<highprecision>& c, std::vector<highprecision> x)
+    {
+        for(size_t k = 0; k < c.size(); k += SecondOrderSections::COEFFICIENTS_PER_SECTION)
+        {
+            highprecision x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+            for(highprecision& sample : x)
+            {
+                highprecision y0 = c[k] * sample + c[k + 1] * x1 + c[k + 2] * x2 - c[k + 3] * y1 - c[k + 4] * y2;
+                x2 = x1;
+                x1 = sample;
+                y2 = y1;
+                y1 = y0;
+                sample = y0;
+            }
+        }
+        return x;
+    };
+
+    QuantizedCoefficients q31 = FixedPoint::Quantize(sos, FixedPointFormat::Q31);
+    EXPECT_EQ(q31.integerBits, 1);
+    std::vector<int32_t> q31Signal = FixedPoint::ToQ31(signal);
+    std::vector<highprecision> expected = filter(FixedPoint::Dequantize(q31), FixedPoint::FromFixedPoint(q31Signal));
+    std::vector<highprecision> output = FixedPoint::FromFixedPoint(FixedPoint::FilterBiquads(q31, q31Signal));
+    ASSERT_EQ(output.size(), signal.size());
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        EXPECT_NEAR(output[n], expected[n], 1E-7);
+    }
+
+    // Q15 adds rounding noise in every section, which the narrow poles amplify
+    QuantizedCoefficients q15 = FixedPoint::Quantize(sos, FixedPointFormat::Q15);
+    std::vector<int16_t> q15Signal = FixedPoint::ToQ15(signal);
+    expected = filter(FixedPoint::Dequantize(q15), FixedPoint::FromFixedPoint(q15Signal));
+    output = FixedPoint::FromFixedPoint(FixedPoint::FilterBiquads(q15, q15Signal));
+    for(size_t n = 0; n < signal.size(); n++)
+    {
+        EXPECT_NEAR(output[n], expected[n], 1E-2);
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        FixedPoint::FilterBiquads(q31, q15Signal);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(FixedPointTests, Method_AnalyzePoleMovement_NarrowbandFilter_CascadeStaysStableDirectFormDoesNot)
+{
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 8), 20);
+    SecondOrderSections sos(h, SectionScaling::LInfinity);
+
+    PoleMovement direct = FixedPoint::AnalyzePoleMovement(h, FixedPointFormat::Q15);
+    PoleMovement cascade = FixedPoint::AnalyzePoleMovement(sos, FixedPointFormat::Q15);
+    ASSERT_EQ(direct.originalPoles.size(), 8);
+    ASSERT_EQ(direct.quantizedPoles.size(), 8);
+    ASSERT_EQ(cascade.quantizedPoles.size(), 8);
+
+    EXPECT_FALSE(direct.isStable);
+    EXPECT_GT(direct.maximumRadius, 1);
+    EXPECT_TRUE(cascade.isStable);
+    EXPECT_LT(cascade.maximumRadius, 1);
+    EXPECT_LT(cascade.maximumDisplacement, 1E-3);
+    EXPECT_GT(direct.maximumDisplacement, 100 * cascade.maximumDisplacement);
+
+    // Q31 moves the direct form poles less, though not necessarily back into the unit circle
+    PoleMovement directQ31 = FixedPoint::AnalyzePoleMovement(h, FixedPointFormat::Q31);
+    EXPECT_LT(directQ31.maximumDisplacement, direct.maximumDisplacement);
+}
+
+TEST(FixedPointTests, Method_AnalyzePoleMovement_LeadingCoefficientIsRoundedAway_PoleMovesToInfinity)
+{
+    // 1E-6 z^2 + z + 0.5 has poles at about -0.5 and -1E6, Q15 rounds the leading coefficient to 0
+    PolynomialFraction h{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial(CoefficientList{1E-6, 1, 0.5}) };
+    PoleMovement movement = FixedPoint::AnalyzePoleMovement(h, FixedPointFormat::Q15);
+    ASSERT_EQ(movement.originalPoles.size(), 2);
+    ASSERT_EQ(movement.quantizedPoles.size(), 2);
+
+    size_t lost = (std::abs(movement.originalPoles[0]) > std::abs(movement.originalPoles[1])) ? 0 : 1;
+    EXPECT_TRUE(std::isinf(movement.quantizedPoles[lost].real()));
+    EXPECT_NEAR(movement.quantizedPoles[1 - lost].real(), -0.5, 1E-3);
+    EXPECT_TRUE(std::isinf(movement.maximumDisplacement));
+    EXPECT_TRUE(std::isinf(movement.maximumRadius));
+    EXPECT_FALSE(movement.isStable);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/interval.hpp"
+
+using namespace Vath;
+
+TEST(IntervalTests, Constructor_LowerIsGreaterThanUpper_ExceptionIsThrown)
+{
+    bool exceptionWasThrown = false;
+    try
+    {
+        Interval i(2, 1);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(IntervalTests, Operator_Addition_IntervalsAreAdded_ResultEnclosesExactResult)
+{
+    Interval a(0.1L, 0.2L);
+    Interval b(0.3L, 0.4L);
+    Interval result = a + b;
+    EXPECT_TRUE(result.Lower <= 0.1L + 0.3L);
+    EXPECT_TRUE(result.Upper >= 0.2L + 0.4L);
+    EXPECT_TRUE(result.Lower < result.Upper);
+}
+
+TEST(IntervalTests, Operator_Multiplication_IntervalsWithMixedSignsAreMultiplied_ResultIsCorrect)
+{
+    Interval a(-2, 3);
+    Interval b(-5, 4);
+    Interval result = a * b;
+    EXPECT_TRUE(result.Contains(-15));
+    EXPECT_TRUE(result.Contains(12));
+    EXPECT_FALSE(result.Contains(-15.001L));
+    EXPECT_FALSE(result.Contains(12.001L));
+}
+
+TEST(IntervalTests, Operator_Division_DivisorContainsZero_ExceptionIsThrown)
+{
+    bool exceptionWasThrown = false;
+    try
+    {
+        Interval(1, 2) / Interval(-1, 1);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(IntervalTests, Method_Intersect_IntervalsOverlap_ResultIsCorrect)
+{
+    Interval result = Interval::Intersect(Interval(-1, 3), Interval(2, 5));
+    EXPECT_TRUE(result == Interval(2, 3));
+    EXPECT_TRUE(Interval(0, 10).ContainsInInterior(Interval(1, 9)));
+    EXPECT_FALSE(Interval(0, 10).ContainsInInterior(Interval(0, 9)));
+}
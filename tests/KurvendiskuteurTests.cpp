@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/kurvendiskuteur.hpp"
+
+using namespace Vath;
+
+TEST(KurvendiskuteurTests, Method_FullDiscussion_CubicIsProvided_ExtremaAndInflectionPointAreCorrect)
+{
+    // f(x) = x^3 - 3x, f'(x) = 3x^2 - 3, f''(x) = 6x
+    Kurvendiskuteur discussion(Polynomial(CoefficientList{1, 0, -3, 0}));
+    discussion.FullDiscussion();
+
+    std::vector<highprecision> zeros = discussion.GetZeros();
+    ASSERT_EQ(zeros.size(), 3);
+    EXPECT_NEAR(zeros[0], -std::sqrt(3.0L), 1E-9);
+    EXPECT_NEAR(zeros[1], 0, 1E-9);
+    EXPECT_NEAR(zeros[2], std::sqrt(3.0L), 1E-9);
+
+    ASSERT_EQ(discussion.GetMaxima().size(), 1);
+    EXPECT_NEAR(discussion.GetMaxima()[0].x, -1, 1E-9);
+    EXPECT_NEAR(discussion.GetMaxima()[0].y, 2, 1E-9);
+    ASSERT_EQ(discussion.GetMinima().size(), 1);
+    EXPECT_NEAR(discussion.GetMinima()[0].x, 1, 1E-9);
+    EXPECT_NEAR(discussion.GetMinima()[0].y, -2, 1E-9);
+
+    ASSERT_EQ(discussion.GetInflectionPoints().size(), 1);
+    EXPECT_NEAR(discussion.GetInflectionPoints()[0].x, 0, 1E-9);
+    EXPECT_NEAR(discussion.GetInflectionPoints()[0].y, 0, 1E-9);
+
+    EXPECT_EQ(discussion.GetSymmetry(), SymmetryType::PointSymmetric);
+    ASSERT_TRUE(discussion.GetYAxisIntercept().has_value());
+    EXPECT_NEAR(discussion.GetYAxisIntercept().value(), 0, 1E-12);
+    EXPECT_FALSE(discussion.GetAsymptote().has_value());
+    EXPECT_TRUE(discussion.GetPoles().empty());
+}
+
+TEST(KurvendiskuteurTests, Method_FullDiscussion_CubicIsProvided_SectionsAreCorrect)
+{
+    // f(x) = x^3 - 3x increases on (-inf, -1), decreases on (-1, 1), increases on (1, inf)
+    Kurvendiskuteur discussion(Polynomial(CoefficientList{1, 0, -3, 0}));
+    TaskPool pool(2);
+    discussion.FullDiscussion(pool);
+
+    std::vector<MonotonicSection> monotonicity = discussion.GetMonotonicity();
+    ASSERT_EQ(monotonicity.size(), 3);
+    EXPECT_TRUE(std::isinf(monotonicity[0].range.Lower));
+    EXPECT_NEAR(monotonicity[0].range.Upper, -1, 1E-9);
+    EXPECT_TRUE(monotonicity[0].increasing);
+    EXPECT_NEAR(monotonicity[1].range.Lower, -1, 1E-9);
+    EXPECT_NEAR(monotonicity[1].range.Upper, 1, 1E-9);
+    EXPECT_FALSE(monotonicity[1].increasing);
+    EXPECT_TRUE(monotonicity[2].increasing);
+
+    std::vector<CurvatureSection> curvature = discussion.GetCurvature();
+    ASSERT_EQ(curvature.size(), 2);
+    EXPECT_FALSE(curvature[0].convex);
+    EXPECT_TRUE(curvature[1].convex);
+
+    // x^4 has a minimum at 0 but no inflection point (f''(0) = 0 without sign change)
+    Kurvendiskuteur quartic(Polynomial(CoefficientList{1, 0, 0, 0, 0}));
+    quartic.FullDiscussion(pool);
+    EXPECT_EQ(quartic.GetMinima().size(), 1);
+    EXPECT_TRUE(quartic.GetMaxima().empty());
+    EXPECT_TRUE(quartic.GetInflectionPoints().empty());
+    EXPECT_EQ(quartic.GetSymmetry(), SymmetryType::AxialSymmetric);
+}
+
+TEST(KurvendiskuteurTests, Method_FullDiscussion_RationalFunctionIsProvided_PolesAndAsymptoteAreCorrect)
+{
+    // f(x) = (x^2 + 1) / (x^2 - 1), the common factor (x - 2) is cancelled
+    PolynomialFraction f
+    {
+        .numerator = Polynomial(CoefficientList{1, 0, 1}) * Polynomial(CoefficientList{1, -2}),
+        .denominator = Polynomial(CoefficientList{1, 0, -1}) * Polynomial(CoefficientList{1, -2})
+    };
+    Kurvendiskuteur discussion(f);
+    discussion.FullDiscussion();
+
+    EXPECT_TRUE(discussion.GetZeros().empty());
+    std::vector<highprecision> poles = discussion.GetPoles();
+    ASSERT_EQ(poles.size(), 2);
+    EXPECT_NEAR(poles[0], -1, 1E-9);
+    EXPECT_NEAR(poles[1], 1, 1E-9);
+
+    ASSERT_TRUE(discussion.GetAsymptote().has_value());
+    EXPECT_EQ(discussion.GetAsymptote().value().GetOrder(), 0);
+    EXPECT_NEAR(discussion.GetAsymptote().value().EvaluateAt(0), 1, 1E-9);
+    EXPECT_EQ(discussion.GetSymmetry(), SymmetryType::AxialSymmetric);
+    EXPECT_NEAR(discussion.GetYAxisIntercept().value(), -1, 1E-9);
+
+    // f'(x) = -4x / (x^2 - 1)^2: local maximum at (0, -1) between the poles
+    ASSERT_EQ(discussion.GetMaxima().size(), 1);
+    EXPECT_NEAR(discussion.GetMaxima()[0].x, 0, 1E-9);
+    EXPECT_NEAR(discussion.GetMaxima()[0].y, -1, 1E-9);
+    EXPECT_TRUE(discussion.GetMinima().empty());
+    EXPECT_TRUE(discussion.GetInflectionPoints().empty());
+    EXPECT_EQ(discussion.GetMonotonicity().size(), 4);
+    EXPECT_EQ(discussion.GetCurvature().size(), 3);
+}
+
+TEST(KurvendiskuteurTests, Constructor_DenominatorIsZero_ExceptionIsThrown)
+{
+    bool exceptionWasThrown = false;
+    try
+    {
+        PolynomialFraction f
+        {
+            .numerator = Polynomial(CoefficientList{1, 0}),
+            .denominator = Polynomial(CoefficientList{0})
+        };
+        Kurvendiskuteur discussion(f);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
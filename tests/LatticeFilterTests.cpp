@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/latticefilter.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/discretization.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+TEST(LatticeFilterTests, Method_LevinsonDurbin_AutoregressiveFrames_NormalEquationsAreSolved)
+{
+    // Frames of an AR(3) process driven by a deterministic pseudo random sequence
+    std::vector<std::vector<highprecision>> autocorrelations;
+    unsigned int seed = 12345;
+    for(int frame = 0; frame < 6; frame++)
+    {
+        std::vector<highprecision> x(400, 0);
+        for(size_t n = 0; n < x.size(); n++)
+        {
+            seed = seed * 1103515245 + 12345;
+            highprecision noise = ((seed >> 8) % 2001) / 1000.0L - 1;
+            x[n] = noise + (n >= 1 ? 1.2L * x[n - 1] : 0) - (n >= 2 ? 0.7L * x[n - 2] : 0) + (n >= 3 ? 0.1L * x[n - 3] : 0);
+        }
+        autocorrelations.push_back(LatticeFilter::GetAutocorrelation(x, 8));
+    }
+
+    const size_t order = 8;
+    TaskPool pool(2);
+    std::vector<LinearPredictor> predictors = LatticeFilter::LevinsonDurbin(autocorrelations, order, pool);
+    ASSERT_EQ(predictors.size(), autocorrelations.size());
+    for(size_t f = 0; f < autocorrelations.size(); f++)
+    {
+        const std::vector<highprecision>& r = autocorrelations[f];
+        CoefficientList a = predictors[f].predictor.GetCoefficients();
+        ASSERT_EQ(a.size(), order + 1);
+        EXPECT_EQ(a[0], 1);
+
+        // sum_j a_j r_|i-j| = 0 for i = 1..p, and the error is sum_j a_j r_j
+        highprecision error = 0;
+        for(size_t i = 0; i <= order; i++)
+        {
+            highprecision sum = 0;
+            for(size_t j = 0; j <= order; j++)
+            {
+                sum += a[j] * r[(i > j) ? i - j : j - i];
+            }
+            if(i == 0)
+            {
+                error = sum;
+            }
+            else
+            {
+                EXPECT_NEAR(sum / r[0], 0, 1E-15);
+            }
+        }
+        EXPECT_NEAR(predictors[f].predictionError / error, 1, 1E-14);
+
+        // The dominant coefficients of the process are found
+        EXPECT_NEAR(a[1], -1.2, 0.15);
+        EXPECT_NEAR(a[2], 0.7, 0.15);
+
+        // The allocation free kernel yields the same
+        std::vector<highprecision> predictor(order + 1), reflection(order);
+        highprecision kernelError = LatticeFilter::LevinsonDurbin(r.data(), order, predictor.data(), reflection.data());
+        EXPECT_EQ(kernelError, predictors[f].predictionError);
+        EXPECT_EQ(reflection, predictors[f].reflectionCoefficients);
+    }
+}
+
+TEST(LatticeFilterTests, Method_FromReflectionCoefficients_StepUpAndStepDown_AreInverse)
+{
+    std::vector<highprecision> reflection{0.5, -0.3, 0.8, 0.1, -0.95};
+    Polynomial denominator = LatticeFilter::FromReflectionCoefficients(reflection);
+    EXPECT_EQ(denominator.GetOrder(), 5);
+    std::vector<highprecision> restored = LatticeFilter::ToReflectionCoefficients(denominator * 3);
+    ASSERT_EQ(restored.size(), reflection.size());
+    for(size_t m = 0; m < reflection.size(); m++)
+    {
+        EXPECT_NEAR(restored[m], reflection[m], 1E-15);
+    }
+
+    // The levinson predictor is the step-up of its reflection coefficients
+    LinearPredictor predictor = LatticeFilter::LevinsonDurbin({4, 2, 0.5, -0.3}, 3);
+    CoefficientList expected = predictor.predictor.GetCoefficients();
+    CoefficientList steppedUp = LatticeFilter::FromReflectionCoefficients(predictor.reflectionCoefficients).GetCoefficients();
+    ASSERT_EQ(steppedUp.size(), expected.size());
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(steppedUp[i], expected[i], 1E-16);
+    }
+}
+
+TEST(LatticeFilterTests, Method_Process_LatticeLadderRealization_ImpulseResponsesMatchDirectForm)
+{
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Elliptic, 5, 0.5, 50), 4);
+    LatticeFilter lattice(h);
+    EXPECT_EQ(lattice.GetReflectionCoefficients().size(), 5);
+    EXPECT_EQ(lattice.GetLadderCoefficients().size(), 6);
+
+    std::vector<highprecision> impulse(300, 0);
+    impulse[0] = 1;
+    std::vector<highprecision> expected = GetImpulseResponse(h, impulse.size());
+    std::vector<highprecision> response = lattice.Process(std::vector<highprecision>(impulse.begin(), impulse.begin() + 120));
+    std::vector<highprecision> rest = lattice.Process(std::vector<highprecision>(impulse.begin() + 120, impulse.end()));
+    response.insert(response.end(), rest.begin(), rest.end());
+    for(size_t n = 0; n < impulse.size(); n++)
+    {
+        EXPECT_NEAR(response[n], expected[n], 1E-15);
+    }
+
+    // All-pole: only v_0 is set
+    std::vector<highprecision> reflection{0.6, -0.4, 0.3};
+    LatticeFilter allPole(reflection, {1, 0, 0, 0});
+    PolynomialFraction synthesis{ .numerator = Polynomial(CoefficientList{1, 0, 0, 0}), .denominator = LatticeFilter::FromReflectionCoefficients(reflection) };
+    expected = GetImpulseResponse(synthesis, 50);
+    response = allPole.Process(std::vector<highprecision>(impulse.begin(), impulse.begin() + 50));
+    for(size_t n = 0; n < 50; n++)
+    {
+        EXPECT_NEAR(response[n], expected[n], 1E-17);
+    }
+    allPole.Reset();
+    EXPECT_EQ(allPole.Process(std::vector<highprecision>(impulse.begin(), impulse.begin() + 50)), response);
+}
+
+TEST(LatticeFilterTests, Ctor_InvalidArguments_ExceptionsAreThrown)
+{
+    std::vector<std::function<void()>> calls
+    {
+        [](){ LatticeFilter filter({0.5, 0.2}, {1, 0}); },
+        [](){ LatticeFilter filter({0.5, 1.0}, {1, 0, 0}); },
+        [](){ LatticeFilter filter(PolynomialFraction{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial(CoefficientList{1, 0, 1.2}) }); },
+        [](){ LatticeFilter::LevinsonDurbin({1, 2}, 1); },
+        [](){ LatticeFilter::LevinsonDurbin({1, 0.5}, 2); }
+    };
+    for(const std::function<void()>& call : calls)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            call();
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/padeapproximant.hpp"
+
+using namespace Vath;
+
+static PowerSeries GetExponentialSeries(size_t precision)
+{
+    std::vector<highprecision> coefficients{1};
+    for(size_t k = 1; k < precision; k++)
+    {
+        coefficients.push_back(coefficients.back() / k);
+    }
+    return PowerSeries(coefficients, precision);
+}
+
+TEST(PadeApproximantTests, Method_Approximate_Exponential_KnownApproximantIsFound)
+{
+    // [2/2] of e^x is (12 + 6x + x^2) / (12 - 6x + x^2)
+    PolynomialFraction approximant = PadeApproximant::Approximate(GetExponentialSeries(5), 2, 2);
+    CoefficientList numerator = approximant.numerator.GetCoefficients();
+    CoefficientList denominator = approximant.denominator.GetCoefficients();
+    CoefficientList expectedNumerator{1.0L / 12, 0.5, 1};
+    CoefficientList expectedDenominator{1.0L / 12, -0.5, 1};
+    ASSERT_EQ(numerator.size(), 3);
+    ASSERT_EQ(denominator.size(), 3);
+    for(size_t i = 0; i < 3; i++)
+    {
+        EXPECT_NEAR(numerator[i], expectedNumerator[i], 1E-18);
+        EXPECT_NEAR(denominator[i], expectedDenominator[i], 1E-18);
+    }
+
+    // Better than the taylor polynomial of the same order
+    highprecision x = 1;
+    highprecision padeError = std::abs(approximant.numerator.EvaluateAt(x) / approximant.denominator.EvaluateAt(x) - std::exp(x));
+    highprecision taylorError = std::abs(1 + x + x * x / 2 + x * x * x / 6 + x * x * x * x / 24 - std::exp(x));
+    EXPECT_LT(padeError, taylorError);
+}
+
+TEST(PadeApproximantTests, Method_SolveToeplitz_NonsymmetricSystem_SolutionSatisfiesSystem)
+{
+    const size_t n = 40;
+    std::vector<highprecision> column(n), row(n), rightSide(n);
+    for(size_t k = 0; k < n; k++)
+    {
+        column[k] = (k == 0) ? 4 : std::sin(1.3L * k) / (k + 1);
+        row[k] = (k == 0) ? 4 : std::cos(0.7L * k) / (k + 2);
+        rightSide[k] = std::cos(0.3L * k);
+    }
+    std::vector<highprecision> solution = PadeApproximant::SolveToeplitz(column, row, rightSide);
+    ASSERT_EQ(solution.size(), n);
+    for(size_t i = 0; i < n; i++)
+    {
+        highprecision sum = 0;
+        for(size_t j = 0; j < n; j++)
+        {
+            sum += ((i >= j) ? column[i - j] : row[j - i]) * solution[j];
+        }
+        EXPECT_NEAR(sum, rightSide[i], 1E-16);
+    }
+}
+
+TEST(PadeApproximantTests, Method_Approximate_ManyOrders_MatchSingleApproximantsAndSeries)
+{
+    // log(1 + x) = x - x^2 / 2 + x^3 / 3 - ...
+    const size_t precision = 24;
+    std::vector<highprecision> coefficients(precision, 0);
+    for(size_t k = 1; k < precision; k++)
+    {
+        coefficients[k] = ((k % 2 == 1) ? 1.0L : -1.0L) / k;
+    }
+    PowerSeries series(coefficients, precision);
+
+    std::vector<PadeOrder> orders{{3, 3}, {5, 4}, {3, 1}, {7, 7}, {5, 6}, {2, 0}, {11, 10}};
+    TaskPool pool(2);
+    std::vector<PolynomialFraction> approximants = PadeApproximant::Approximate(series, orders, pool);
+    ASSERT_EQ(approximants.size(), orders.size());
+    for(size_t i = 0; i < orders.size(); i++)
+    {
+        size_t L = orders[i].numeratorOrder, M = orders[i].denominatorOrder;
+        PolynomialFraction single = PadeApproximant::Approximate(series, L, M);
+        EXPECT_EQ(approximants[i].numerator.GetCoefficients(), single.numerator.GetCoefficients());
+        EXPECT_EQ(approximants[i].denominator.GetCoefficients(), single.denominator.GetCoefficients());
+        EXPECT_LE(approximants[i].numerator.GetOrder(), L);
+        EXPECT_LE(approximants[i].denominator.GetOrder(), M);
+
+        // P / Q agrees with the series up to x^(L+M), the hankel systems of the higher orders are badly conditioned
+        PowerSeries quotient = PowerSeries(approximants[i].numerator, L + M + 1) / PowerSeries(approximants[i].denominator, L + M + 1);
+        for(size_t k = 0; k <= L + M; k++)
+        {
+            EXPECT_NEAR(quotient.GetCoefficient(k), series.GetCoefficient(k), 1E-13);
+        }
+    }
+}
+
+TEST(PadeApproximantTests, Method_Approximate_InvalidArguments_ExceptionsAreThrown)
+{
+    PowerSeries cosine(std::vector<highprecision>{1, 0, -0.5, 0, 1.0L / 24}, 5);
+    std::vector<std::function<void()>> calls
+    {
+        [&](){ PadeApproximant::Approximate(cosine, 2, 3); },
+        [&](){ PadeApproximant::Approximate(cosine, 1, 1); },
+        [&](){ PadeApproximant::Approximate(cosine, std::vector<PadeOrder>{{0, 1}, {4, 1}}); },
+        [](){ PadeApproximant::SolveToeplitz({1, 2}, {1, 3, 4}, {1, 1}); },
+        [](){ PadeApproximant::SolveToeplitz({1, 2}, {2, 3}, {1, 1}); },
+        [](){ PadeApproximant::SolveToeplitz({1, 1}, {1, 1}, {1, 1}); }
+    };
+    for(const std::function<void()>& call : calls)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            call();
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/partialfraction.hpp"
+
+using namespace Vath;
+
+typedef std::complex<highprecision> Complex;
+
+static Complex EvaluateExpansion(const PartialFractionExpansion& expansion, Complex x)
+{
+    Complex value = 0;
+    for(highprecision c : expansion.direct.GetCoefficients())
+    {
+        value = value * x + c;
+    }
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        value += term.residue / std::pow(x - term.pole, term.power);
+    }
+    return value;
+}
+
+static Complex EvaluateFraction(const PolynomialFraction& f, Complex x)
+{
+    Complex numerator = 0, denominator = 0;
+    for(highprecision c : f.numerator.GetCoefficients())
+    {
+        numerator = numerator * x + c;
+    }
+    for(highprecision c : f.denominator.GetCoefficients())
+    {
+        denominator = denominator * x + c;
+    }
+    return numerator / denominator;
+}
+
+TEST(PartialFractionTests, Method_Expand_SimplePoles_ResiduesAreCorrect)
+{
+    // (2x + 3) / (x^2 + 3x + 2) = 1 / (x + 2) + 1 / (x + 1)
+    PolynomialFraction f{ .numerator = Polynomial(CoefficientList{2, 3}), .denominator = Polynomial(CoefficientList{1, 3, 2}) };
+    PartialFractionExpansion expansion = PartialFraction::Expand(f);
+
+    ASSERT_EQ(expansion.terms.size(), 2);
+    EXPECT_NEAR(expansion.terms[0].pole.real(), -2, 1E-15);
+    EXPECT_NEAR(expansion.terms[1].pole.real(), -1, 1E-15);
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        EXPECT_EQ(term.power, 1);
+        EXPECT_NEAR(term.residue.real(), 1, 1E-15);
+        EXPECT_EQ(term.residue.imag(), 0);
+    }
+    EXPECT_EQ(expansion.direct.GetOrder(), 0);
+    EXPECT_EQ(expansion.direct.GetCoefficients()[0], 0);
+}
+
+TEST(PartialFractionTests, Method_Expand_ImproperFractionWithMultiplePoles_ExpansionMatchesFraction)
+{
+    // (x^6 + 3) / ((x - 1)^3 (x^2 + 2x + 5)), deg 6 > deg 5
+    Polynomial denominator = Polynomial::FromZeros(std::vector<Complex>{1, 1, 1, Complex(-1, -2), Complex(-1, 2)});
+    PolynomialFraction f{ .numerator = Polynomial(CoefficientList{1, 0, 0, 0, 0, 0, 3}), .denominator = denominator };
+    PartialFractionExpansion expansion = PartialFraction::Expand(f);
+
+    ASSERT_EQ(expansion.terms.size(), 5);
+    EXPECT_EQ(expansion.direct.GetOrder(), 1);
+
+    // -1 - 2i, -1 + 2i, then 1 with the powers 1, 2, 3
+    EXPECT_EQ(expansion.terms[0].pole, std::conj(expansion.terms[1].pole));
+    EXPECT_EQ(expansion.terms[0].residue, std::conj(expansion.terms[1].residue));
+    for(int power = 1; power <= 3; power++)
+    {
+        EXPECT_NEAR(expansion.terms[1 + power].pole.real(), 1, 1E-15);
+        EXPECT_EQ(expansion.terms[1 + power].power, power);
+    }
+    // The coefficient of 1 / (x - 1)^3 is (1 + 3) / (1 + 2 + 5)
+    EXPECT_NEAR(expansion.terms[4].residue.real(), 0.5, 1E-14);
+
+    for(Complex x : {Complex(0, 0), Complex(2, 1), Complex(-3, 0.5), Complex(0.5, -4)})
+    {
+        Complex expected = EvaluateFraction(f, x);
+        EXPECT_LT(std::abs(EvaluateExpansion(expansion, x) - expected), 1E-12 * std::abs(expected));
+    }
+}
+
+TEST(PartialFractionTests, Method_Expand_ClusteredPoles_PolesAreNotMerged)
+{
+    // 1 / ((x - 1)(x - 1 - 1E-6)), the square-free factorization would merge both poles into a double one
+    PolynomialFraction f{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial::FromZeros(std::vector<Complex>{1, 1 + 1E-6L}) };
+    PartialFractionExpansion expansion = PartialFraction::Expand(f);
+
+    ASSERT_EQ(expansion.terms.size(), 2);
+    EXPECT_NEAR(expansion.terms[0].pole.real(), 1, 1E-12);
+    EXPECT_NEAR(expansion.terms[1].pole.real(), 1 + 1E-6L, 1E-12);
+    for(const PartialFractionTerm& term : expansion.terms)
+    {
+        EXPECT_EQ(term.power, 1);
+    }
+    for(Complex x : std::vector<Complex>{ Complex(0, 0), Complex(2, 0), Complex(1, 0.5) })
+    {
+        Complex expected = EvaluateFraction(f, x);
+        Complex actual = EvaluateExpansion(expansion, x);
+        EXPECT_NEAR(actual.real(), expected.real(), 1E-6 * std::abs(expected));
+        EXPECT_NEAR(actual.imag(), expected.imag(), 1E-6 * std::abs(expected));
+    }
+}
+
+TEST(PartialFractionTests, Method_Combine_ExpansionsAreCombined_FractionsAreRebuilt)
+{
+    std::vector<PolynomialFraction> fractions
+    {
+        PolynomialFraction{ .numerator = Polynomial(CoefficientList{2, 3}), .denominator = Polynomial(CoefficientList{2, 6, 4}) },
+        PolynomialFraction{ .numerator = Polynomial(CoefficientList{1, 0, 0, 0, 0, 0, 3}), .denominator = Polynomial::FromZeros(std::vector<Complex>{1, 1, 1, Complex(-1, -2), Complex(-1, 2)}) },
+        PolynomialFraction{ .numerator = Polynomial(CoefficientList{1, -1, 4}), .denominator = Polynomial(CoefficientList{1, 2, 2, 0, 0}) },
+        PolynomialFraction{ .numerator = Polynomial(CoefficientList{5, 1}), .denominator = Polynomial(CoefficientList{3}) }
+    };
+    std::vector<PartialFractionExpansion> expansions = PartialFraction::Expand(fractions);
+    ASSERT_EQ(expansions.size(), fractions.size());
+
+    for(size_t i = 0; i < fractions.size(); i++)
+    {
+        PolynomialFraction rebuilt = PartialFraction::Combine(expansions[i]);
+
+        // The same fraction with a monic denominator
+        CoefficientList denominator = fractions[i].denominator.GetCoefficients();
+        CoefficientList numerator = fractions[i].numerator.GetCoefficients();
+        CoefficientList rebuiltDenominator = rebuilt.denominator.GetCoefficients();
+        CoefficientList rebuiltNumerator = rebuilt.numerator.GetCoefficients();
+        ASSERT_EQ(rebuiltDenominator.size(), denominator.size());
+        ASSERT_EQ(rebuiltNumerator.size(), numerator.size());
+        for(size_t k = 0; k < denominator.size(); k++)
+        {
+            EXPECT_NEAR(rebuiltDenominator[k], denominator[k] / denominator[0], 1E-13);
+        }
+        for(size_t k = 0; k < numerator.size(); k++)
+        {
+            EXPECT_NEAR(rebuiltNumerator[k], numerator[k] / denominator[0], 1E-13);
+        }
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        PartialFraction::Expand(PolynomialFraction{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial() });
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PartialFractionTests, Method_GetImpulseResponse_TransferFunctionsAreExpanded_ResponsesAreCorrect)
+{
+    // 1 / (s + 1)^2 -> t e^-t
+    PartialFractionExpansion expansion = PartialFraction::Expand(PolynomialFraction{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial(CoefficientList{1, 2, 1}) });
+    for(highprecision t : {0.0L, 0.5L, 1.0L, 4.0L})
+    {
+        EXPECT_NEAR(PartialFraction::GetImpulseResponse(expansion, t), t * std::exp(-t), 1E-15);
+    }
+    EXPECT_EQ(PartialFraction::GetImpulseResponse(expansion, -1), 0);
+
+    // 1 / (s^2 + 2 s + 5) -> e^-t sin(2 t) / 2
+    expansion = PartialFraction::Expand(PolynomialFraction{ .numerator = Polynomial(CoefficientList{1}), .denominator = Polynomial(CoefficientList{1, 2, 5}) });
+    for(highprecision t : {0.0L, 0.3L, 1.0L, 2.5L})
+    {
+        EXPECT_NEAR(PartialFraction::GetImpulseResponse(expansion, t), std::exp(-t) * std::sin(2 * t) / 2, 1E-15);
+    }
+}
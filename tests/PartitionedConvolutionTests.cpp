@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/partitionedconvolution.hpp"
+#include "../application/headers/fastfouriertransform.hpp"
+#include "../application/headers/firdesign.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+TEST(PartitionedConvolutionTests, Method_Process_SignalComesInChunks_OutputIsDelayedConvolution)
+{
+    std::vector<highprecision> taps;
+    for(int k = 0; k < 1000; k++)
+    {
+        taps.push_back(std::exp(-0.004L * k) * std::sin(0.37L * k + 0.1L));
+    }
+    std::vector<highprecision> signal = GetTestSignal(3000, 0);
+    std::vector<highprecision> expected = FastFourierTransform<highprecision>::Convolve(taps, signal);
+
+    PartitionedConvolution convolution(taps, 64);
+    EXPECT_EQ(convolution.GetPartitionCount(), 16);
+    EXPECT_EQ(convolution.GetLatency(), 64);
+
+    // Chunks which do not align with the blocks
+    std::vector<highprecision> output;
+    for(size_t start = 0, chunk = 1; start < signal.size(); start += chunk, chunk = chunk * 3 % 101 + 1)
+    {
+        size_t end = std::min(signal.size(), start + chunk);
+        std::vector<highprecision> part = convolution.Process(std::vector<highprecision>(signal.begin() + start, signal.begin() + end));
+        ASSERT_EQ(part.size(), end - start);
+        output.insert(output.end(), part.begin(), part.end());
+    }
+    ASSERT_EQ(output.size(), signal.size());
+    for(size_t n = 0; n < output.size(); n++)
+    {
+        highprecision value = (n < 64) ? 0 : expected[n - 64];
+        EXPECT_NEAR(output[n], value, 1E-11);
+    }
+}
+
+TEST(PartitionedConvolutionTests, Ctor_PolynomialAndBlockSizes_OutputsMatchTaps)
+{
+    std::vector<highprecision> taps = FirDesign::WindowedSinc(101, 0, 0.1, WindowType::Hamming);
+    std::vector<highprecision> signal = GetTestSignal(700, 1);
+    std::vector<highprecision> expected = FastFourierTransform<highprecision>::Convolve(taps, signal);
+
+    // A single tap per block, blocks which do not fill the last partition and a single partition
+    for(size_t blockSize : {1, 32, 128, 512})
+    {
+        PartitionedConvolution convolution(FirDesign::ToPolynomial(taps), blockSize);
+        EXPECT_EQ(convolution.GetPartitionCount(), (taps.size() + blockSize - 1) / blockSize);
+        std::vector<highprecision> output = convolution.Process(signal);
+        for(size_t n = blockSize; n < output.size(); n++)
+        {
+            EXPECT_NEAR(output[n], expected[n - blockSize], 1E-12);
+        }
+    }
+}
+
+TEST(PartitionedConvolutionTests, Method_Process_ChannelsSharingTheKernel_EveryChannelIsFilteredOnItsOwn)
+{
+    std::vector<highprecision> taps = FirDesign::WindowedSinc(300, 0, 0.2, WindowType::Blackman);
+    PartitionedConvolution prototype(taps, 32);
+    std::vector<PartitionedConvolution> channels(4, prototype);
+    std::vector<std::vector<highprecision>> inputs;
+    for(int c = 0; c < 4; c++)
+    {
+        inputs.push_back(GetTestSignal(500, c));
+    }
+
+    TaskPool pool(3);
+    std::vector<std::vector<highprecision>> outputs = PartitionedConvolution::Process(channels, inputs, pool);
+    ASSERT_EQ(outputs.size(), 4);
+    for(int c = 0; c < 4; c++)
+    {
+        PartitionedConvolution single(taps, 32);
+        EXPECT_EQ(outputs[c], single.Process(inputs[c]));
+    }
+
+    // After a reset the stream starts at rest
+    channels[0].Reset();
+    EXPECT_EQ(channels[0].Process(inputs[0]), outputs[0]);
+}
+
+TEST(PartitionedConvolutionTests, Ctor_InvalidArguments_ExceptionsAreThrown)
+{
+    std::vector<std::pair<std::vector<highprecision>, size_t>> arguments
+    {
+        { {1, 2, 3}, 0 },
+        { {1, 2, 3}, 48 },
+        { {}, 64 }
+    };
+    for(const auto& [taps, blockSize] : arguments)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            PartitionedConvolution convolution(taps, blockSize);
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
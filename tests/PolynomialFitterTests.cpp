@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/polynomialfitter.hpp"
+
+using namespace Vath;
+
+TEST(PolynomialFitterTests, Method_Fit_SamplesOfPolynomialAreProvided_PolynomialIsRecovered)
+{
+    // 50 samples of 0.5x^3 - 2x^2 + x - 7 on [10, 20], far away from the origin
+    std::vector<highprecision> x, y;
+    for(int i = 0; i < 50; i++)
+    {
+        highprecision xi = 10 + i * 0.2;
+        x.push_back(xi);
+        y.push_back(0.5 * xi * xi * xi - 2 * xi * xi + xi - 7);
+    }
+    PolynomialFitter fitter(x, 3);
+    CoefficientList coefficients = fitter.Fit(y).GetCoefficients();
+    CoefficientList correctCoefficients{ 0.5, -2, 1, -7 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-8);
+    }
+}
+
+TEST(PolynomialFitterTests, Method_Fit_NoisyLineIsProvided_LeastSquaresLineIsCorrect)
+{
+    // y = 2x + 1 with residuals +1, -1, -1, +1: the residuals are orthogonal to 1 and x, so the fit is exactly 2x + 1
+    std::vector<highprecision> x{ 0, 1, 2, 3 };
+    std::vector<highprecision> y{ 2, 2, 4, 8 };
+    CoefficientList coefficients = Polynomial::Fit(x, y, 1).GetCoefficients();
+    ASSERT_EQ(coefficients.size(), 2);
+    EXPECT_NEAR(coefficients[0], 2, 1E-12);
+    EXPECT_NEAR(coefficients[1], 1, 1E-12);
+
+    // Too few distinct x values for the degree
+    bool exceptionWasThrown = false;
+    try
+    {
+        PolynomialFitter fitter(std::vector<highprecision>{ 1, 1, 2, 2 }, 2);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PolynomialFitterTests, Method_Fit_BatchIsProvided_ResultsMatchSingleFits)
+{
+    std::vector<highprecision> x;
+    for(int i = 0; i < 16; i++)
+    {
+        x.push_back(-1 + i * 0.125);
+    }
+    std::vector<std::vector<highprecision>> datasets;
+    for(int d = 0; d < 20; d++)
+    {
+        std::vector<highprecision> y;
+        for(highprecision xi : x)
+        {
+            y.push_back(std::sin(xi * (d + 1)));
+        }
+        datasets.push_back(y);
+    }
+
+    PolynomialFitter fitter(x, 4);
+    TaskPool pool(3);
+    std::vector<Polynomial> fits = fitter.Fit(datasets, pool);
+    ASSERT_EQ(fits.size(), datasets.size());
+    for(size_t d = 0; d < datasets.size(); d++)
+    {
+        CoefficientList batch = fits[d].GetCoefficients();
+        CoefficientList single = fitter.Fit(datasets[d]).GetCoefficients();
+        ASSERT_EQ(batch.size(), single.size());
+        for(size_t i = 0; i < batch.size(); i++)
+        {
+            EXPECT_EQ(batch[i], single[i]);
+        }
+    }
+}
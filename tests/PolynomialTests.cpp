@@ -2,6 +2,7 @@
 
 #include "../application/headers/polynomial.hpp"
 #include "../application/headers/monomial.hpp"
+#include "../application/headers/interval.hpp"
 
 using namespace Vath;
 
@@ -1001,4 +1002,418 @@ TEST(PolynomialTests, Method_DifferentiateRationalPolynomial_RationalFunctionsAr
     EXPECT_TRUE(testFracPrime.denominator == testFracCorrectPrime.denominator);
     EXPECT_TRUE(testFracPrimePrime.numerator == testFracCorrectPrimePrime.numerator);
     EXPECT_TRUE(testFracPrimePrime.denominator == testFracCorrectPrimePrime.denominator);
-}
\ No newline at end of file
+}
+
+TEST(PolynomialTests, Method_EvaluateAtInterval_PolynomialIsEvaluatedOnInterval_ResultEnclosesRange)
+{
+    Polynomial p(CoefficientList{1, -6, 11, -6}); // (x-1)(x-2)(x-3)
+    Interval x(0.5L, 3.5L);
+    Interval result = p.EvaluateAt(x);
+    for(highprecision t = x.Lower; t <= x.Upper; t += 0.01L)
+    {
+        EXPECT_TRUE(result.Contains(p.EvaluateAt(t)));
+    }
+
+    Interval point = Polynomial::EvaluateAt(p, Interval(4));
+    EXPECT_TRUE(point.Contains(6));
+    EXPECT_TRUE(point.GetWidth() < 1E-15);
+}
+
+TEST(PolynomialTests, Method_FindZeroEnclosures_ZerosAreProvided_EachEnclosureContainsOneZero)
+{
+    Polynomial p(CoefficientList{ 1, -3.53389, 0.494281, 6.53589, -4.49629 });
+    std::vector<highprecision> correctZeros{ -1.3665119637843479348L, 1.0000097535395593475L, 1.2339865056018066454L, 2.6664057046429819177L };
+
+    std::vector<Interval> enclosures = Polynomial::FindZeroEnclosures(p);
+    ASSERT_EQ(enclosures.size(), correctZeros.size());
+    for(size_t i = 0; i < enclosures.size(); i++)
+    {
+        EXPECT_TRUE(enclosures[i].Contains(correctZeros[i]));
+        EXPECT_TRUE(enclosures[i].GetWidth() < 1E-12);
+        if(i > 0)
+        {
+            EXPECT_TRUE(enclosures[i-1].Upper < enclosures[i].Lower);
+        }
+    }
+}
+
+TEST(PolynomialTests, Method_FindZeroEnclosures_ZerosOutsideOfGuessingIntervalAreProvided_ZerosAreFound)
+{
+    Polynomial p = Polynomial(CoefficientList{1, -1000}) * Polynomial(CoefficientList{1, 2000}) * Polynomial(CoefficientList{1, 0, 1});
+    std::vector<Interval> enclosures = Polynomial::FindZeroEnclosures(p);
+    ASSERT_EQ(enclosures.size(), 2);
+    EXPECT_TRUE(enclosures[0].Contains(-2000));
+    EXPECT_TRUE(enclosures[1].Contains(1000));
+}
+
+TEST(PolynomialTests, Method_FindZeroEnclosures_MultipleZeroIsProvided_ExceptionIsThrown)
+{
+    Polynomial p(CoefficientList{1, -2, 1});
+    bool exceptionWasThrown = false;
+    try
+    {
+        std::vector<Interval> enclosures = Polynomial::FindZeroEnclosures(p);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PolynomialTests, Method_DivideCoefficients_CoefficientsAreDivided_QuotientAndRemainderAreCorrect)
+{
+    // (2x^4 - 2x^2 + 3x - 1) / (2x^2 + 1) = x^2 - 1.5 with remainder 3x + 0.5
+    CoefficientList quotient, remainder;
+    Polynomial::DivideCoefficients(CoefficientList{2, 0, -2, 3, -1}, CoefficientList{2, 0, 1}, quotient, remainder);
+    EXPECT_EQ(quotient, (CoefficientList{1, 0, -1.5}));
+    EXPECT_EQ(remainder, (CoefficientList{3, 0.5}));
+
+    Polynomial::DivideCoefficients(CoefficientList{1, -3, 2}, CoefficientList{1, -1}, quotient, remainder);
+    EXPECT_EQ(quotient, (CoefficientList{1, -2}));
+    EXPECT_EQ(remainder, (CoefficientList{0}));
+}
+
+TEST(PolynomialTests, Method_GreatestCommonDivisor_PolynomialsWithCommonFactorAreProvided_ResultIsCorrect)
+{
+    // (x - 1)(x + 2) and (x - 1)(x - 5)
+    Polynomial gcd = Polynomial::GreatestCommonDivisor(Polynomial(CoefficientList{1, 1, -2}), Polynomial(CoefficientList{2, -12, 10}));
+    ASSERT_EQ(gcd.GetOrder(), 1);
+    EXPECT_NEAR(gcd[1].Coefficient, -1, 1E-15);
+
+    Polynomial coprime = Polynomial::GreatestCommonDivisor(Polynomial(CoefficientList{1, 0, 1}), Polynomial(CoefficientList{1, -3}));
+    EXPECT_EQ(coprime.GetOrder(), 0);
+}
+
+TEST(PolynomialTests, Method_SquareFreeFactorization_PolynomialWithMultipleZerosIsProvided_FactorsAreCorrect)
+{
+    // (x - 1)^4 * (x + 2)^2 * (x - 3)
+    Polynomial p =  Polynomial(CoefficientList{1, -4, 6, -4, 1}) * 
+                    Polynomial(CoefficientList{1, 4, 4}) * 
+                    Polynomial(CoefficientList{1, -3});
+    std::vector<SquareFreeFactor> factors = Polynomial::SquareFreeFactorization(p);
+    ASSERT_EQ(factors.size(), 3);
+    EXPECT_EQ(factors[0].multiplicity, 1);
+    EXPECT_NEAR(factors[0].factor.EvaluateAt(3), 0, 1E-12);
+    EXPECT_EQ(factors[1].multiplicity, 2);
+    EXPECT_NEAR(factors[1].factor.EvaluateAt(-2), 0, 1E-12);
+    EXPECT_EQ(factors[2].multiplicity, 4);
+    EXPECT_NEAR(factors[2].factor.EvaluateAt(1), 0, 1E-12);
+    for(const SquareFreeFactor& f : factors)
+    {
+        EXPECT_EQ(f.factor.GetOrder(), 1);
+    }
+}
+
+TEST(PolynomialTests, Method_FindZerosWithMultiplicity_PolynomialWithMultipleZerosIsProvided_ResultsAreCorrect)
+{
+    // (x - 1)^4 * (x + 0.5)^2 * (x^2 + 1)
+    Polynomial p =  Polynomial(CoefficientList{1, -4, 6, -4, 1}) * 
+                    Polynomial(CoefficientList{1, 1, 0.25}) * 
+                    Polynomial(CoefficientList{1, 0, 1});
+    std::vector<MultipleZero> zeros = Polynomial::FindZerosWithMultiplicity(p);
+    ASSERT_EQ(zeros.size(), 2);
+    EXPECT_NEAR(zeros[0].value, -0.5, 1E-12);
+    EXPECT_EQ(zeros[0].multiplicity, 2);
+    EXPECT_NEAR(zeros[1].value, 1, 1E-12);
+    EXPECT_EQ(zeros[1].multiplicity, 4);
+}
+
+TEST(PolynomialTests, Method_FindZeros_MultipleZerosAreProvided_ResultsAreCorrect)
+{
+    // (x - 1)^4 * (x - 2)
+    Polynomial p = Polynomial(CoefficientList{1, -4, 6, -4, 1}) * Polynomial(CoefficientList{1, -2});
+    std::vector<highprecision> zeros = Polynomial::FindZeros(p);
+    std::sort(zeros.begin(), zeros.end());
+    std::vector<highprecision> correctZeros{ 1, 1, 1, 1, 2 };
+    ASSERT_EQ(zeros.size(), correctZeros.size());
+    for(size_t i = 0; i < zeros.size(); i++)
+    {
+        EXPECT_NEAR(zeros[i], correctZeros[i], 1E-12);
+    }
+}
+
+TEST(PolynomialTests, Method_FindZeros_ClusteredZerosAreProvided_ZerosAreNotMerged)
+{
+    // (x - 1)(x - 1 - 1E-6)(x - 3), the tolerance of the gcd merges both zeros at 1 into a double one
+    Polynomial p =  Polynomial(CoefficientList{1, -1}) * 
+                    Polynomial(CoefficientList{1, -1 - 1E-6L}) * 
+                    Polynomial(CoefficientList{1, -3});
+    EXPECT_FALSE(Polynomial::VerifySquareFreeFactorization(p, Polynomial::SquareFreeFactorization(p)));
+
+    std::vector<highprecision> zeros = Polynomial::FindZeros(p);
+    std::sort(zeros.begin(), zeros.end());
+    std::vector<highprecision> correctZeros{ 1, 1 + 1E-6L, 3 };
+    ASSERT_EQ(zeros.size(), correctZeros.size());
+    for(size_t i = 0; i < zeros.size(); i++)
+    {
+        EXPECT_NEAR(zeros[i], correctZeros[i], 1E-12);
+    }
+
+    std::vector<MultipleZero> multipleZeros = Polynomial::FindZerosWithMultiplicity(p);
+    ASSERT_EQ(multipleZeros.size(), correctZeros.size());
+    for(size_t i = 0; i < multipleZeros.size(); i++)
+    {
+        EXPECT_NEAR(multipleZeros[i].value, correctZeros[i], 1E-12);
+        EXPECT_EQ(multipleZeros[i].multiplicity, 1);
+    }
+
+    // A true double zero passes the check
+    Polynomial q = Polynomial(CoefficientList{1, -2, 1}) * Polynomial(CoefficientList{1, -3});
+    EXPECT_TRUE(Polynomial::VerifySquareFreeFactorization(q, Polynomial::SquareFreeFactorization(q)));
+}
+
+TEST(PolynomialTests, Method_Interpolate_PointsAreProvided_PolynomialPassesThroughPoints)
+{
+    // Points of 2x^3 - x + 4
+    std::vector<highprecision> x{ -2, -0.5, 1, 3 };
+    std::vector<highprecision> y;
+    for(highprecision xi : x)
+    {
+        y.push_back(2 * xi * xi * xi - xi + 4);
+    }
+    CoefficientList coefficients = Polynomial::Interpolate(x, y).GetCoefficients();
+    CoefficientList correctCoefficients{ 2, 0, -1, 4 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-12);
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        Polynomial::Interpolate(std::vector<highprecision>{ 1, 2, 1 }, std::vector<highprecision>{ 0, 1, 2 });
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PolynomialTests, Method_TaylorShift_PolynomialsAreShifted_ResultsAreCorrect)
+{
+    // (x + 1)^2 shifted by -1 is x^2
+    CoefficientList coefficients = Polynomial::TaylorShift(Polynomial(CoefficientList{1, 2, 1}), -1).GetCoefficients();
+    CoefficientList correctCoefficients{ 1, 0, 0 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-15);
+    }
+
+    // Above TAYLOR_SHIFT_FAST_MIN_ORDER divide and conquer is used, compare against the horner scheme
+    CoefficientList large;
+    for(int i = 0; i <= 150; i++)
+    {
+        large.push_back(std::cos(0.7L * i) / (1 + i));
+    }
+    CoefficientList shifted = Polynomial::TaylorShiftCoefficients(large, 0.25);
+    CoefficientList reference(large);
+    for(size_t i = 0; i + 1 < reference.size(); i++)
+    {
+        for(size_t j = 1; j < reference.size() - i; j++)
+        {
+            reference[j] += 0.25L * reference[j - 1];
+        }
+    }
+    highprecision maxCoefficient = 0;
+    for(highprecision c : reference)
+    {
+        maxCoefficient = std::max(maxCoefficient, std::abs(c));
+    }
+    ASSERT_EQ(shifted.size(), reference.size());
+    for(size_t i = 0; i < shifted.size(); i++)
+    {
+        EXPECT_NEAR(shifted[i], reference[i], 1E-15 * maxCoefficient);
+    }
+}
+
+TEST(PolynomialTests, Method_Compose_PolynomialsAreComposed_ResultsAreCorrect)
+{
+    // p(2x - 1) for p = x^2 + 1 is 4x^2 - 4x + 2
+    Polynomial p(CoefficientList{1, 0, 1});
+    CoefficientList coefficients = Polynomial::Compose(p, Polynomial(CoefficientList{2, -1})).GetCoefficients();
+    CoefficientList correctCoefficients{ 4, -4, 2 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-15);
+    }
+
+    // p(3x) = 9x^2 + 1
+    coefficients = Polynomial::Scale(p, 3).GetCoefficients();
+    EXPECT_NEAR(coefficients[0], 9, 1E-15);
+    EXPECT_NEAR(coefficients[2], 1, 1E-15);
+
+    // Order 30 composed with order 3 by divide and conquer
+    CoefficientList outerCoefficients;
+    for(int i = 0; i <= 30; i++)
+    {
+        outerCoefficients.push_back(std::cos(1.1L * i));
+    }
+    Polynomial outer(outerCoefficients);
+    Polynomial inner(CoefficientList{0.5, 0, -0.3, 0.1});
+    Polynomial composition = Polynomial::Compose(outer, inner);
+    EXPECT_EQ(composition.GetOrder(), 90);
+    for(highprecision x : { -1.0L, -0.4L, 0.2L, 0.9L })
+    {
+        EXPECT_NEAR(composition.EvaluateAt(x), outer.EvaluateAt(inner.EvaluateAt(x)), 1E-12);
+    }
+}
+
+TEST(PolynomialTests, Method_FindComplexZeros_PolynomialsAreProvided_ZerosAreCorrect)
+{
+    typedef std::complex<highprecision> Complex;
+
+    // (x - 2)(x^2 + 2x + 5) x: zeros 2, -1 +- 2i and 0
+    std::vector<Complex> zeros = Polynomial::FindComplexZeros(Polynomial(CoefficientList{1, 0, 1, -10, 0}));
+    std::vector<Complex> correctZeros{ Complex(-1, -2), Complex(-1, 2), Complex(0, 0), Complex(2, 0) };
+    ASSERT_EQ(zeros.size(), correctZeros.size());
+    for(size_t i = 0; i < zeros.size(); i++)
+    {
+        EXPECT_NEAR(zeros[i].real(), correctZeros[i].real(), 1E-15);
+        EXPECT_NEAR(zeros[i].imag(), correctZeros[i].imag(), 1E-15);
+    }
+    // Conjugate pairs are exact, real zeros have no imaginary part at all
+    EXPECT_EQ(zeros[0], std::conj(zeros[1]));
+    EXPECT_EQ(zeros[3].imag(), 0);
+
+    // The roots of unity of order 25, rebuilt to the original polynomial
+    CoefficientList coefficients(26, 0);
+    coefficients[0] = 1;
+    coefficients[25] = -1;
+    zeros = Polynomial::FindComplexZeros(Polynomial(coefficients));
+    ASSERT_EQ(zeros.size(), 25);
+    for(const Complex& zero : zeros)
+    {
+        EXPECT_NEAR(std::abs(zero), 1, 1E-15);
+    }
+    CoefficientList rebuilt = Polynomial::FromZeros(zeros).GetCoefficients();
+    ASSERT_EQ(rebuilt.size(), coefficients.size());
+    for(size_t i = 0; i < rebuilt.size(); i++)
+    {
+        EXPECT_NEAR(rebuilt[i], coefficients[i], 1E-14);
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        Polynomial::FindComplexZeros(Polynomial(CoefficientList{0}));
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PolynomialTests, Method_FindComplexZeros_TripleZeroIsProvided_ZerosAreNotPairedUp)
+{
+    typedef std::complex<highprecision> Complex;
+
+    // (x - 1)^3 is found as a small cloud around 1, whose non-real members are no conjugates of each other and must
+    // not be averaged into a pair
+    std::vector<Complex> zeros = Polynomial::FindComplexZeros(Polynomial(CoefficientList{1, -3, 3, -1}));
+    ASSERT_EQ(zeros.size(), 3);
+    for(const Complex& zero : zeros)
+    {
+        EXPECT_NEAR(zero.real(), 1, 1E-6);
+        EXPECT_NEAR(zero.imag(), 0, 1E-6);
+    }
+    for(const Complex& upper : zeros)
+    {
+        for(const Complex& lower : zeros)
+        {
+            if(upper.imag() > 0 && lower.imag() < 0)
+            {
+                EXPECT_GT(std::abs(upper - std::conj(lower)), Polynomial::CONJUGATE_TOLERANCE);
+            }
+        }
+    }
+}
+
+TEST(PolynomialTests, Method_FindComplexZeros_BairstowMethod_ZerosMatchAberthMethod)
+{
+    typedef std::complex<highprecision> Complex;
+
+    // (x - 2)(x^2 + 2x + 5) x, the roots of unity of order 25 and a random polynomial of order 29
+    CoefficientList unity(26, 0);
+    unity[0] = 1;
+    unity[25] = -1;
+    CoefficientList random;
+    unsigned int seed = 7;
+    for(int i = 0; i < 30; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        random.push_back(((seed >> 8) % 2001) / 1000.0L - 1);
+    }
+    std::vector<Polynomial> polynomials{ Polynomial(CoefficientList{1, 0, 1, -10, 0}), Polynomial(unity), Polynomial(random) };
+    for(const Polynomial& p : polynomials)
+    {
+        std::vector<Complex> aberth = Polynomial::FindComplexZeros(p, ZeroFindingMethod::Aberth);
+        std::vector<Complex> bairstow = Polynomial::FindComplexZeros(p, ZeroFindingMethod::Bairstow);
+        ASSERT_EQ(bairstow.size(), aberth.size());
+        for(size_t i = 0; i < aberth.size(); i++)
+        {
+            EXPECT_NEAR(bairstow[i].real(), aberth[i].real(), 1E-15);
+            EXPECT_NEAR(bairstow[i].imag(), aberth[i].imag(), 1E-15);
+        }
+    }
+
+    // The factors multiply to the polynomial
+    Polynomial p(random);
+    RealFactorization factorization = Polynomial::FindQuadraticFactors(p);
+    EXPECT_EQ(2 * factorization.quadraticFactors.size() + factorization.realZeros.size(), 29);
+    Polynomial product(CoefficientList{factorization.gain});
+    for(const QuadraticFactor& factor : factorization.quadraticFactors)
+    {
+        product = product * Polynomial(CoefficientList{1, factor.linearCoefficient, factor.constantCoefficient});
+    }
+    for(highprecision zero : factorization.realZeros)
+    {
+        product = product * Polynomial(CoefficientList{1, -zero});
+    }
+    CoefficientList rebuilt = product.GetCoefficients();
+    ASSERT_EQ(rebuilt.size(), random.size());
+    for(size_t i = 0; i < rebuilt.size(); i++)
+    {
+        EXPECT_NEAR(rebuilt[i], random[i], 1E-15);
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        Polynomial::FindQuadraticFactors(Polynomial(CoefficientList{0}));
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(PolynomialTests, Method_EstimateZeroMagnitudes_SeparatedAndEqualMagnitudes_EstimatesAreClose)
+{
+    typedef std::complex<highprecision> Complex;
+
+    // Zeros 0, 0.01, -1 +- 2i (magnitude sqrt 5), 40 and -300
+    Polynomial p = Polynomial::FromZeros({Complex(0, 0), Complex(0.01, 0), Complex(-1, 2), Complex(-1, -2), Complex(40, 0), Complex(-300, 0)}, 3);
+    std::vector<highprecision> correctMagnitudes{0, 0.01, std::sqrt(5.0L), std::sqrt(5.0L), 40, 300};
+    std::vector<highprecision> magnitudes = Polynomial::EstimateZeroMagnitudes(p);
+    ASSERT_EQ(magnitudes.size(), correctMagnitudes.size());
+    EXPECT_EQ(magnitudes[0], 0);
+    for(size_t i = 1; i < magnitudes.size(); i++)
+    {
+        EXPECT_NEAR(magnitudes[i] / correctMagnitudes[i], 1, 0.05);
+    }
+
+    // More squarings sharpen the estimates of close magnitudes
+    Polynomial close = Polynomial::FromZeros({Complex(1, 0), Complex(-1.5, 0), Complex(2, 0)});
+    std::vector<highprecision> coarse = Polynomial::EstimateZeroMagnitudes(close, 2);
+    std::vector<highprecision> fine = Polynomial::EstimateZeroMagnitudes(close, 10);
+    EXPECT_LT(std::abs(fine[1] - 1.5), std::abs(coarse[1] - 1.5));
+    EXPECT_NEAR(fine[0], 1, 1E-10);
+    EXPECT_NEAR(fine[2], 2, 1E-10);
+}
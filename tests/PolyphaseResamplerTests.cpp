@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/polyphaseresampler.hpp"
+#include "../application/headers/firdesign.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+// Upsamples by L, filters at the high rate and keeps every M-th sample
+static std::vector<highprecision> ResampleDirectly(const std::vector<highprecision>& taps, const std::vector<highprecision>& x, size_t L, size_t M)
+{
+    std::vector<highprecision> upsampled(x.size() * L, 0);
+    for(size_t n = 0; n < x.size(); n++)
+    {
+        upsampled[n * L] = L * x[n];
+    }
+    std::vector<highprecision> y;
+    for(size_t t = 0; t < upsampled.size(); t += M)
+    {
+        highprecision value = 0;
+        for(size_t k = 0; k < taps.size() && k <= t; k++)
+        {
+            value += taps[k] * upsampled[t - k];
+        }
+        y.push_back(value);
+    }
+    return y;
+}
+
+TEST(PolyphaseResamplerTests, Method_Process_DecimationAndInterpolation_OutputsMatchDirectFiltering)
+{
+    std::vector<highprecision> signal = GetTestSignal(600);
+
+    std::vector<highprecision> decimationTaps = FirDesign::WindowedSinc(61, 0, 0.5L / 3, WindowType::Blackman);
+    PolyphaseResampler decimator(FirDesign::ToPolynomial(decimationTaps), 1, 3);
+    EXPECT_EQ(decimator.GetTapsPerPhase(), 61);
+    std::vector<highprecision> expected = ResampleDirectly(decimationTaps, signal, 1, 3);
+    std::vector<highprecision> output = decimator.Process(signal);
+    ASSERT_EQ(output.size(), 200);
+    for(size_t m = 0; m < output.size(); m++)
+    {
+        EXPECT_NEAR(output[m], expected[m], 1E-13);
+    }
+
+    std::vector<highprecision> interpolationTaps = FirDesign::WindowedSinc(63, 0, 0.5L / 4, WindowType::Hamming);
+    PolyphaseResampler interpolator(interpolationTaps, 4, 1);
+    EXPECT_EQ(interpolator.GetTapsPerPhase(), 16);
+    expected = ResampleDirectly(interpolationTaps, signal, 4, 1);
+    output = interpolator.Process(signal);
+    ASSERT_EQ(output.size(), 2400);
+    for(size_t m = 0; m < output.size(); m++)
+    {
+        EXPECT_NEAR(output[m], expected[m], 1E-13);
+    }
+}
+
+TEST(PolyphaseResamplerTests, Method_Process_RationalFactorInChunks_OutputsMatchDirectResampling)
+{
+    std::vector<highprecision> taps = FirDesign::WindowedSinc(97, 0, 0.5L / 3, WindowType::Kaiser, FirDesign::GetKaiserBeta(70));
+    std::vector<highprecision> signal = GetTestSignal(1000);
+    std::vector<highprecision> expected = ResampleDirectly(taps, signal, 3, 2);
+
+    PolyphaseResampler resampler(taps, 3, 2);
+    std::vector<highprecision> output;
+    for(size_t start = 0, chunk = 1; start < signal.size(); start += chunk, chunk = chunk * 7 % 37 + 1)
+    {
+        size_t end = std::min(signal.size(), start + chunk);
+        std::vector<highprecision> part = resampler.Process(std::vector<highprecision>(signal.begin() + start, signal.begin() + end));
+        output.insert(output.end(), part.begin(), part.end());
+    }
+    ASSERT_EQ(output.size(), 1500);
+    for(size_t m = 0; m < output.size(); m++)
+    {
+        EXPECT_NEAR(output[m], expected[m], 1E-13);
+    }
+
+    // Both frequencies pass with unit gain, delayed by 48 samples of the high rate
+    for(size_t m = 200; m < output.size(); m += 97)
+    {
+        highprecision t = (2.0L * m - 48) / 3;
+        EXPECT_NEAR(output[m], 0.4L * std::sin(0.07L * t) + 0.3L * std::cos(0.9L * t + 0.2L), 1E-3);
+    }
+
+    resampler.Reset();
+    std::vector<highprecision> restarted = resampler.Process(signal);
+    ASSERT_EQ(restarted.size(), output.size());
+    for(size_t m = 0; m < output.size(); m++)
+    {
+        EXPECT_NEAR(restarted[m], output[m], 1E-15);
+    }
+}
+
+TEST(PolyphaseResamplerTests, Ctor_InvalidArguments_ExceptionsAreThrown)
+{
+    std::vector<std::tuple<std::vector<highprecision>, size_t, size_t>> arguments
+    {
+        { {1, 2, 3}, 0, 1 },
+        { {1, 2, 3}, 2, 0 },
+        { {}, 2, 3 }
+    };
+    for(const auto& [taps, interpolation, decimation] : arguments)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            PolyphaseResampler resampler(taps, interpolation, decimation);
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/powerseries.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/discretization.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+static std::vector<highprecision> GetTestCoefficients(size_t length, highprecision constant)
+{
+    std::vector<highprecision> coefficients{constant};
+    for(size_t k = 1; k < length; k++)
+    {
+        coefficients.push_back(std::sin(0.7L * k) / (k * k));
+    }
+    return coefficients;
+}
+
+TEST(PowerSeriesTests, Method_Inverse_LongSeries_ProductIsOne)
+{
+    PowerSeries geometric = PowerSeries(Polynomial(CoefficientList{-1, 1}), 10).Inverse();
+    for(size_t k = 0; k < 10; k++)
+    {
+        EXPECT_NEAR(geometric.GetCoefficient(k), 1, 1E-18);
+    }
+
+    // Long enough for the FFT products
+    PowerSeries f(GetTestCoefficients(300, 1.5), 300);
+    PowerSeries product = f * f.Inverse();
+    ASSERT_EQ(product.GetPrecision(), 300);
+    EXPECT_NEAR(product.GetCoefficient(0), 1, 1E-17);
+    for(size_t k = 1; k < 300; k++)
+    {
+        EXPECT_NEAR(product.GetCoefficient(k), 0, 1E-15);
+    }
+
+    PowerSeries g(GetTestCoefficients(120, -0.5), 200);
+    PowerSeries quotient = g / f;
+    EXPECT_EQ(quotient.GetPrecision(), 200);
+    PowerSeries restored = quotient * f;
+    for(size_t k = 0; k < 200; k++)
+    {
+        EXPECT_NEAR(restored.GetCoefficient(k), g.GetCoefficient(k), 1E-15);
+    }
+}
+
+TEST(PowerSeriesTests, Method_ExpLogSqrt_KnownSeries_CoefficientsMatch)
+{
+    // exp x = sum x^k / k!, log(1 + x) = sum (-1)^(k+1) x^k / k, sqrt(1 + x) = sum binom(1/2, k) x^k
+    PowerSeries x(std::vector<highprecision>{0, 1}, 40);
+    PowerSeries one(std::vector<highprecision>{1}, 40);
+    PowerSeries exponential = x.Exp();
+    PowerSeries logarithm = (one + x).Log();
+    PowerSeries root = (one + x).Sqrt();
+    highprecision factorial = 1, binomial = 1;
+    for(size_t k = 0; k < 40; k++)
+    {
+        factorial *= (k > 0) ? k : 1;
+        EXPECT_NEAR(exponential.GetCoefficient(k), 1 / factorial, 1E-17);
+        EXPECT_NEAR(logarithm.GetCoefficient(k), (k == 0) ? 0 : ((k % 2 == 1) ? 1.0L : -1.0L) / k, 1E-17);
+        EXPECT_NEAR(root.GetCoefficient(k), binomial, 1E-17);
+        binomial *= (0.5L - k) / (k + 1);
+    }
+
+    // Round trips on a long series with a constant term other than 1
+    PowerSeries f(GetTestCoefficients(150, 2), 150);
+    PowerSeries logExp = f.Log().Exp();
+    PowerSeries squared = f.Sqrt() * f.Sqrt();
+    PowerSeries derivative = f.Integral().Derivative();
+    for(size_t k = 0; k < 150; k++)
+    {
+        EXPECT_NEAR(logExp.GetCoefficient(k), f.GetCoefficient(k), 1E-15);
+        EXPECT_NEAR(squared.GetCoefficient(k), f.GetCoefficient(k), 1E-15);
+        EXPECT_NEAR(derivative.GetCoefficient(k), f.GetCoefficient(k), 1E-18);
+    }
+    EXPECT_NEAR((f.InverseSqrt() * f.Sqrt()).GetCoefficient(0), 1, 1E-18);
+}
+
+TEST(PowerSeriesTests, Method_GetImpulseResponse_FilterIsDivided_SamplesMatchRecursion)
+{
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::ChebyshevI, 7, 0.5), 6);
+    const size_t length = 1000;
+    std::vector<highprecision> response = PowerSeries::GetImpulseResponse(h, length);
+    ASSERT_EQ(response.size(), length);
+
+    std::vector<highprecision> expected = GetImpulseResponse(h, length);
+    // 1 / A peaks around 3.5E5 for these poles close to the unit circle, which the product with B has to cancel
+    for(size_t n = 0; n < length; n++)
+    {
+        EXPECT_NEAR(response[n], expected[n], 1E-12);
+    }
+
+    // A strictly proper filter starts with zeros
+    PolynomialFraction delayed{ .numerator = Polynomial(CoefficientList{2}), .denominator = Polynomial(CoefficientList{1, -0.5, 0}) };
+    std::vector<highprecision> delayedResponse = PowerSeries::GetImpulseResponse(delayed, 6);
+    std::vector<highprecision> expectedDelayed{0, 0, 2, 1, 0.5, 0.25};
+    EXPECT_EQ(delayedResponse, expectedDelayed);
+}
+
+TEST(PowerSeriesTests, Method_Inverse_DenominatorWithPolesCloseToUnitCircle_TermByTermInversionIsAccurate)
+{
+    // 1 / A of a Chebyshev lowpass peaks around 3.5E5. The term by term inversion is the recursion itself, the newton
+    // iteration loses all digits to its error amplification. An x^40 term of 1E-300 does not change the inverse, but
+    // takes the series above DIRECT_INVERSION_MAX_ORDER.
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::ChebyshevI, 7, 0.5), 6);
+    const size_t length = 1000;
+    CoefficientList a = h.denominator.GetCoefficients();
+    std::vector<highprecision> denominator(a.begin(), a.end());
+    CoefficientList one(a.size(), 0);
+    one[0] = 1;
+    std::vector<highprecision> expected = GetImpulseResponse(PolynomialFraction{ .numerator = Polynomial(one), .denominator = h.denominator }, length);
+    std::vector<highprecision> perturbed(denominator);
+    perturbed.resize(41, 0);
+    perturbed[40] = 1E-300L;
+
+    PowerSeries direct = PowerSeries(denominator, length).Inverse();
+    PowerSeries newton = PowerSeries(perturbed, length).Inverse();
+    highprecision maximum = 0, directError = 0, newtonError = 0;
+    for(size_t n = 0; n < length; n++)
+    {
+        maximum = std::max(maximum, std::abs(expected[n]));
+        directError = std::max(directError, std::abs(direct.GetCoefficient(n) - expected[n]));
+        newtonError = std::max(newtonError, std::abs(newton.GetCoefficient(n) - expected[n]));
+    }
+    EXPECT_LT(directError, 1E-15 * maximum);
+    EXPECT_GT(newtonError, 1E-6 * maximum);
+}
+
+TEST(PowerSeriesTests, Method_Inverse_InvalidSeries_ExceptionsAreThrown)
+{
+    PowerSeries zeroConstant(std::vector<highprecision>{0, 1}, 8);
+    PowerSeries negativeConstant(std::vector<highprecision>{-1, 1}, 8);
+    std::vector<std::function<void()>> calls
+    {
+        [&](){ zeroConstant.Inverse(); },
+        [&](){ zeroConstant.Log(); },
+        [&](){ negativeConstant.Sqrt(); },
+        [](){ PowerSeries empty(std::vector<highprecision>{1}, 0); },
+        [](){ PowerSeries::GetImpulseResponse(PolynomialFraction{ .numerator = Polynomial(CoefficientList{1, 0, 0}), .denominator = Polynomial(CoefficientList{1, 0.5}) }, 4); }
+    };
+    for(const std::function<void()>& call : calls)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            call();
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/interval.hpp"
+#include "../application/headers/realrootisolator.hpp"
+#include "../application/headers/sturmsequence.hpp"
+
+using namespace Vath;
+
+// Coefficients uniformly distributed in [-1, 1], the zeros of such polynomials cluster around the unit circle
+static Polynomial GetRandomPolynomial(int order, unsigned int seed)
+{
+    CoefficientList coefficients;
+    for(int i = 0; i <= order; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        coefficients.push_back(((seed >> 8) % 2001) / 1000.0L - 1);
+    }
+    coefficients[0] = 1;
+    return Polynomial(coefficients);
+}
+
+TEST(RealRootIsolatorTests, Method_CountSignVariations_CoefficientsAreProvided_ResultIsCorrect)
+{
+    EXPECT_EQ(RealRootIsolator::CountSignVariations(std::vector<highprecision>{1, -6, 11, -6}), 3);
+    EXPECT_EQ(RealRootIsolator::CountSignVariations(std::vector<highprecision>{1, 0, 0, 1}), 0);
+    EXPECT_EQ(RealRootIsolator::CountSignVariations(std::vector<highprecision>{1, 0, -3, 0, 2}), 2);
+}
+
+TEST(RealRootIsolatorTests, Method_Isolate_ZerosAreProvided_EachIntervalContainsOneZero)
+{
+    RealRootIsolator isolator(2);
+    Polynomial p(CoefficientList{ 1, -3.53389, 0.494281, 6.53589, -4.49629 });
+    std::vector<highprecision> correctZeros{ -1.366511963784348360, 1.000009753539556900, 1.233986505601812222, 2.666405704642979657 };
+
+    std::vector<Interval> isolated = isolator.Isolate(p);
+    ASSERT_EQ(isolated.size(), correctZeros.size());
+    for(size_t i = 0; i < isolated.size(); i++)
+    {
+        EXPECT_TRUE(isolated[i].Contains(correctZeros[i]));
+    }
+}
+
+TEST(RealRootIsolatorTests, Method_Isolate_ZerosOnSplitPointsAreProvided_IntervalsAreDisjoint)
+{
+    // 0.5 and 1 are hit exactly by the bisection, 0 is split off at the start. Their neighbours must not reach
+    // them, since a closed interval [a, b] with an exact zero on a boundary would contain two zeros.
+    std::vector<std::vector<highprecision>> zerosToIsolate{ {0.25, 0.5, 1, 2}, {-1, 0, 1, 3}, {-2, -1, -0.5, 0.5, 1, 2} };
+    for(unsigned int numberOfThreads : {0u, 2u})
+    {
+        RealRootIsolator isolator(numberOfThreads);
+        for(const std::vector<highprecision>& correctZeros : zerosToIsolate)
+        {
+            Polynomial p(CoefficientList{1});
+            for(highprecision zero : correctZeros)
+            {
+                p = p * Polynomial(CoefficientList{1, -zero});
+            }
+
+            std::vector<Interval> isolated = isolator.Isolate(p);
+            ASSERT_EQ(isolated.size(), correctZeros.size());
+            for(size_t i = 0; i < isolated.size(); i++)
+            {
+                EXPECT_TRUE(isolated[i].Contains(correctZeros[i]));
+                if(i > 0)
+                {
+                    EXPECT_TRUE(isolated[i - 1].Upper < isolated[i].Lower);
+                }
+            }
+        }
+    }
+}
+
+TEST(RealRootIsolatorTests, Method_FindZeros_ZerosOutsideOfGuessingIntervalAreProvided_ResultsAreCorrect)
+{
+    RealRootIsolator isolator;
+    Polynomial p =  Polynomial(CoefficientList{1, 5000}) * 
+                    Polynomial(CoefficientList{1, -0.001}) * 
+                    Polynomial(CoefficientList{1, 0}) * 
+                    Polynomial(CoefficientList{1, -3}) * 
+                    Polynomial(CoefficientList{1, 0, 1}) * 
+                    Polynomial(CoefficientList{1, -700});
+    std::vector<highprecision> correctZeros{ -5000, 0, 0.001, 3, 700 };
+
+    std::vector<highprecision> zeros = isolator.FindZeros(p);
+    ASSERT_EQ(zeros.size(), correctZeros.size());
+    for(size_t i = 0; i < zeros.size(); i++)
+    {
+        EXPECT_NEAR(zeros[i], correctZeros[i], 1E-12 * std::max((highprecision)1, std::abs(correctZeros[i])));
+    }
+}
+
+TEST(RealRootIsolatorTests, Method_FindZeros_HighOrderPolynomialIsProvided_AllZerosAreFound)
+{
+    // Product of (x - k/4) for k = -10..10 except 0, plus x^2 + 2 which has no real zeros
+    RealRootIsolator isolator(4);
+    Polynomial p(CoefficientList{1, 0, 2});
+    std::vector<highprecision> correctZeros;
+    for(int k = -10; k <= 10; k++)
+    {
+        if(k == 0)
+        {
+            continue;
+        }
+        p = p * Polynomial(CoefficientList{1, -k / 4.0L});
+        correctZeros.push_back(k / 4.0L);
+    }
+
+    std::vector<highprecision> zeros = isolator.FindZeros(p);
+    ASSERT_EQ(zeros.size(), correctZeros.size());
+    for(size_t i = 0; i < zeros.size(); i++)
+    {
+        EXPECT_NEAR(zeros[i], correctZeros[i], 1E-9);
+    }
+}
+
+TEST(RealRootIsolatorTests, Method_Isolate_RandomHighOrderPolynomialsAreProvided_IntervalsMatchSturmSequence)
+{
+    // From order 64 on, the taylor shifts are long enough for their rounding errors to fake zeros on split points
+    RealRootIsolator isolator(2);
+    for(int order : {64, 100, 150, 200})
+    {
+        for(unsigned int seed = 1; seed <= 4; seed++)
+        {
+            Polynomial p = GetRandomPolynomial(order, seed);
+            SturmSequence sturm(p);
+
+            std::vector<Interval> isolated = isolator.Isolate(p);
+            ASSERT_EQ(isolated.size(), sturm.CountZeros());
+            for(const Interval& i : isolated)
+            {
+                if(i.Lower == i.Upper)
+                {
+                    EXPECT_TRUE(p.EvaluateAt(i).Contains(0));
+                }
+                else
+                {
+                    EXPECT_EQ(sturm.CountZeros(i), 1);
+                }
+            }
+        }
+    }
+}
+
+TEST(RealRootIsolatorTests, Method_FindZeros_RandomHighOrderPolynomialsWithZerosNextToOne_AllZerosAreFound)
+{
+    // The zeros next to 1 and -1 lie right beside the first split points
+    RealRootIsolator isolator(2);
+    std::vector<highprecision> closeZeros{ -1 - 1E-7L, 1 - 1E-6L, 1 + 1E-6L };
+    for(int order : {64, 128})
+    {
+        Polynomial p = GetRandomPolynomial(order, 5);
+        for(highprecision zero : closeZeros)
+        {
+            p = p * Polynomial(CoefficientList{1, -zero});
+        }
+        SturmSequence sturm(p);
+
+        std::vector<highprecision> zeros = isolator.FindZeros(p);
+        ASSERT_EQ(zeros.size(), sturm.CountZeros());
+        for(highprecision zero : closeZeros)
+        {
+            auto closest = std::min_element(zeros.begin(), zeros.end(), [zero](highprecision a, highprecision b){ return std::abs(a - zero) < std::abs(b - zero); });
+            EXPECT_NEAR(*closest, zero, 1E-10);
+        }
+    }
+}
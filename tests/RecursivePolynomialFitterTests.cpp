@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/polynomialfitter.hpp"
+#include "../application/headers/recursivepolynomialfitter.hpp"
+
+using namespace Vath;
+
+TEST(RecursivePolynomialFitterTests, Method_Add_SamplesOfPolynomialAreProvided_PolynomialIsRecovered)
+{
+    RecursivePolynomialFitter fitter(2);
+    EXPECT_FALSE(fitter.IsDetermined());
+
+    // 3x^2 - x + 2
+    for(int i = 0; i < 30; i++)
+    {
+        highprecision x = -1.5 + i * 0.1;
+        fitter.Add(x, 3 * x * x - x + 2);
+        if(i == 1)
+        {
+            EXPECT_FALSE(fitter.IsDetermined());
+        }
+    }
+    EXPECT_TRUE(fitter.IsDetermined());
+    EXPECT_EQ(fitter.Count(), 30);
+    EXPECT_NEAR(fitter.GetResidualSumOfSquares(), 0, 1E-20);
+
+    CoefficientList coefficients = fitter.GetPolynomial().GetCoefficients();
+    CoefficientList correctCoefficients{ 3, -1, 2 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-12);
+    }
+}
+
+TEST(RecursivePolynomialFitterTests, Method_Add_WindowIsFull_FitMatchesBatchFitOfWindow)
+{
+    const size_t windowSize = 12;
+    RecursivePolynomialFitter fitter(2, 1, windowSize);
+    std::vector<highprecision> x, y;
+    for(int i = 0; i < 100; i++)
+    {
+        highprecision xi = -2 + i * 0.04;
+        highprecision yi = std::sin(3 * xi) + 0.1 * xi;
+        x.push_back(xi);
+        y.push_back(yi);
+        fitter.Add(xi, yi);
+    }
+    EXPECT_EQ(fitter.Count(), windowSize);
+
+    std::vector<highprecision> windowX(x.end() - windowSize, x.end());
+    std::vector<highprecision> windowY(y.end() - windowSize, y.end());
+    CoefficientList batch = Polynomial::Fit(windowX, windowY, 2).GetCoefficients();
+    CoefficientList streamed = fitter.GetPolynomial().GetCoefficients();
+    ASSERT_EQ(streamed.size(), batch.size());
+    for(size_t i = 0; i < batch.size(); i++)
+    {
+        EXPECT_NEAR(streamed[i], batch[i], 1E-9);
+    }
+}
+
+TEST(RecursivePolynomialFitterTests, Method_Add_ForgettingFactorIsProvided_FitFollowsDrift)
+{
+    // The line jumps from 2x + 1 to -x + 4, the fit has to forget the old samples
+    RecursivePolynomialFitter fitter(1, 0.5);
+    for(int i = 0; i < 50; i++)
+    {
+        highprecision x = (i % 10) * 0.1;
+        fitter.Add(x, 2 * x + 1);
+    }
+    for(int i = 0; i < 100; i++)
+    {
+        highprecision x = (i % 10) * 0.1;
+        fitter.Add(x, -x + 4);
+    }
+    CoefficientList coefficients = fitter.GetPolynomial().GetCoefficients();
+    EXPECT_NEAR(coefficients[0], -1, 1E-9);
+    EXPECT_NEAR(coefficients[1], 4, 1E-9);
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        RecursivePolynomialFitter invalid(1, 1.5);
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <numbers>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/secondordersections.hpp"
+#include "../application/headers/zeropolegain.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/discretization.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+typedef std::complex<highprecision> Complex;
+
+static Complex EvaluateFraction(const PolynomialFraction& h, Complex x)
+{
+    Complex numerator = 0, denominator = 0;
+    for(highprecision c : h.numerator.GetCoefficients())
+    {
+        numerator = numerator * x + c;
+    }
+    for(highprecision c : h.denominator.GetCoefficients())
+    {
+        denominator = denominator * x + c;
+    }
+    return numerator / denominator;
+}
+
+static Complex EvaluateSections(const std::vector<highprecision>& c, size_t count, Complex z)
+{
+    Complex value = 1, w = 1.0L / z;
+    for(size_t k = 0; k < count; k++)
+    {
+        const highprecision* s = &c[k * SecondOrderSections::COEFFICIENTS_PER_SECTION];
+        value *= (s[0] + w * (s[1] + w * s[2])) / (1.0L + w * (s[3] + w * s[4]));
+    }
+    return value;
+}
+
+TEST(SecondOrderSectionsTests, Ctor_EllipticFilterIsSplit_SectionsMatchTransferFunction)
+{
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Elliptic, 8, 0.5, 60), 1);
+    SecondOrderSections sos(h);
+    ASSERT_EQ(sos.Count(), 4);
+    std::vector<highprecision> c = sos.GetCoefficients();
+    ASSERT_EQ(c.size(), 4 * SecondOrderSections::COEFFICIENTS_PER_SECTION);
+
+    // Conjugate pole pairs with ascending radius (a2 = |p|^2)
+    for(size_t k = 1; k < sos.Count(); k++)
+    {
+        EXPECT_LT(c[(k - 1) * 5 + 4], c[k * 5 + 4]);
+    }
+    for(highprecision w : {0.0L, 0.3L, 0.9L, 1.0L, 2.0L, 3.0L})
+    {
+        Complex z = std::polar<highprecision>(1, w);
+        Complex expected = EvaluateFraction(h, z);
+        EXPECT_LT(std::abs(sos.EvaluateAt(z) - expected), 1E-12 * std::max<highprecision>(1E-3, std::abs(expected)));
+    }
+
+    PolynomialFraction rebuilt = sos.ToTransferFunction();
+    CoefficientList numerator = rebuilt.numerator.GetCoefficients();
+    CoefficientList denominator = rebuilt.denominator.GetCoefficients();
+    ASSERT_EQ(numerator.size(), 9);
+    ASSERT_EQ(denominator.size(), 9);
+    for(size_t i = 0; i < 9; i++)
+    {
+        EXPECT_NEAR(numerator[i], h.numerator.GetCoefficients()[i], 1E-13);
+        EXPECT_NEAR(denominator[i], h.denominator.GetCoefficients()[i], 1E-13);
+    }
+}
+
+TEST(SecondOrderSectionsTests, Method_Filter_OddAndStrictlyProperFilters_ImpulseResponsesMatch)
+{
+    std::vector<PolynomialFraction> filters
+    {
+        Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 5), 4),
+        Discretization::ImpulseInvariance(AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 3), 4)
+    };
+    std::vector<highprecision> impulse(64, 0);
+    impulse[0] = 1;
+    for(const PolynomialFraction& h : filters)
+    {
+        SecondOrderSections sos(h);
+        EXPECT_EQ(sos.Count(), (h.denominator.GetOrder() + 1) / 2);
+        std::vector<highprecision> expected = GetImpulseResponse(h, impulse.size());
+        std::vector<highprecision> response = sos.Filter(impulse);
+        ASSERT_EQ(response.size(), impulse.size());
+        for(size_t n = 0; n < impulse.size(); n++)
+        {
+            EXPECT_NEAR(response[n], expected[n], 1E-14);
+        }
+    }
+}
+
+TEST(SecondOrderSectionsTests, Ctor_SectionsAreScaled_PartialResponsesHaveUnitNorm)
+{
+    ZeroPoleGain filter = ZeroPoleGain::FromTransferFunction(Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::ChebyshevI, 6, 1), 3));
+    SecondOrderSections unscaled(filter);
+    SecondOrderSections lInfinity(filter, SectionScaling::LInfinity);
+    SecondOrderSections l2(filter, SectionScaling::L2);
+
+    for(highprecision w : {0.0L, 0.5L, 1.5L, 3.0L})
+    {
+        Complex z = std::polar<highprecision>(1, w);
+        Complex expected = unscaled.EvaluateAt(z);
+        EXPECT_LT(std::abs(lInfinity.EvaluateAt(z) - expected), 1E-13 * std::max<highprecision>(1, std::abs(expected)));
+        EXPECT_LT(std::abs(l2.EvaluateAt(z) - expected), 1E-13 * std::max<highprecision>(1, std::abs(expected)));
+    }
+
+    std::vector<highprecision> cInfinity = lInfinity.GetCoefficients();
+    std::vector<highprecision> c2 = l2.GetCoefficients();
+    for(size_t count = 1; count < lInfinity.Count(); count++)
+    {
+        highprecision maximum = 0, energy = 0;
+        const int points = 8192;
+        for(int i = 0; i < points; i++)
+        {
+            Complex z = std::polar<highprecision>(1, std::numbers::pi_v<highprecision> * (i + 0.5L) / points);
+            maximum = std::max(maximum, std::abs(EvaluateSections(cInfinity, count, z)));
+            energy += std::norm(EvaluateSections(c2, count, z)) / points;
+        }
+        EXPECT_NEAR(maximum, 1, 1E-3);
+        EXPECT_NEAR(std::sqrt(energy), 1, 1E-3);
+    }
+}
+
+TEST(SecondOrderSectionsTests, Ctor_InvalidFilters_ExceptionsAreThrown)
+{
+    std::vector<ZeroPoleGain> filters
+    {
+        ZeroPoleGain(std::vector<Complex>{1, -1}, std::vector<Complex>{0.5}, 1),
+        ZeroPoleGain(std::vector<Complex>{}, std::vector<Complex>{Complex(0.5, 0.5)}, 1)
+    };
+    for(const ZeroPoleGain& filter : filters)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            SecondOrderSections sos(filter);
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
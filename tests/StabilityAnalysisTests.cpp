@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/stabilityanalysis.hpp"
+
+using namespace Vath;
+
+TEST(StabilityAnalysisTests, Method_IsSchurStable_PolynomialsAreProvided_ResultsAreCorrect)
+{
+    // Zeros at 0.5 and -0.8
+    EXPECT_TRUE(StabilityAnalysis::IsSchurStable(Polynomial(CoefficientList{1, 0.3, -0.4})));
+    // Complex pair with radius 0.9: z^2 - 2*0.9*cos(1)z + 0.81
+    EXPECT_TRUE(StabilityAnalysis::IsSchurStable(Polynomial(CoefficientList{1, -1.8 * std::cos(1.0), 0.81})));
+    // Complex pair with radius 1.1
+    EXPECT_FALSE(StabilityAnalysis::IsSchurStable(Polynomial(CoefficientList{1, -2.2 * std::cos(1.0), 1.21})));
+    // Zero at 1.5 among stable ones
+    Polynomial unstable = Polynomial(CoefficientList{1, -1.5}) * Polynomial(CoefficientList{1, 0.3, -0.4});
+    EXPECT_FALSE(StabilityAnalysis::IsSchurStable(unstable));
+    // Zero on the unit circle
+    EXPECT_FALSE(StabilityAnalysis::IsSchurStable(Polynomial(CoefficientList{1, 0, 1})));
+
+    PolynomialFraction h
+    {
+        .numerator = Polynomial(CoefficientList{1, 1}),
+        .denominator = Polynomial(CoefficientList{2, -1})
+    };
+    EXPECT_TRUE(StabilityAnalysis::IsSchurStable(h));
+}
+
+TEST(StabilityAnalysisTests, Method_IsHurwitzStable_PolynomialsAreProvided_ResultsAreCorrect)
+{
+    // (s + 1)(s + 2)(s + 3)
+    EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{1, 6, 11, 6})));
+    // Same with a negative leading coefficient
+    EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{-1, -6, -11, -6})));
+    // s^3 + s^2 + 2s + 8: all coefficients positive but two zeros in the right half plane
+    EXPECT_FALSE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{1, 1, 2, 8})));
+    // s^2 + 1: zeros on the imaginary axis
+    EXPECT_FALSE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{1, 0, 1})));
+    // 5th order butterworth
+    EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{1, 3.2361, 5.2361, 5.2361, 3.2361, 1})));
+    // Constant
+    EXPECT_TRUE(StabilityAnalysis::IsHurwitzStable(Polynomial(CoefficientList{3})));
+}
+
+TEST(StabilityAnalysisTests, Method_IsSchurStableBatch_PolynomialsAreProvided_ResultsMatchSingleChecks)
+{
+    TaskPool pool(4);
+    std::vector<Polynomial> denominators;
+    for(int i = 0; i < 500; i++)
+    {
+        highprecision radius = 0.5 + i * 0.002;     // 0.5 ... 1.498
+        denominators.push_back(Polynomial(CoefficientList{1, -2 * radius * std::cos(0.3L), radius * radius}));
+    }
+
+    std::vector<bool> schur = StabilityAnalysis::IsSchurStable(denominators, pool);
+    std::vector<bool> hurwitz = StabilityAnalysis::IsHurwitzStable(denominators, pool);
+    ASSERT_EQ(schur.size(), denominators.size());
+    for(size_t i = 0; i < denominators.size(); i++)
+    {
+        highprecision radius = 0.5 + i * 0.002;
+        EXPECT_EQ(schur[i], radius < 0.9999);
+        EXPECT_FALSE(hurwitz[i]);   // Zeros have a positive real part
+    }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/statespace.hpp"
+#include "../application/headers/analogprototype.hpp"
+#include "../application/headers/discretization.hpp"
+#include "TestHelpers.hpp"
+
+using namespace Vath;
+
+TEST(StateSpaceTests, Method_FromTransferFunction_BothCanonicalForms_RoundTripAndImpulseResponsesMatch)
+{
+    PolynomialFraction h = Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::ChebyshevI, 6, 1), 5);
+    CoefficientList numerator = h.numerator.GetCoefficients();
+    CoefficientList denominator = h.denominator.GetCoefficients();
+    std::vector<highprecision> expected = GetImpulseResponse(h, 600);
+    std::vector<highprecision> impulse(600, 0);
+    impulse[0] = 1;
+
+    for(CanonicalForm form : {CanonicalForm::Controllable, CanonicalForm::Observable})
+    {
+        StateSpace system(h, form);
+        EXPECT_EQ(system.GetOrder(), 6);
+
+        PolynomialFraction rebuilt = StateSpace::ToTransferFunction(system.GetMatrices());
+        CoefficientList rebuiltNumerator = rebuilt.numerator.GetCoefficients();
+        CoefficientList rebuiltDenominator = rebuilt.denominator.GetCoefficients();
+        ASSERT_EQ(rebuiltNumerator.size(), numerator.size());
+        ASSERT_EQ(rebuiltDenominator.size(), denominator.size());
+        for(size_t i = 0; i < denominator.size(); i++)
+        {
+            EXPECT_NEAR(rebuiltNumerator[i], numerator[i] / denominator[0], 1E-15);
+            EXPECT_NEAR(rebuiltDenominator[i], denominator[i] / denominator[0], 1E-15);
+        }
+
+        // The runtime is double precision, the companion matrix of a sharp filter amplifies its rounding errors
+        std::vector<highprecision> response = system.Process(impulse);
+        ASSERT_EQ(response.size(), expected.size());
+        for(size_t n = 0; n < response.size(); n++)
+        {
+            EXPECT_NEAR(response[n], expected[n], 1E-9);
+        }
+    }
+}
+
+TEST(StateSpaceTests, Method_ToTransferFunction_MultipleInputsAndOutputs_ImpulseResponsesMatchRuntime)
+{
+    StateSpaceMatrices matrices{
+        .a = { {0.5, 0.2, -0.1}, {-0.3, 0.4, 0.25}, {0.1, -0.2, 0.6} },
+        .b = { {1, 0}, {0.5, -1}, {0, 2} },
+        .c = { {1, -1, 0.5}, {0, 0.3, 1} },
+        .d = { {0.1, 0}, {0, -0.4} }
+    };
+    StateSpace system(matrices);
+    EXPECT_EQ(system.GetInputCount(), 2);
+    EXPECT_EQ(system.GetOutputCount(), 2);
+
+    for(size_t input = 0; input < 2; input++)
+    {
+        std::vector<std::vector<highprecision>> impulses(2, std::vector<highprecision>(80, 0));
+        impulses[input][0] = 1;
+        system.Reset();
+        std::vector<std::vector<highprecision>> responses = system.Process(impulses);
+        ASSERT_EQ(responses.size(), 2);
+        for(size_t output = 0; output < 2; output++)
+        {
+            PolynomialFraction h = StateSpace::ToTransferFunction(matrices, output, input);
+            EXPECT_EQ(h.denominator.GetOrder(), 3);
+            std::vector<highprecision> expected = GetImpulseResponse(h, 80);
+            for(size_t n = 0; n < 80; n++)
+            {
+                EXPECT_NEAR(responses[output][n], expected[n], 1E-14);
+            }
+        }
+    }
+}
+
+TEST(StateSpaceTests, Method_Process_ChunksAcrossBlocks_StateIsCarriedOver)
+{
+    StateSpace system(Discretization::Bilinear(AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 12), 3));
+    std::vector<highprecision> signal;
+    for(size_t n = 0; n < 3 * StateSpace::BLOCK_SIZE + 17; n++)
+    {
+        signal.push_back(std::sin(0.1L * n) + 0.2L * std::cos(2.1L * n));
+    }
+    std::vector<highprecision> expected = system.Process(signal);
+
+    system.Reset();
+    std::vector<highprecision> output;
+    for(size_t start = 0, chunk = 5; start < signal.size(); start += chunk, chunk = chunk * 11 % 300 + 1)
+    {
+        size_t end = std::min(signal.size(), start + chunk);
+        std::vector<highprecision> part = system.Process(std::vector<highprecision>(signal.begin() + start, signal.begin() + end));
+        output.insert(output.end(), part.begin(), part.end());
+    }
+    ASSERT_EQ(output.size(), expected.size());
+    for(size_t n = 0; n < output.size(); n++)
+    {
+        EXPECT_NEAR(output[n], expected[n], 1E-15);
+    }
+
+    // Continuing from a saved state
+    system.Reset();
+    system.Process(std::vector<highprecision>(signal.begin(), signal.begin() + 100));
+    std::vector<highprecision> state = system.GetState();
+    system.Reset();
+    system.SetState(state);
+    std::vector<highprecision> continued = system.Process(std::vector<highprecision>(signal.begin() + 100, signal.end()));
+    for(size_t n = 0; n < continued.size(); n++)
+    {
+        EXPECT_NEAR(continued[n], expected[n + 100], 1E-15);
+    }
+}
+
+TEST(StateSpaceTests, Ctor_InvalidSystems_ExceptionsAreThrown)
+{
+    PolynomialFraction improper{ .numerator = Polynomial({1, 2, 3}), .denominator = Polynomial({1, 0.5}) };
+    StateSpaceMatrices mismatched{ .a = { {0.5} }, .b = { {1, 0} }, .c = { {1} }, .d = { {0} } };
+    std::vector<std::function<void()>> constructions
+    {
+        [&](){ StateSpace system(improper); },
+        [&](){ StateSpace system(mismatched); },
+        [&](){ StateSpace::ToTransferFunction(StateSpace::FromTransferFunction(PolynomialFraction{ .numerator = Polynomial(CoefficientList{2}), .denominator = Polynomial({1, 0.5}) }), 1, 0); }
+    };
+    for(const std::function<void()>& construction : constructions)
+    {
+        bool exceptionWasThrown = false;
+        try
+        {
+            construction();
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
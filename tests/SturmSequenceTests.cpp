@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/interval.hpp"
+#include "../application/headers/sturmsequence.hpp"
+
+using namespace Vath;
+
+TEST(SturmSequenceTests, Constructor_PolynomialIsProvided_ChainIsCorrect)
+{
+    // p = x^3 - 3x + 1: p' = 3x^2 - 3, -rem(p, p') = 2x - 1, -rem(p', 2x - 1) = 9/4
+    SturmSequence sturm(Polynomial(CoefficientList{1, 0, -3, 1}));
+    std::vector<Polynomial> chain = sturm.GetChain();
+    ASSERT_EQ(sturm.Count(), 4);
+    EXPECT_EQ(chain[1].GetOrder(), 2);
+    EXPECT_EQ(chain[2].GetOrder(), 1);
+    EXPECT_EQ(chain[3].GetOrder(), 0);
+    EXPECT_NEAR(chain[2][1].Coefficient / chain[2][0].Coefficient, -0.5, 1E-15);
+    EXPECT_TRUE(chain[3][0].Coefficient > 0);
+}
+
+TEST(SturmSequenceTests, Method_CountZeros_IntervalsAreProvided_ResultsAreCorrect)
+{
+    // Zeros at -3, -1, 0.5, 2 and a pair of complex ones
+    Polynomial p =  Polynomial(CoefficientList{1, 3}) * 
+                    Polynomial(CoefficientList{1, 1}) * 
+                    Polynomial(CoefficientList{1, -0.5}) * 
+                    Polynomial(CoefficientList{1, -2}) * 
+                    Polynomial(CoefficientList{1, 2, 5});
+    SturmSequence sturm(p);
+
+    EXPECT_EQ(sturm.CountZeros(), 4);
+    EXPECT_EQ(sturm.CountZeros(-10, 10), 4);
+    EXPECT_EQ(sturm.CountZeros(-2, 1), 2);
+    EXPECT_EQ(sturm.CountZeros(0.6, 1.9), 0);
+    EXPECT_EQ(sturm.CountZeros(Interval(-2.5, -0.5)), 1);
+
+    std::vector<int> counts = sturm.CountZeros(std::vector<Interval>{ Interval(-4, 0), Interval(0, 4), Interval(3, 4) });
+    EXPECT_EQ(counts, (std::vector<int>{ 2, 2, 0 }));
+}
+
+TEST(SturmSequenceTests, Method_CountZeros_MultipleZerosAreProvided_DistinctZerosAreCounted)
+{
+    // (x - 1)^3 * (x + 2)
+    Polynomial p =  Polynomial(CoefficientList{1, -3, 3, -1}) * Polynomial(CoefficientList{1, 2});
+    SturmSequence sturm(p);
+    EXPECT_EQ(sturm.CountZeros(), 2);
+    EXPECT_EQ(sturm.CountZeros(0, 5), 1);
+}
+
+TEST(SturmSequenceTests, Constructor_ZeroPolynomialIsProvided_ExceptionIsThrown)
+{
+    bool exceptionWasThrown = false;
+    try
+    {
+        SturmSequence sturm{Polynomial()};
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/subproducttree.hpp"
+
+using namespace Vath;
+
+TEST(SubproductTreeTests, Method_FromRoots_RootsAreProvided_PolynomialIsCorrect)
+{
+    // (x - 1)(x + 2)(x - 3) = x^3 - 2x^2 - 5x + 6
+    CoefficientList coefficients = SubproductTree::FromRoots(std::vector<highprecision>{ 1, -2, 3 }).GetCoefficients();
+    CoefficientList correctCoefficients{ 1, -2, -5, 6 };
+    ASSERT_EQ(coefficients.size(), correctCoefficients.size());
+    for(size_t i = 0; i < coefficients.size(); i++)
+    {
+        EXPECT_NEAR(coefficients[i], correctCoefficients[i], 1E-15);
+    }
+
+    // Many roots: the product has to vanish at every one of them
+    std::vector<highprecision> roots;
+    for(int i = 0; i < 100; i++)
+    {
+        roots.push_back(std::cos(0.37L * i));
+    }
+    Polynomial p = SubproductTree::FromRoots(roots);
+    EXPECT_EQ(p.GetOrder(), 100);
+    for(highprecision root : roots)
+    {
+        EXPECT_NEAR(p.EvaluateAt(root), 0, 1E-10);
+    }
+}
+
+TEST(SubproductTreeTests, Method_EvaluateAt_ManyPointsAreProvided_ValuesMatchHorner)
+{
+    std::vector<highprecision> points;
+    for(int i = 0; i < 200; i++)
+    {
+        points.push_back(-1 + i * 0.01L);
+    }
+    CoefficientList coefficients;
+    for(int i = 0; i <= 80; i++)
+    {
+        coefficients.push_back(std::sin(1.3L * i));
+    }
+    Polynomial p(coefficients);
+
+    SubproductTree tree(points);
+    std::vector<highprecision> values = tree.EvaluateAt(p);
+    ASSERT_EQ(values.size(), points.size());
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_NEAR(values[i], p.EvaluateAt(points[i]), 1E-8);
+    }
+
+    // The tree is reused for another polynomial of lower order
+    Polynomial q(CoefficientList{ 2, -1, 0.5 });
+    values = tree.EvaluateAt(q);
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_NEAR(values[i], q.EvaluateAt(points[i]), 1E-14);
+    }
+}
+
+TEST(SubproductTreeTests, Method_Interpolate_ValuesAreProvided_PolynomialPassesThroughPoints)
+{
+    std::vector<highprecision> points;
+    std::vector<highprecision> values;
+    for(int i = 0; i < 24; i++)
+    {
+        highprecision x = std::cos(3.14159265358979323846L * (i + 0.5L) / 24);
+        points.push_back(x);
+        values.push_back(1 / (1 + 4 * x * x));
+    }
+    SubproductTree tree(points);
+    Polynomial p = tree.Interpolate(values);
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_NEAR(p.EvaluateAt(points[i]), values[i], 1E-10);
+    }
+
+    bool exceptionWasThrown = false;
+    try
+    {
+        SubproductTree(std::vector<highprecision>{ 1, 2, 1 }).Interpolate(std::vector<highprecision>{ 0, 1, 2 });
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
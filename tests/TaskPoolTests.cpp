@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "../application/headers/taskpool.hpp"
+
+using namespace Vath;
+
+TEST(TaskPoolTests, Method_Submit_TasksSubmitFurtherTasks_AllTasksAreExecuted)
+{
+    TaskPool pool(4);
+    std::atomic<int> counter(0);
+    for(int i = 0; i < 100; i++)
+    {
+        pool.Submit([&pool, &counter]()
+        {
+            counter++;
+            pool.Submit([&counter](){ counter++; });
+        });
+    }
+    pool.WaitForAll();
+    EXPECT_EQ(counter.load(), 200);
+}
+
+TEST(TaskPoolTests, Method_WaitForAll_TaskThrows_ExceptionIsRethrown)
+{
+    for(unsigned int numberOfThreads : {0u, 2u})
+    {
+        TaskPool pool(numberOfThreads);
+        pool.Submit([](){ throw std::runtime_error("Task failed."); });
+        bool exceptionWasThrown = false;
+        try
+        {
+            pool.WaitForAll();
+        }
+        catch(...)
+        {
+            exceptionWasThrown = true;
+        }
+        EXPECT_TRUE(exceptionWasThrown);
+    }
+}
+
+TEST(TaskPoolTests, Method_ParallelFor_IndicesAreProvided_EveryIndexIsVisitedOnce)
+{
+    TaskPool pool(3);
+    std::vector<int> visits(1000, 0);
+    pool.ParallelFor(visits.size(), [&visits](size_t i){ visits[i]++; });
+    for(int v : visits)
+    {
+        EXPECT_EQ(v, 1);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef _TESTHELPERS_HPP_
+#define _TESTHELPERS_HPP_
+
+#include <cmath>
+#include <vector>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+
+/**
+ * \brief Computes the impulse response of a filter H(z) = B(z) / A(z) (positive powers of z) by its difference
+ *        equation, the reference the filter structures are checked against.
+ */
+inline std::vector<Vath::highprecision> GetImpulseResponse(const Vath::PolynomialFraction& h, size_t length)
+{
+    // y[n] = sum b_k x[n - k] - sum a_k y[n - k] with the coefficients in powers of z^-1
+    Vath::CoefficientList a = h.denominator.GetCoefficients();
+    Vath::CoefficientList b = h.numerator.GetCoefficients();
+    while(b.size() < a.size())
+    {
+        b.push_front(0);
+    }
+    std::vector<Vath::highprecision> y(length, 0);
+    for(size_t n = 0; n < length; n++)
+    {
+        Vath::highprecision value = (n < b.size()) ? b[n] : 0;
+        for(size_t k = 1; k < a.size() && k <= n; k++)
+        {
+            value -= a[k] * y[n - k];
+        }
+        y[n] = value / a[0];
+    }
+    return y;
+}
+
+/**
+ * \brief A low and a high frequency tone below a third of the nyquist frequency. They stay within [-0.7, 0.7], so
+ *        they fit Q15 and Q31 as well.
+ */
+inline std::vector<Vath::highprecision> GetTestSignal(size_t length, Vath::highprecision phase = 0)
+{
+    std::vector<Vath::highprecision> signal;
+    for(size_t n = 0; n < length; n++)
+    {
+        signal.push_back(0.4L * std::sin(0.07L * n + phase) + 0.3L * std::cos(0.9L * n + 0.2L));
+    }
+    return signal;
+}
+
+#endif /* _TESTHELPERS_HPP_ */
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "../application/headers/polynomial.hpp"
+#include "../application/headers/monomial.hpp"
+#include "../application/headers/zeropolegain.hpp"
+#include "../application/headers/analogprototype.hpp"
+
+using namespace Vath;
+
+typedef std::complex<highprecision> Complex;
+
+TEST(ZeroPoleGainTests, Operator_Multiply_FiltersAreCascaded_ZerosAndPolesAreConcatenated)
+{
+    ZeroPoleGain first(std::vector<Complex>{-1}, std::vector<Complex>{Complex(-0.5, -0.5), Complex(-0.5, 0.5)}, 2);
+    ZeroPoleGain second(std::vector<Complex>{Complex(0, -3), Complex(0, 3)}, std::vector<Complex>{-2}, 0.25);
+    ZeroPoleGain cascade = first * second;
+
+    EXPECT_FALSE(cascade.IsExpanded());
+    ASSERT_EQ(cascade.GetZeros().size(), 3);
+    ASSERT_EQ(cascade.GetPoles().size(), 3);
+    EXPECT_EQ(cascade.GetZeros()[0], Complex(-1));
+    EXPECT_EQ(cascade.GetZeros()[2], Complex(0, 3));
+    EXPECT_EQ(cascade.GetPoles()[2], Complex(-2));
+    EXPECT_EQ(cascade.GetGain(), 0.5);
+
+    for(Complex x : {Complex(0, 1), Complex(1, 0), Complex(-3, 2)})
+    {
+        Complex expected = first.EvaluateAt(x) * second.EvaluateAt(x);
+        EXPECT_LT(std::abs(cascade.EvaluateAt(x) - expected), 1E-15 * std::abs(expected));
+    }
+}
+
+TEST(ZeroPoleGainTests, Method_ToTransferFunction_ZerosAndPolesAreExpanded_TransferFunctionIsCachedUntilChanged)
+{
+    // 3 (x + 1)(x^2 + 4) / ((x - 2)(x^2 + 2x + 2))
+    ZeroPoleGain h(std::vector<Complex>{Complex(0, 2), -1, Complex(0, -2)}, std::vector<Complex>{Complex(-1, 1), Complex(-1, -1), 2}, 3);
+    EXPECT_FALSE(h.IsExpanded());
+
+    PolynomialFraction f = h.ToTransferFunction();
+    EXPECT_TRUE(h.IsExpanded());
+    CoefficientList numerator = f.numerator.GetCoefficients();
+    CoefficientList denominator = f.denominator.GetCoefficients();
+    CoefficientList expectedNumerator{3, 3, 12, 12};
+    CoefficientList expectedDenominator{1, 0, -2, -4};
+    ASSERT_EQ(numerator.size(), expectedNumerator.size());
+    ASSERT_EQ(denominator.size(), expectedDenominator.size());
+    for(size_t i = 0; i < numerator.size(); i++)
+    {
+        EXPECT_NEAR(numerator[i], expectedNumerator[i], 1E-15);
+        EXPECT_NEAR(denominator[i], expectedDenominator[i], 1E-15);
+    }
+
+    h *= ZeroPoleGain(std::vector<Complex>{}, std::vector<Complex>{-3}, 1);
+    EXPECT_FALSE(h.IsExpanded());
+    EXPECT_EQ(h.ToTransferFunction().denominator.GetOrder(), 4);
+    h.SetGain(1);
+    EXPECT_FALSE(h.IsExpanded());
+
+    // A non-real zero without its conjugate can not be expanded to real polynomials
+    bool exceptionWasThrown = false;
+    try
+    {
+        ZeroPoleGain(std::vector<Complex>{Complex(1, 1)}, std::vector<Complex>{}, 1).ToTransferFunction();
+    }
+    catch(...)
+    {
+        exceptionWasThrown = true;
+    }
+    EXPECT_TRUE(exceptionWasThrown);
+}
+
+TEST(ZeroPoleGainTests, Method_FromTransferFunction_TransferFunctionsAreFactored_ExpansionsMatch)
+{
+    PolynomialFraction f{ .numerator = Polynomial(CoefficientList{2, -2, 4}), .denominator = Polynomial(CoefficientList{4, 10, 14, 8}) };
+    ZeroPoleGain h = ZeroPoleGain::FromTransferFunction(f);
+    EXPECT_EQ(h.GetZeros().size(), 2);
+    EXPECT_EQ(h.GetPoles().size(), 3);
+    EXPECT_EQ(h.GetGain(), 0.5);
+
+    PolynomialFraction g = h.ToTransferFunction();
+    CoefficientList numerator = g.numerator.GetCoefficients();
+    CoefficientList denominator = g.denominator.GetCoefficients();
+    for(size_t i = 0; i < numerator.size(); i++)
+    {
+        EXPECT_NEAR(numerator[i], f.numerator.GetCoefficients()[i] / 4, 1E-15);
+    }
+    for(size_t i = 0; i < denominator.size(); i++)
+    {
+        EXPECT_NEAR(denominator[i], f.denominator.GetCoefficients()[i] / 4, 1E-15);
+    }
+}
+
+TEST(ZeroPoleGainTests, Method_FromTransferFunction_MultipleZerosAreProvided_ZerosAreAccurate)
+{
+    // The numerator (z + 1)^6 of a bilinear transformed lowpass, the zeros would only be accurate to about 1/6 of the
+    // digits, if they were found directly
+    Polynomial numerator(CoefficientList{1, 1});
+    for(int i = 1; i < 6; i++)
+    {
+        numerator = numerator * Polynomial(CoefficientList{1, 1});
+    }
+    PolynomialFraction f{ .numerator = numerator, .denominator = Polynomial(CoefficientList{1, -0.5, 0.25}) };
+    ZeroPoleGain h = ZeroPoleGain::FromTransferFunction(f);
+    ASSERT_EQ(h.GetZeros().size(), 6);
+    for(const Complex& zero : h.GetZeros())
+    {
+        EXPECT_NEAR(zero.real(), -1, 1E-15);
+        EXPECT_EQ(zero.imag(), 0);
+    }
+
+    // Close, but distinct zeros are not merged into a multiple one
+    PolynomialFraction g{ .numerator = Polynomial::FromZeros(std::vector<Complex>{1, 1 + 1E-6L, 3}), .denominator = Polynomial(CoefficientList{1}) };
+    std::vector<highprecision> correctZeros{1, 1 + 1E-6L, 3};
+    h = ZeroPoleGain::FromTransferFunction(g);
+    ASSERT_EQ(h.GetZeros().size(), 3);
+    for(size_t i = 0; i < correctZeros.size(); i++)
+    {
+        EXPECT_NEAR(h.GetZeros()[i].real(), correctZeros[i], 1E-12);
+    }
+}
+
+TEST(ZeroPoleGainTests, Method_ToTransferFunction_PrototypesAreCascaded_MatchesExpandedPrototypes)
+{
+    // Cascading prototypes equals multiplying their expanded transfer functions
+    ZeroPoleGain elliptic(AnalogPrototype::Design(PrototypeType::Elliptic, 5, 0.5, 60));
+    ZeroPoleGain butterworth(AnalogPrototype::Design(PrototypeType::Butterworth, 12));
+    PolynomialFraction cascade = (elliptic * butterworth).ToTransferFunction();
+
+    PolynomialFraction first = AnalogPrototype::DesignTransferFunction(PrototypeType::Elliptic, 5, 0.5, 60);
+    PolynomialFraction second = AnalogPrototype::DesignTransferFunction(PrototypeType::Butterworth, 12);
+    CoefficientList expectedNumerator = (first.numerator * second.numerator).GetCoefficients();
+    CoefficientList expectedDenominator = (first.denominator * second.denominator).GetCoefficients();
+    CoefficientList numerator = cascade.numerator.GetCoefficients();
+    CoefficientList denominator = cascade.denominator.GetCoefficients();
+    ASSERT_EQ(numerator.size(), expectedNumerator.size());
+    ASSERT_EQ(denominator.size(), expectedDenominator.size());
+    for(size_t i = 0; i < numerator.size(); i++)
+    {
+        EXPECT_NEAR(numerator[i], expectedNumerator[i], 1E-12 * std::max<highprecision>(1, std::abs(expectedNumerator[i])));
+    }
+    for(size_t i = 0; i < denominator.size(); i++)
+    {
+        EXPECT_NEAR(denominator[i], expectedDenominator[i], 1E-12 * std::max<highprecision>(1, std::abs(expectedDenominator[i])));
+    }
+}